@@ -11,5 +11,16 @@ for some program parts if implemented.
 Set the environment variable `GT_SEED` to an integer value to supply a seed for
 the random number generator. Can be overridden by the `-seed` option.
 
+Set the environment variable `GT_MMAP_POLICY` to pass access hints for memory
+mapped index tables to the operating system, separately for each table suffix
+(e.g., `GT_MMAP_POLICY="suf=random,hugepages;lcp=sequential;*=willneed"`).
+Possible hints are `normal`, `sequential`, `random`, `willneed`, `hugepages`,
+`populate` and `interleave` (spread the table over all NUMA nodes).
+
+Set the environment variable `GT_SORT_MEMLIMIT` to a number of bytes,
+optionally followed by `k`, `M`, or `G`, to sort GFF3 features in external
+memory wherever they are sorted (e.g., `gt gff3 -sort`). Sorted runs of features
+exceeding this limit are written to temporary files and merged on output.
+
 Combinations are possible. Running the `gt` binary with `GT_ENV_OPTIONS=-help`
 shows all possible "environment options".]])
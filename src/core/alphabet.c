@@ -767,6 +767,28 @@ void gt_alphabet_decode_seq_to_fp(const GtAlphabet *alphabet, FILE *fpout,
   }
 }
 
+void gt_alphabet_decode_seq_to_str_append(const GtAlphabet *alphabet,
+                                          GtStr *dest,
+                                          const GtUchar *src,
+                                          GtUword len)
+{
+  GtUword i;
+  const GtUchar *characters;
+  gt_assert(dest != NULL && (len == 0 || src != NULL));
+
+  if (alphabet == NULL)
+  {
+    characters = (const GtUchar *) "acgt";
+  } else
+  {
+    characters = alphabet->characters;
+  }
+  for (i = 0; i < len; i++)
+  {
+    gt_str_append_char(dest, (char) characters[(int) src[i]]);
+  }
+}
+
 void gt_alphabet_printf_symbolstring(const GtAlphabet *alphabet,
                                      const GtUchar *w, GtUword len)
 {
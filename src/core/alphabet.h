@@ -31,6 +31,13 @@
 /* the size of the DNA alphabet */
 #define GT_DNAALPHASIZE        4U
 
+/* Analog to <gt_alphabet_decode_seq_to_fp()> appending the output to
+   the string <dest>. */
+void gt_alphabet_decode_seq_to_str_append(const GtAlphabet *alphabet,
+                                          GtStr *dest,
+                                          const GtUchar *src,
+                                          GtUword len);
+
 int gt_alphabet_unit_test(GtError *err);
 
 #endif
@@ -0,0 +1,206 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/arena.h"
+#include "core/assert_api.h"
+#include "core/ensure.h"
+#include "core/ma.h"
+#include "core/thread_api.h"
+
+#define GT_ARENA_SLAB_SIZE  (64 * 1024)
+#define GT_ARENA_ALIGNMENT  (2 * sizeof (void*))
+#define GT_ARENA_ALIGN(N) \
+        (((N) + GT_ARENA_ALIGNMENT - 1) & ~(GT_ARENA_ALIGNMENT - 1))
+/* larger blocks get a slab of their own */
+#define GT_ARENA_MAX_SHARED_BLOCK  (GT_ARENA_SLAB_SIZE / 4)
+
+typedef struct GtArenaSlab {
+  struct GtArenaSlab *next;
+} GtArenaSlab;
+
+#define GT_ARENA_SLAB_HEADER  GT_ARENA_ALIGN(sizeof (GtArenaSlab))
+
+struct GtArena {
+  GtArenaSlab *slabs;
+  char *next, /* the free part of the current slab */
+       *end,
+       *last; /* the block allocated last, which can grow in place */
+  GtUword size;
+  GtMutex *mutex;
+  unsigned int reference_count;
+};
+
+GtArena* gt_arena_new(void)
+{
+  GtArena *arena = gt_calloc((size_t) 1, sizeof *arena);
+  arena->mutex = gt_mutex_new();
+  return arena;
+}
+
+GtArena* gt_arena_ref(GtArena *arena)
+{
+  gt_assert(arena);
+#ifdef GT_THREADS_ENABLED
+  (void) __sync_add_and_fetch(&arena->reference_count, 1);
+#else
+  arena->reference_count++;
+#endif
+  return arena;
+}
+
+static char* arena_new_slab(GtArena *arena, size_t size)
+{
+  GtArenaSlab *slab = gt_malloc(GT_ARENA_SLAB_HEADER + size);
+  slab->next = arena->slabs;
+  arena->slabs = slab;
+  arena->size += GT_ARENA_SLAB_HEADER + size;
+  return (char*) slab + GT_ARENA_SLAB_HEADER;
+}
+
+/* the mutex of <arena> must be locked */
+static void* arena_alloc(GtArena *arena, size_t size)
+{
+  char *block;
+  size = size ? GT_ARENA_ALIGN(size) : GT_ARENA_ALIGNMENT;
+  if (size > GT_ARENA_MAX_SHARED_BLOCK) {
+    /* the current slab stays current */
+    return arena_new_slab(arena, size);
+  }
+  if (arena->next == NULL || arena->next + size > arena->end) {
+    arena->next = arena_new_slab(arena, (size_t) GT_ARENA_SLAB_SIZE);
+    arena->end = arena->next + GT_ARENA_SLAB_SIZE;
+  }
+  block = arena->next;
+  arena->next += size;
+  arena->last = block;
+  return block;
+}
+
+void* gt_arena_alloc(GtArena *arena, size_t size)
+{
+  void *block;
+  gt_assert(arena);
+  gt_mutex_lock(arena->mutex);
+  block = arena_alloc(arena, size);
+  gt_mutex_unlock(arena->mutex);
+  return block;
+}
+
+void* gt_arena_realloc(GtArena *arena, void *block, size_t oldsize,
+                       size_t newsize)
+{
+  void *newblock;
+  gt_assert(arena);
+  if (block == NULL)
+    return gt_arena_alloc(arena, newsize);
+  gt_mutex_lock(arena->mutex);
+  if (block == arena->last &&
+      arena->last + GT_ARENA_ALIGN(newsize) <= arena->end) {
+    arena->next = arena->last + (newsize ? GT_ARENA_ALIGN(newsize)
+                                         : GT_ARENA_ALIGNMENT);
+    newblock = block;
+  }
+  else if (newsize <= oldsize)
+    newblock = block;
+  else {
+    newblock = arena_alloc(arena, newsize);
+    memcpy(newblock, block, oldsize);
+  }
+  gt_mutex_unlock(arena->mutex);
+  return newblock;
+}
+
+GtUword gt_arena_size(GtArena *arena)
+{
+  GtUword size;
+  gt_assert(arena);
+  gt_mutex_lock(arena->mutex);
+  size = arena->size;
+  gt_mutex_unlock(arena->mutex);
+  return size;
+}
+
+void gt_arena_delete(GtArena *arena)
+{
+  GtArenaSlab *slab, *next;
+  if (!arena) return;
+#ifdef GT_THREADS_ENABLED
+  {
+    unsigned int reference_count;
+    while ((reference_count = arena->reference_count)) {
+      if (__sync_bool_compare_and_swap(&arena->reference_count,
+                                       reference_count, reference_count - 1)) {
+        return;
+      }
+    }
+  }
+#else
+  if (arena->reference_count) {
+    arena->reference_count--;
+    return;
+  }
+#endif
+  for (slab = arena->slabs; slab != NULL; slab = next) {
+    next = slab->next;
+    gt_free(slab);
+  }
+  gt_mutex_delete(arena->mutex);
+  gt_free(arena);
+}
+
+int gt_arena_unit_test(GtError *err)
+{
+  GtArena *arena;
+  char *blocks[1000], *block, *big;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+
+  arena = gt_arena_new();
+  for (i = 0; i < 1000; i++) {
+    size_t size = 1 + i % 300;
+    blocks[i] = gt_arena_alloc(arena, size);
+    gt_ensure((size_t) blocks[i] % GT_ARENA_ALIGNMENT == 0);
+    memset(blocks[i], (int) (i % 128), size);
+  }
+  for (i = 0; !had_err && i < 1000; i++) {
+    size_t j, size = 1 + i % 300;
+    for (j = 0; j < size; j++)
+      gt_ensure(blocks[i][j] == (char) (i % 128));
+  }
+  /* the last block grows in place, others are copied */
+  block = gt_arena_alloc(arena, 10);
+  memcpy(block, "abcdefghi", 10);
+  gt_ensure(gt_arena_realloc(arena, block, 10, 100) == block);
+  gt_ensure(gt_arena_realloc(arena, blocks[0], 1, 1) == blocks[0]);
+  big = gt_arena_alloc(arena, (size_t) GT_ARENA_SLAB_SIZE);
+  memset(big, 'x', (size_t) GT_ARENA_SLAB_SIZE);
+  gt_ensure(gt_arena_realloc(arena, block, 100, 200) == block);
+  block = gt_arena_alloc(arena, 16);
+  memcpy(block, "abcdefghi", 10);
+  (void) gt_arena_alloc(arena, 1);
+  block = gt_arena_realloc(arena, block, 16, 5000);
+  gt_ensure(strcmp(block, "abcdefghi") == 0);
+  gt_ensure(gt_arena_size(arena) > (GtUword) 2 * GT_ARENA_SLAB_SIZE);
+  /* blocks remain valid until the last reference is dropped */
+  (void) gt_arena_ref(arena);
+  gt_arena_delete(arena);
+  gt_ensure(big[GT_ARENA_SLAB_SIZE - 1] == 'x');
+  gt_arena_delete(arena);
+
+  return had_err;
+}
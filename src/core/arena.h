@@ -0,0 +1,51 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdlib.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* A <GtArena> hands out memory blocks carved from large slabs, for objects
+   which are created together and die together, like the feature nodes parsed
+   from one file. Blocks are never freed one by one. Instead, each object
+   allocated from an arena holds a reference to it, and all slabs are released
+   at once when the last reference is dropped. Allocating is thread-safe,
+   references can be dropped from any thread. */
+typedef struct GtArena GtArena;
+
+/* Return a new arena, the caller holds its first reference. */
+GtArena* gt_arena_new(void);
+/* Return a new reference to <arena>. */
+GtArena* gt_arena_ref(GtArena *arena);
+/* Return a block of <size> bytes from <arena>, aligned for any object
+   stored in genome nodes. */
+void*    gt_arena_alloc(GtArena *arena, size_t size);
+/* Resize the <block> of <oldsize> bytes allocated from <arena> to <newsize>
+   bytes. If <block> is the block allocated last, it grows in place. Otherwise
+   its contents are copied to a new block, and the old one is only reclaimed
+   with the whole arena. */
+void*    gt_arena_realloc(GtArena *arena, void *block, size_t oldsize,
+                          size_t newsize);
+/* Return the number of bytes of all slabs of <arena>. */
+GtUword  gt_arena_size(GtArena *arena);
+/* Drop a reference to <arena>. The last one releases all of its slabs. */
+void     gt_arena_delete(GtArena *arena);
+int      gt_arena_unit_test(GtError *err);
+
+#endif
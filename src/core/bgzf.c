@@ -0,0 +1,588 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "core/assert_api.h"
+#include "core/bgzf.h"
+#include "core/ma.h"
+#include "core/thread_api.h"
+#include "core/xansi_api.h"
+
+/* size of the fixed part of a gzip header */
+#define GT_BGZF_GZIPHEADERSIZE    12
+/* size of the header of a block written by this module */
+#define GT_BGZF_HEADERSIZE        18
+#define GT_BGZF_TRAILERSIZE       8
+/* maximal size of a block, compressed and uncompressed */
+#define GT_BGZF_MAXBLOCKSIZE      65536
+/* maximal size of the uncompressed data of a written block, chosen such that
+   even incompressible data fits into a block */
+#define GT_BGZF_MAXDATASIZE       0xff00
+#define GT_BGZF_BLOCKS_PER_THREAD 16
+
+typedef enum
+{
+  GT_BGZF_READ_BLOCK,
+  GT_BGZF_READ_EOF,
+  GT_BGZF_READ_PLAIN, /* a gzip member without a BGZF block size */
+  GT_BGZF_READ_ERROR
+} GtBgzfReadStatus;
+
+typedef struct
+{
+  unsigned char *cdata; /* the complete block, including header and trailer */
+  char *udata;
+  size_t csize,
+         dataoffset,    /* start of the deflated data in <cdata> */
+         usize;
+  bool failed;
+} GtBgzfBlock;
+
+typedef struct
+{
+  GtBgzfBlock *blocks;
+  GtUword numofblocks;
+  unsigned int numofthreads,
+               threadnum;
+  bool compress;
+  int level;
+  GtThread *thread;
+} GtBgzfBatchinfo;
+
+struct GtBgzfReader
+{
+  FILE *fp;
+  GtBgzfBlock *blocks;
+  GtUword maxblocks,
+          numofblocks,
+          currentblock;
+  size_t currentpos; /* position in the uncompressed data of currentblock */
+  unsigned int numofthreads;
+  /* from the first gzip member without a BGZF block size on, the file is
+     inflated sequentially with <zs>, using the first block as buffer */
+  z_stream zs;
+  bool plain,
+       inmember,
+       plaineof;
+};
+
+struct GtBgzfWriter
+{
+  FILE *fp;
+  GtBgzfBlock *blocks;
+  GtUword maxblocks,
+          numofblocks; /* the last block may not be full */
+  unsigned int numofthreads;
+  int level;
+};
+
+/* an empty block which marks the end of a BGZF file */
+static const unsigned char bgzf_eofblock[] = {
+  0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00,
+  0x42, 0x43, 0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static GtUword bgzf_get_uint16(const unsigned char *ptr)
+{
+  return (GtUword) ptr[0] | ((GtUword) ptr[1] << 8);
+}
+
+static GtUword bgzf_get_uint32(const unsigned char *ptr)
+{
+  return bgzf_get_uint16(ptr) | (bgzf_get_uint16(ptr + 2) << 16);
+}
+
+static void bgzf_put_uint16(unsigned char *ptr, GtUword value)
+{
+  ptr[0] = (unsigned char) (value & 0xff);
+  ptr[1] = (unsigned char) ((value >> 8) & 0xff);
+}
+
+static void bgzf_put_uint32(unsigned char *ptr, GtUword value)
+{
+  bgzf_put_uint16(ptr, value & 0xffff);
+  bgzf_put_uint16(ptr + 2, (value >> 16) & 0xffff);
+}
+
+static bool bgzf_is_gzip_header(const unsigned char *header)
+{
+  return header[0] == 0x1f && header[1] == 0x8b && header[2] == Z_DEFLATED;
+}
+
+static bool bgzf_has_extra_field(const unsigned char *header)
+{
+  return (header[3] & 0x04) != 0; /* FEXTRA flag */
+}
+
+bool gt_bgzf_is_bgzf(FILE *fp)
+{
+  unsigned char header[GT_BGZF_HEADERSIZE];
+  bool is_bgzf;
+  gt_assert(fp);
+  is_bgzf = fread(header, 1, sizeof (header), fp) == sizeof (header) &&
+            bgzf_is_gzip_header(header) && bgzf_has_extra_field(header) &&
+            bgzf_get_uint16(header + 10) >= 6 &&
+            header[12] == 'B' && header[13] == 'C' &&
+            bgzf_get_uint16(header + 14) == 2;
+  rewind(fp);
+  return is_bgzf;
+}
+
+/* Reads the next block from <fp> into <block>. If the next gzip member has
+   no BGZF block size, <fp> is positioned at its start. */
+static GtBgzfReadStatus bgzf_read_block(FILE *fp, GtBgzfBlock *block,
+                                        GtError *err)
+{
+  unsigned char *header = block->cdata;
+  GtUword xlen, pos, bsize = 0;
+  long start = ftell(fp);
+  size_t nread;
+
+  nread = gt_xfread(header, 1, GT_BGZF_GZIPHEADERSIZE, fp);
+  if (nread == 0)
+    return GT_BGZF_READ_EOF;
+  if (nread != GT_BGZF_GZIPHEADERSIZE || !bgzf_is_gzip_header(header)) {
+    gt_error_set(err, "cannot read BGZF file: invalid gzip header");
+    return GT_BGZF_READ_ERROR;
+  }
+  xlen = bgzf_get_uint16(header + 10);
+  if (bgzf_has_extra_field(header) &&
+      GT_BGZF_GZIPHEADERSIZE + xlen + GT_BGZF_TRAILERSIZE
+      <= GT_BGZF_MAXBLOCKSIZE) {
+    if (gt_xfread(header + GT_BGZF_GZIPHEADERSIZE, 1, xlen, fp) != xlen) {
+      gt_error_set(err, "cannot read BGZF file: truncated gzip header");
+      return GT_BGZF_READ_ERROR;
+    }
+    for (pos = GT_BGZF_GZIPHEADERSIZE;
+         pos + 4 <= GT_BGZF_GZIPHEADERSIZE + xlen;
+         pos += 4 + bgzf_get_uint16(header + pos + 2)) {
+      if (header[pos] == 'B' && header[pos+1] == 'C' &&
+          bgzf_get_uint16(header + pos + 2) == 2 &&
+          pos + 6 <= GT_BGZF_GZIPHEADERSIZE + xlen) {
+        bsize = bgzf_get_uint16(header + pos + 4) + 1;
+      }
+    }
+  }
+  if (bsize == 0) {
+    /* a plain gzip member, as in a concatenation of gzip files */
+    gt_xfseek(fp, (GtWord) start, SEEK_SET);
+    return GT_BGZF_READ_PLAIN;
+  }
+  block->dataoffset = GT_BGZF_GZIPHEADERSIZE + xlen;
+  if (bsize < block->dataoffset + GT_BGZF_TRAILERSIZE) {
+    gt_error_set(err, "cannot read BGZF file: invalid block size");
+    return GT_BGZF_READ_ERROR;
+  }
+  if (gt_xfread(header + block->dataoffset, 1, bsize - block->dataoffset, fp)
+      != bsize - block->dataoffset) {
+    gt_error_set(err, "cannot read BGZF file: truncated block");
+    return GT_BGZF_READ_ERROR;
+  }
+  block->csize = bsize;
+  return GT_BGZF_READ_BLOCK;
+}
+
+static void bgzf_inflate_block(GtBgzfBlock *block)
+{
+  const unsigned char *trailer = block->cdata + block->csize
+                                 - GT_BGZF_TRAILERSIZE;
+  GtUword isize = bgzf_get_uint32(trailer + 4);
+  z_stream zs;
+  int ret;
+
+  block->failed = true;
+  if (isize > GT_BGZF_MAXBLOCKSIZE)
+    return;
+  memset(&zs, 0, sizeof (zs));
+  if (inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+    return;
+  zs.next_in = block->cdata + block->dataoffset;
+  zs.avail_in = (uInt) (block->csize - block->dataoffset
+                        - GT_BGZF_TRAILERSIZE);
+  zs.next_out = (Bytef *) block->udata;
+  zs.avail_out = GT_BGZF_MAXBLOCKSIZE;
+  ret = inflate(&zs, Z_FINISH);
+  (void) inflateEnd(&zs);
+  if (ret != Z_STREAM_END || zs.total_out != isize ||
+      crc32(crc32(0L, Z_NULL, 0), (Bytef *) block->udata, (uInt) isize)
+        != bgzf_get_uint32(trailer)) {
+    return;
+  }
+  block->usize = (size_t) isize;
+  block->failed = false;
+}
+
+static void bgzf_deflate_block(GtBgzfBlock *block, int level)
+{
+  unsigned char *cdata = block->cdata;
+  z_stream zs;
+  int ret;
+
+  block->failed = true;
+  memset(&zs, 0, sizeof (zs));
+  if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    return;
+  }
+  zs.next_in = (Bytef *) block->udata;
+  zs.avail_in = (uInt) block->usize;
+  zs.next_out = cdata + GT_BGZF_HEADERSIZE;
+  zs.avail_out = GT_BGZF_MAXBLOCKSIZE - GT_BGZF_HEADERSIZE
+                 - GT_BGZF_TRAILERSIZE;
+  ret = deflate(&zs, Z_FINISH);
+  (void) deflateEnd(&zs);
+  if (ret != Z_STREAM_END)
+    return;
+  block->csize = GT_BGZF_HEADERSIZE + zs.total_out + GT_BGZF_TRAILERSIZE;
+  /* the header only differs from the end-of-file block in BSIZE */
+  memcpy(cdata, bgzf_eofblock, GT_BGZF_HEADERSIZE);
+  bgzf_put_uint16(cdata + 16, block->csize - 1);
+  bgzf_put_uint32(cdata + block->csize - GT_BGZF_TRAILERSIZE,
+                  crc32(crc32(0L, Z_NULL, 0), (Bytef *) block->udata,
+                        (uInt) block->usize));
+  bgzf_put_uint32(cdata + block->csize - 4, block->usize);
+  block->failed = false;
+}
+
+static void *bgzf_process_blocks(void *data)
+{
+  GtBgzfBatchinfo *batchinfo = (GtBgzfBatchinfo *) data;
+  GtUword idx;
+
+  for (idx = batchinfo->threadnum; idx < batchinfo->numofblocks;
+       idx += batchinfo->numofthreads) {
+    if (batchinfo->compress)
+      bgzf_deflate_block(batchinfo->blocks + idx, batchinfo->level);
+    else
+      bgzf_inflate_block(batchinfo->blocks + idx);
+  }
+  return NULL;
+}
+
+/* Compresses or decompresses the <numofblocks> <blocks> with up to
+   <numofthreads> threads, each thread handling every
+   <numofthreads>-th block. */
+static void bgzf_process_batch(GtBgzfBlock *blocks, GtUword numofblocks,
+                               unsigned int numofthreads, bool compress,
+                               int level)
+{
+  GtBgzfBatchinfo *batchinfotab;
+  unsigned int t;
+
+  if ((GtUword) numofthreads > numofblocks)
+    numofthreads = (unsigned int) numofblocks;
+#ifndef GT_THREADS_ENABLED
+  numofthreads = 1U;
+#endif
+  batchinfotab = gt_malloc(sizeof (*batchinfotab) * numofthreads);
+  for (t = 0; t < numofthreads; t++) {
+    batchinfotab[t].blocks = blocks;
+    batchinfotab[t].numofblocks = numofblocks;
+    batchinfotab[t].numofthreads = numofthreads;
+    batchinfotab[t].threadnum = t;
+    batchinfotab[t].compress = compress;
+    batchinfotab[t].level = level;
+  }
+#ifdef GT_THREADS_ENABLED
+  for (t = 1U; t < numofthreads; t++) {
+    batchinfotab[t].thread = gt_thread_new(bgzf_process_blocks,
+                                           batchinfotab + t, NULL);
+    gt_assert(batchinfotab[t].thread != NULL);
+  }
+#endif
+  (void) bgzf_process_blocks(batchinfotab);
+#ifdef GT_THREADS_ENABLED
+  for (t = 1U; t < numofthreads; t++) {
+    gt_thread_join(batchinfotab[t].thread);
+    gt_thread_delete(batchinfotab[t].thread);
+  }
+#endif
+  gt_free(batchinfotab);
+}
+
+static GtBgzfBlock* bgzf_blocks_new(GtUword numofblocks)
+{
+  GtBgzfBlock *blocks = gt_malloc(sizeof (*blocks) * numofblocks);
+  GtUword idx;
+
+  for (idx = 0; idx < numofblocks; idx++) {
+    blocks[idx].cdata = gt_malloc(sizeof (*blocks[idx].cdata)
+                                  * GT_BGZF_MAXBLOCKSIZE);
+    blocks[idx].udata = gt_malloc(sizeof (*blocks[idx].udata)
+                                  * GT_BGZF_MAXBLOCKSIZE);
+    blocks[idx].csize = blocks[idx].usize = 0;
+  }
+  return blocks;
+}
+
+static void bgzf_blocks_delete(GtBgzfBlock *blocks, GtUword numofblocks)
+{
+  GtUword idx;
+
+  for (idx = 0; idx < numofblocks; idx++) {
+    gt_free(blocks[idx].cdata);
+    gt_free(blocks[idx].udata);
+  }
+  gt_free(blocks);
+}
+
+GtBgzfReader* gt_bgzf_reader_new(FILE *fp)
+{
+  GtBgzfReader *reader;
+  gt_assert(fp);
+  reader = gt_malloc(sizeof (*reader));
+  reader->fp = fp;
+  reader->numofthreads = gt_jobs;
+  reader->maxblocks = (GtUword) reader->numofthreads
+                      * GT_BGZF_BLOCKS_PER_THREAD;
+  reader->blocks = bgzf_blocks_new(reader->maxblocks);
+  reader->numofblocks = reader->currentblock = 0;
+  reader->currentpos = 0;
+  memset(&reader->zs, 0, sizeof (reader->zs));
+  reader->plain = reader->inmember = reader->plaineof = false;
+  return reader;
+}
+
+/* Inflates the data following the last BGZF block into the first block of
+   <reader>, member by member. Like gzread(), anything following a gzip member
+   which does not start another one is ignored. Returns 1 if data was
+   inflated, 0 at the end of the file and -1 if an error occurred. */
+static int bgzf_reader_inflate(GtBgzfReader *reader, GtError *err)
+{
+  GtBgzfBlock *block = reader->blocks;
+  z_stream *zs = &reader->zs;
+  int ret;
+
+  zs->next_out = (Bytef *) block->udata;
+  zs->avail_out = GT_BGZF_MAXBLOCKSIZE;
+  while (!reader->plaineof && zs->avail_out > 0) {
+    if (zs->avail_in == 0) {
+      size_t nread = gt_xfread(block->cdata, 1, GT_BGZF_MAXBLOCKSIZE,
+                               reader->fp);
+      if (nread == 0) {
+        if (reader->inmember) {
+          gt_error_set(err, "cannot read BGZF file: truncated gzip member");
+          return -1;
+        }
+        reader->plaineof = true;
+        break;
+      }
+      zs->next_in = block->cdata;
+      zs->avail_in = (uInt) nread;
+    }
+    if (!reader->inmember) {
+      if (zs->next_in[0] != 0x1f) {
+        reader->plaineof = true;
+        break;
+      }
+      (void) inflateReset(zs);
+      reader->inmember = true;
+    }
+    ret = inflate(zs, Z_NO_FLUSH);
+    if (ret == Z_STREAM_END)
+      reader->inmember = false;
+    else if (ret != Z_OK) {
+      gt_error_set(err, "cannot read BGZF file: corrupt compressed data");
+      return -1;
+    }
+  }
+  block->usize = GT_BGZF_MAXBLOCKSIZE - zs->avail_out;
+  reader->numofblocks = block->usize > 0 ? 1UL : 0;
+  return block->usize > 0 ? 1 : 0;
+}
+
+/* Reads the next batch of blocks and decompresses them. Returns 1 if blocks
+   were read, 0 at the end of the file and -1 if an error occurred. */
+static int bgzf_reader_fill(GtBgzfReader *reader, GtError *err)
+{
+  GtBgzfReadStatus status = GT_BGZF_READ_EOF;
+  GtUword idx;
+
+  reader->numofblocks = reader->currentblock = 0;
+  reader->currentpos = 0;
+  if (reader->plain)
+    return bgzf_reader_inflate(reader, err);
+  while (reader->numofblocks < reader->maxblocks &&
+         (status = bgzf_read_block(reader->fp,
+                                   reader->blocks + reader->numofblocks,
+                                   err)) == GT_BGZF_READ_BLOCK) {
+    reader->numofblocks++;
+  }
+  if (status == GT_BGZF_READ_ERROR)
+    return -1;
+  if (status == GT_BGZF_READ_PLAIN) {
+    if (inflateInit2(&reader->zs, 16 + MAX_WBITS) != Z_OK) {
+      gt_error_set(err, "cannot read BGZF file: %s",
+                   reader->zs.msg != NULL ? reader->zs.msg
+                                          : "inflateInit2() failed");
+      return -1;
+    }
+    reader->plain = true;
+    if (reader->numofblocks == 0)
+      return bgzf_reader_inflate(reader, err);
+  }
+  if (reader->numofblocks == 0)
+    return 0;
+  bgzf_process_batch(reader->blocks, reader->numofblocks,
+                     reader->numofthreads, false, 0);
+  for (idx = 0; idx < reader->numofblocks; idx++) {
+    if (reader->blocks[idx].failed) {
+      gt_error_set(err, "cannot read BGZF file: corrupt compressed data");
+      return -1;
+    }
+  }
+  return 1;
+}
+
+int gt_bgzf_reader_read(GtBgzfReader *reader, void *buf, unsigned len,
+                        GtError *err)
+{
+  char *cbuf = buf;
+  unsigned nread = 0;
+  gt_error_check(err);
+  gt_assert(reader && buf);
+  while (nread < len) {
+    GtBgzfBlock *block;
+    size_t available;
+    if (reader->currentblock == reader->numofblocks) {
+      int rval = bgzf_reader_fill(reader, err);
+      if (rval == -1)
+        return -1;
+      if (rval == 0)
+        break;
+    }
+    block = reader->blocks + reader->currentblock;
+    available = block->usize - reader->currentpos;
+    if (available > (size_t) (len - nread))
+      available = (size_t) (len - nread);
+    memcpy(cbuf + nread, block->udata + reader->currentpos, available);
+    reader->currentpos += available;
+    nread += (unsigned) available;
+    if (reader->currentpos == block->usize) {
+      reader->currentblock++;
+      reader->currentpos = 0;
+    }
+  }
+  return (int) nread;
+}
+
+static void bgzf_reader_end_plain(GtBgzfReader *reader)
+{
+  if (reader->plain)
+    (void) inflateEnd(&reader->zs);
+  memset(&reader->zs, 0, sizeof (reader->zs));
+  reader->plain = reader->inmember = reader->plaineof = false;
+}
+
+void gt_bgzf_reader_rewind(GtBgzfReader *reader)
+{
+  gt_assert(reader);
+  rewind(reader->fp);
+  reader->numofblocks = reader->currentblock = 0;
+  reader->currentpos = 0;
+  bgzf_reader_end_plain(reader);
+}
+
+void gt_bgzf_reader_delete(GtBgzfReader *reader)
+{
+  if (!reader) return;
+  bgzf_reader_end_plain(reader);
+  bgzf_blocks_delete(reader->blocks, reader->maxblocks);
+  gt_free(reader);
+}
+
+GtBgzfWriter* gt_bgzf_writer_new(FILE *fp, int level)
+{
+  GtBgzfWriter *writer;
+  gt_assert(fp && level >= Z_DEFAULT_COMPRESSION && level <= 9);
+  writer = gt_malloc(sizeof (*writer));
+  writer->fp = fp;
+  writer->level = level;
+  writer->numofthreads = gt_jobs;
+  writer->maxblocks = (GtUword) writer->numofthreads
+                      * GT_BGZF_BLOCKS_PER_THREAD;
+  writer->blocks = bgzf_blocks_new(writer->maxblocks);
+  writer->numofblocks = 0;
+  return writer;
+}
+
+static int bgzf_writer_flush(GtBgzfWriter *writer, GtError *err)
+{
+  GtUword idx;
+
+  bgzf_process_batch(writer->blocks, writer->numofblocks,
+                     writer->numofthreads, true, writer->level);
+  for (idx = 0; idx < writer->numofblocks; idx++) {
+    if (writer->blocks[idx].failed) {
+      gt_error_set(err, "cannot compress BGZF block");
+      return -1;
+    }
+    gt_xfwrite(writer->blocks[idx].cdata, 1, writer->blocks[idx].csize,
+               writer->fp);
+    writer->blocks[idx].usize = 0;
+  }
+  writer->numofblocks = 0;
+  return 0;
+}
+
+int gt_bgzf_writer_write(GtBgzfWriter *writer, const void *buf, size_t len,
+                         GtError *err)
+{
+  const char *cbuf = buf;
+  gt_error_check(err);
+  gt_assert(writer && (buf || !len));
+  while (len > 0) {
+    GtBgzfBlock *block;
+    size_t space;
+    if (writer->numofblocks == 0 ||
+        writer->blocks[writer->numofblocks-1].usize == GT_BGZF_MAXDATASIZE) {
+      if (writer->numofblocks == writer->maxblocks &&
+          bgzf_writer_flush(writer, err) != 0) {
+        return -1;
+      }
+      writer->numofblocks++;
+    }
+    block = writer->blocks + writer->numofblocks - 1;
+    space = GT_BGZF_MAXDATASIZE - block->usize;
+    if (space > len)
+      space = len;
+    memcpy(block->udata + block->usize, cbuf, space);
+    block->usize += space;
+    cbuf += space;
+    len -= space;
+  }
+  return 0;
+}
+
+int gt_bgzf_writer_finish(GtBgzfWriter *writer, GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(writer);
+  if (writer->numofblocks > 0 && bgzf_writer_flush(writer, err) != 0)
+    return -1;
+  gt_xfwrite(bgzf_eofblock, 1, sizeof (bgzf_eofblock), writer->fp);
+  return 0;
+}
+
+void gt_bgzf_writer_delete(GtBgzfWriter *writer)
+{
+  if (!writer) return;
+  bgzf_blocks_delete(writer->blocks, writer->maxblocks);
+  gt_free(writer);
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BGZF_H
+#define BGZF_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "core/error_api.h"
+
+/*
+  This module reads and writes files in the blocked gzip format (BGZF) used
+  by bgzip, samtools and tabix. A BGZF file is a series of gzip members of
+  at most 64 KiB uncompressed data each, which record their compressed size
+  in an extra field of the gzip header. Therefore a batch of blocks can be
+  read sequentially and then be decompressed (or compressed) by <gt_jobs>
+  threads in parallel. Every BGZF file is a valid gzip file. Gzip members
+  without a BGZF block size, for example from appending a plain gzip file to
+  a BGZF file, are read sequentially with zlib.
+  Errors in the compressed data are reported through a <GtError>, I/O errors
+  terminate the program like the functions from <core/xansi_api.h>.
+*/
+
+typedef struct GtBgzfReader GtBgzfReader;
+typedef struct GtBgzfWriter GtBgzfWriter;
+
+/* Returns true if the file <fp> starts with a BGZF block. The file position
+   of <fp> is reset to the start of the file, so <fp> must be seekable. */
+bool          gt_bgzf_is_bgzf(FILE *fp);
+
+/* Returns a new <GtBgzfReader> for the BGZF file <fp> opened for reading
+   and positioned at the start of a block. <fp> is not closed by the
+   reader. */
+GtBgzfReader* gt_bgzf_reader_new(FILE *fp);
+/* Reads up to <len> bytes of uncompressed data from <reader> into <buf> and
+   returns the number of bytes read, which is smaller than <len> only at the
+   end of the file. Returns -1 and sets <err> if the file is corrupt. */
+int           gt_bgzf_reader_read(GtBgzfReader *reader, void *buf,
+                                  unsigned len, GtError *err);
+/* Restarts reading from the start of the underlying file. */
+void          gt_bgzf_reader_rewind(GtBgzfReader *reader);
+void          gt_bgzf_reader_delete(GtBgzfReader *reader);
+
+/* Returns a new <GtBgzfWriter> writing to <fp> with the given compression
+   <level> (0 to 9, or -1 for the default of zlib). */
+GtBgzfWriter* gt_bgzf_writer_new(FILE *fp, int level);
+/* Appends the <len> bytes from <buf> to the uncompressed data of <writer>,
+   which are split into blocks. Returns -1 and sets <err> if a block cannot be
+   compressed. */
+int           gt_bgzf_writer_write(GtBgzfWriter *writer, const void *buf,
+                                   size_t len, GtError *err);
+/* Writes all pending blocks and the BGZF end-of-file marker block. Returns
+   -1 and sets <err> if a block cannot be compressed. */
+int           gt_bgzf_writer_finish(GtBgzfWriter *writer, GtError *err);
+/* Deletes <writer>, <fp> is not closed. */
+void          gt_bgzf_writer_delete(GtBgzfWriter *writer);
+
+#endif
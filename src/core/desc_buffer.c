@@ -109,6 +109,24 @@ void gt_desc_buffer_finish(GtDescBuffer *db)
   db->finished = true;
 }
 
+void gt_desc_buffer_transfer(GtDescBuffer *db, GtDescBuffer *src)
+{
+  GtUword i;
+  gt_assert(db && src && !src->shorten);
+  for (i = 0; i < src->length; i++) {
+    if (src->buf[i] == '\0')
+      gt_desc_buffer_finish(db);
+    else
+      gt_desc_buffer_append_char(db, src->buf[i]);
+  }
+  while (gt_queue_size(src->startqueue) > 0)
+    (void) gt_queue_get(src->startqueue);
+  gt_queue_add(src->startqueue, (void*) 0);
+  src->length = src->curlength = 0;
+  src->finished = false;
+  src->dirty = true;
+}
+
 GtUword gt_desc_buffer_length(const GtDescBuffer *db)
 {
   return db ? db->length : 0;
@@ -243,5 +261,30 @@ int gt_desc_buffer_unit_test(GtError *err)
   gt_ensure(gt_desc_buffer_length(s) == 12);
   gt_desc_buffer_delete(s);
 
+  if (!had_err) {
+    GtDescBuffer *src = gt_desc_buffer_new();
+    s = gt_desc_buffer_new();
+    for (i = 0; i < strlen(strs[0]); i++) {
+      gt_desc_buffer_append_char(src, strs[0][i]);
+    }
+    gt_desc_buffer_finish(src);
+    gt_desc_buffer_append_char(src, strs[1][0]);
+    gt_desc_buffer_transfer(s, src);
+    gt_ensure(gt_desc_buffer_length(src) == 0);
+    for (i = 1; i < strlen(strs[1]); i++) {
+      gt_desc_buffer_append_char(src, strs[1][i]);
+    }
+    gt_desc_buffer_finish(src);
+    gt_desc_buffer_transfer(s, src);
+    ret = gt_desc_buffer_get_next(s);
+    gt_ensure(strcmp(ret, strs[0]) == 0);
+    ret = gt_desc_buffer_get_next(s);
+    gt_ensure(strcmp(ret, strs[1]) == 0);
+    gt_ensure(gt_desc_buffer_length(s) == 8);
+    gt_ensure(gt_desc_buffer_max_length(s) == 4);
+    gt_desc_buffer_delete(src);
+    gt_desc_buffer_delete(s);
+  }
+
   return had_err;
 }
@@ -36,6 +36,9 @@ const char*   gt_desc_buffer_get_next(GtDescBuffer *db);
 /* Append character <c> to <db>. */
 void          gt_desc_buffer_append_char(GtDescBuffer *db, char c);
 void          gt_desc_buffer_finish(GtDescBuffer *db);
+/* Appends the descriptions collected in <src> to <db>, as if their
+   characters had been added to <db> directly, and empties <src>. */
+void          gt_desc_buffer_transfer(GtDescBuffer *db, GtDescBuffer *src);
 /* Reset <db> to length 0. */
 void          gt_desc_buffer_reset(GtDescBuffer *db);
 /* Returns the maximum length of any description passed through <db>. */
@@ -16,6 +16,7 @@
 */
 
 #include <limits.h>
+#include <string.h>
 #include "core/dlist.h"
 #include "core/ensure.h"
 #include "core/ma.h"
@@ -30,6 +31,7 @@ struct GtDlist {
   GtDlistelem *first,
               *last;
   void *data;
+  GtArena *arena; /* allocates the list and its elements, if set */
   GtUword size;
 };
 
@@ -55,6 +57,20 @@ GtDlist* gt_dlist_new(GtCompare cmp_func)
   return dlist;
 }
 
+GtDlist* gt_dlist_new_with_arena(GtCompare cmp_func, GtArena *arena)
+{
+  GtDlist *dlist;
+  if (!arena)
+    return gt_dlist_new(cmp_func);
+  dlist = gt_arena_alloc(arena, sizeof (GtDlist));
+  memset(dlist, 0, sizeof (GtDlist));
+  if (cmp_func != NULL)
+    dlist->cmp_func = gt_dlist_cmp_wrapper;
+  dlist->data = cmp_func;
+  dlist->arena = arena;
+  return dlist;
+}
+
 GtDlist* gt_dlist_new_with_data(GtCompareWithData cmp_func, void *data)
 {
   GtDlist *dlist = gt_calloc(1, sizeof (GtDlist));
@@ -100,7 +116,12 @@ void gt_dlist_add(GtDlist *dlist, void *data)
 {
   GtDlistelem *oldelem, *newelem;
   gt_assert(dlist); /* data can be null */
-  newelem = gt_calloc(1, sizeof (GtDlistelem));
+  if (dlist->arena) {
+    newelem = gt_arena_alloc(dlist->arena, sizeof (GtDlistelem));
+    newelem->previous = newelem->next = NULL;
+  }
+  else
+    newelem = gt_calloc(1, sizeof (GtDlistelem));
   newelem->data = data;
 
   if (!dlist->first) {
@@ -170,7 +191,9 @@ void gt_dlist_remove(GtDlist *dlist, GtDlistelem *dlistelem)
   if (dlistelem == dlist->last)
     dlist->last = dlistelem->previous;
   dlist->size--;
-  gt_free(dlistelem);
+  /* elements from an arena are reclaimed with the whole arena */
+  if (!dlist->arena)
+    gt_free(dlistelem);
 }
 
 static int intcompare(const void *a, const void *b)
@@ -366,6 +389,9 @@ void gt_dlist_delete(GtDlist *dlist)
 {
   GtDlistelem *elem;
   if (!dlist) return;
+  /* the list and its elements are reclaimed with the whole arena */
+  if (dlist->arena)
+    return;
   elem = dlist->first;
   while (elem) {
     gt_free(elem->previous);
@@ -18,10 +18,16 @@
 #ifndef DLIST_H
 #define DLIST_H
 
+#include "core/arena.h"
 #include "core/error.h"
 
 #include "core/dlist_api.h"
 
+/* Like <gt_dlist_new()>, but the list and its elements are allocated from
+   <arena>, if it is not NULL. Such a list does not hold a reference to
+   <arena>, its owner must keep the arena alive. Deleting it takes constant
+   time, the memory is reclaimed with the arena. */
+GtDlist*      gt_dlist_new_with_arena(GtCompare compar, GtArena *arena);
 int           gt_dlist_unit_test(GtError*);
 
 #endif
@@ -23,6 +23,7 @@
 #include <limits.h>
 #include <errno.h>
 #include <ctype.h>
+#include <string.h>
 #include "core/alphabet.h"
 #include "core/array.h"
 #include "core/arraydef.h"
@@ -39,6 +40,7 @@
 #include "core/encseq_access_type.h"
 #include "core/encseq_metadata.h"
 #include "core/encseq_rep.h"
+#include "core/encseq_shards.h"
 #include "core/ensure.h"
 #include "core/error.h"
 #include "core/fa.h"
@@ -54,6 +56,7 @@
 #include "core/md5_encoder_api.h"
 #include "core/minmax.h"
 #include "core/progressbar.h"
+#include "core/radix_sort.h"
 #include "core/sequence_buffer_fasta.h"
 #include "core/sequence_buffer_plain.h"
 #include "core/str.h"
@@ -210,7 +213,15 @@ void gt_encseq_sequence2bytecode(GtUchar *dest,
                                  GtUword startindex,
                                  GtUword len)
 {
-  if (encseq->sat == GT_ACCESS_TYPE_DIRECTACCESS)
+  if (encseq->volumes != NULL) {
+    GtUchar *buffer;
+
+    gt_assert(len > 0);
+    buffer = gt_malloc(sizeof (*buffer) * len);
+    gt_encseq_extract_encoded(encseq, buffer, startindex, startindex + len - 1);
+    gt_encseq_plainseq2bytecode(dest, buffer, len);
+    gt_free(buffer);
+  } else if (encseq->sat == GT_ACCESS_TYPE_DIRECTACCESS)
     gt_encseq_plainseq2bytecode(dest, encseq->plainseq + startindex, len);
   else
     encseq2bytecode(dest, encseq, startindex, len);
@@ -240,6 +251,64 @@ GtUword gt_encseq_num_of_sequences(const GtEncseq *encseq)
   return encseq->logicalnumofdbsequences;
 }
 
+/* Returns the largest volume number <volnum> such that
+   <volumestarts[volnum]> is at most <value>. */
+static GtUword gt_encseq_volume_search(const GtUword *volumestarts,
+                                       GtUword numofvolumes,
+                                       GtUword value)
+{
+  GtUword left = 0, right = numofvolumes - 1;
+
+  gt_assert(numofvolumes > 0 && volumestarts[0] <= value);
+  while (left < right) {
+    GtUword mid = left + (right - left + 1) / 2;
+
+    if (volumestarts[mid] <= value)
+      left = mid;
+    else
+      right = mid - 1;
+  }
+  return left;
+}
+
+/* Returns the number of the volume of the sharded <encseq> containing the
+   forward position <*pos> and replaces <*pos> by the corresponding position
+   in this volume. If <*pos> is the separator following the volume, it
+   becomes the total length of the volume. */
+static GtUword gt_encseq_volume_at(const GtEncseq *encseq, GtUword *pos)
+{
+  GtUword volnum;
+
+  gt_assert(encseq->volumes != NULL && *pos < encseq->totallength);
+  volnum = gt_encseq_volume_search(encseq->volumestartpos,
+                                   encseq->numofvolumes, *pos);
+  *pos -= encseq->volumestartpos[volnum];
+  return volnum;
+}
+
+/* Returns the volume of the sharded <encseq> containing position <*pos>
+   with respect to <readmode> and replaces <*pos> by the position in this
+   volume with respect to <readmode>. Returns NULL if <*pos> is a separator
+   between two volumes. */
+static const GtEncseq *gt_encseq_volume_readmode_at(const GtEncseq *encseq,
+                                                    GtUword *pos,
+                                                    GtReadmode readmode)
+{
+  const GtEncseq *volume;
+  GtUword volnum, localpos = *pos;
+
+  if (GT_ISDIRREVERSE(readmode))
+    localpos = GT_REVERSEPOS(encseq->totallength, localpos);
+  volnum = gt_encseq_volume_at(encseq, &localpos);
+  volume = encseq->volumes[volnum];
+  if (localpos == volume->totallength)
+    return NULL;
+  *pos = GT_ISDIRREVERSE(readmode)
+           ? GT_REVERSEPOS(volume->totallength, localpos)
+           : localpos;
+  return volume;
+}
+
 static GtUchar delivercharViabytecompress(const GtEncseq *encseq,
                                           GtUword pos);
 
@@ -251,6 +320,12 @@ GtUchar gt_encseq_get_encoded_char(const GtEncseq *encseq,
                                    GtReadmode readmode)
 {
   gt_assert(encseq != NULL && pos < encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    const GtEncseq *volume = gt_encseq_volume_readmode_at(encseq, &pos,
+                                                          readmode);
+    return volume != NULL ? gt_encseq_get_encoded_char(volume, pos, readmode)
+                          : (GtUchar) SEPARATOR;
+  }
   /* translate into forward coords */
   if (GT_ISDIRREVERSE(readmode)) {
     pos = GT_REVERSEPOS(encseq->logicaltotallength, pos);
@@ -336,6 +411,12 @@ char gt_encseq_get_decoded_char(const GtEncseq *encseq, GtUword pos,
   GtUchar mycc;
   gt_assert(encseq != NULL && encseq->alpha);
   gt_assert(pos < encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    const GtEncseq *volume = gt_encseq_volume_readmode_at(encseq, &pos,
+                                                          readmode);
+    return volume != NULL ? gt_encseq_get_decoded_char(volume, pos, readmode)
+                          : (char) SEPARATOR;
+  }
   mycc = gt_encseq_get_encoded_char(encseq, pos, readmode);
   if (mycc != (GtUchar) SEPARATOR) {
     if (GT_ISDIRREVERSE(readmode))
@@ -378,6 +459,13 @@ GtUchar gt_encseq_get_encoded_char_nospecial(const GtEncseq *encseq,
                                              GtReadmode readmode)
 {
   gt_assert(encseq != NULL && pos < encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    const GtEncseq *volume = gt_encseq_volume_readmode_at(encseq, &pos,
+                                                          readmode);
+    return volume != NULL
+             ? gt_encseq_get_encoded_char_nospecial(volume, pos, readmode)
+             : (GtUchar) SEPARATOR;
+  }
   /* translate into forward coords */
   if (GT_ISDIRREVERSE(readmode))
     pos = GT_REVERSEPOS(encseq->logicaltotallength, pos);
@@ -420,6 +508,12 @@ bool gt_encseq_position_is_wildcard(const GtEncseq *encseq,
                                     GtReadmode readmode)
 {
   gt_assert(encseq != NULL && pos < encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    const GtEncseq *volume = gt_encseq_volume_readmode_at(encseq, &pos,
+                                                          readmode);
+    return volume != NULL &&
+           gt_encseq_position_is_wildcard(volume, pos, readmode);
+  }
   /* translate into forward coords */
   if (GT_ISDIRREVERSE(readmode))
     pos = GT_REVERSEPOS(encseq->logicaltotallength, pos);
@@ -446,6 +540,12 @@ bool gt_encseq_position_is_separator(const GtEncseq *encseq,
                                      GtReadmode readmode)
 {
   gt_assert(encseq != NULL && pos < encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    const GtEncseq *volume = gt_encseq_volume_readmode_at(encseq, &pos,
+                                                          readmode);
+    return volume == NULL ||
+           gt_encseq_position_is_separator(volume, pos, readmode);
+  }
   /* translate into forward coords */
   if (GT_ISDIRREVERSE(readmode))
     pos = GT_REVERSEPOS(encseq->logicaltotallength, pos);
@@ -495,6 +595,8 @@ struct GtEncseqReader
   bool startedonmiddle;
   GtEncseqReaderViatablesinfo *wildcardrangestate,
                               *ssptabstate;
+  GtEncseqReader *volumereader; /* only for sharded encoded sequences */
+  GtUword volumenum;
 };
 
 typedef enum
@@ -512,11 +614,65 @@ static void binpreparenextrangeGtEncseqReader(GtEncseqReader *esr,
 static void singlepositioninseparatorViaequallength_updatestate(
                                    GtEncseqReader *esr);
 
+/* Positions the reader of the volume containing the current position of
+   <esr>, which reads a sharded encoded sequence. */
+static void gt_encseq_reader_seek_volume(GtEncseqReader *esr)
+{
+  const GtEncseq *volume;
+  GtUword localpos = esr->currentpos;
+
+  if (localpos >= esr->encseq->totallength)
+    return;
+  esr->volumenum = gt_encseq_volume_at(esr->encseq, &localpos);
+  volume = esr->encseq->volumes[esr->volumenum];
+  if (localpos < volume->totallength) {
+    if (GT_ISDIRREVERSE(esr->readmode))
+      localpos = GT_REVERSEPOS(volume->totallength, localpos);
+    if (esr->volumereader == NULL) {
+      esr->volumereader = gt_encseq_create_reader_with_readmode(volume,
+                                                                esr->readmode,
+                                                                localpos);
+    } else {
+      gt_encseq_reader_reinit_with_readmode(esr->volumereader, volume,
+                                            esr->readmode, localpos);
+    }
+  }
+}
+
+/* Moves <esr>, which reads a sharded encoded sequence, to the next position
+   after the symbol at position <localpos> of the current volume was
+   delivered. */
+static void gt_encseq_reader_advance_volume(GtEncseqReader *esr,
+                                            GtUword localpos)
+{
+  const GtEncseq *volume = esr->encseq->volumes[esr->volumenum];
+
+  if (GT_ISDIRREVERSE(esr->readmode)) {
+    esr->currentpos--;
+    if (localpos == 0 || localpos == volume->totallength)
+      gt_encseq_reader_seek_volume(esr);
+  } else {
+    esr->currentpos++;
+    if (localpos == volume->totallength)
+      gt_encseq_reader_seek_volume(esr);
+  }
+}
+
 GtUchar gt_encseq_reader_next_encoded_char(GtEncseqReader *esr)
 {
   GtUchar cc;
   gt_assert(esr->encseq
               && esr->currentpos < esr->encseq->logicaltotallength);
+  if (esr->encseq->volumes != NULL) {
+    GtUword localpos = esr->currentpos
+                       - esr->encseq->volumestartpos[esr->volumenum];
+
+    cc = localpos == esr->encseq->volumes[esr->volumenum]->totallength
+           ? (GtUchar) SEPARATOR
+           : gt_encseq_reader_next_encoded_char(esr->volumereader);
+    gt_encseq_reader_advance_volume(esr, localpos);
+    return cc;
+  }
   /* if we have mirroring enabled, we need to check whether we cross the
      boundary between real and virtual sequences, turn around if necessary */
   if (esr->encseq->hasmirror && esr->currentpos == esr->encseq->totallength) {
@@ -580,6 +736,16 @@ char gt_encseq_reader_next_decoded_char(GtEncseqReader *esr)
 {
   char cc = GT_UNDEF_CHAR;
   gt_assert(esr && esr->encseq && esr->encseq->alpha);
+  if (esr->encseq->volumes != NULL) {
+    GtUword localpos = esr->currentpos
+                       - esr->encseq->volumestartpos[esr->volumenum];
+
+    cc = localpos == esr->encseq->volumes[esr->volumenum]->totallength
+           ? (char) SEPARATOR
+           : gt_encseq_reader_next_decoded_char(esr->volumereader);
+    gt_encseq_reader_advance_volume(esr, localpos);
+    return cc;
+  }
   if (!esr->encseq->has_exceptiontable) {
     /* no lossless support available, we need to do simple decoding */
     GtUchar mycc = gt_encseq_reader_next_encoded_char(esr);
@@ -684,6 +850,32 @@ const char* gt_encseq_indexname(const GtEncseq *encseq)
     return "generated";
 }
 
+/* Returns true if the forward positions <startpos>..<endpos> of the sharded
+   <encseq> contain a special character. The volume reader of <esr> is used
+   to look into the volume. */
+static bool gt_encseq_volumes_contain_special(const GtEncseq *encseq,
+                                              GtEncseqReader *esr,
+                                              GtUword startpos,
+                                              GtUword endpos)
+{
+  GtUword localpos = startpos,
+          volnum = gt_encseq_volume_at(encseq, &localpos),
+          localend = endpos - encseq->volumestartpos[volnum];
+  const GtEncseq *volume = encseq->volumes[volnum];
+
+  /* the range contains the separator following the volume */
+  if (localend >= volume->totallength)
+    return true;
+  if (esr->volumereader == NULL) {
+    esr->volumereader = gt_encseq_create_reader_with_readmode(volume,
+                                                           GT_READMODE_FORWARD,
+                                                           localpos);
+  }
+  return gt_encseq_contains_special(volume, GT_READMODE_FORWARD,
+                                    esr->volumereader, localpos,
+                                    localend - localpos + 1);
+}
+
 /* The following function is only used in tyr-mkindex.c */
 
 bool gt_encseq_contains_special(const GtEncseq *encseq,
@@ -694,6 +886,24 @@ bool gt_encseq_contains_special(const GtEncseq *encseq,
 {
   gt_assert(len >= 1UL && encseq != NULL &&
             startpos + len <= encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    bool cspecial;
+
+    gt_assert(esr != NULL);
+    if (GT_ISDIRREVERSE(readmode)) {
+      cspecial = gt_encseq_volumes_contain_special(encseq, esr,
+                               GT_REVERSEPOS(encseq->totallength,
+                                             startpos + len - 1),
+                               GT_REVERSEPOS(encseq->totallength, startpos));
+    } else {
+      cspecial = gt_encseq_volumes_contain_special(encseq, esr, startpos,
+                                                   startpos + len - 1);
+    }
+    /* the volume reader was moved, so position <esr> like for the other
+       representations */
+    gt_encseq_reader_reinit_with_readmode(esr, encseq, readmode, startpos);
+    return cspecial;
+  }
   if (encseq->hasmirror) {
     if (startpos > encseq->totallength) {
       gt_readmode_invert(readmode);
@@ -716,6 +926,58 @@ static void showGtRange(const GtRange *range)
 }
 #endif
 
+static bool fwdextractencodedbulk_possible(const GtEncseq *encseq,
+                                           GtUword topos);
+
+static bool fwdextractencodedbulk_needsreader(const GtEncseq *encseq);
+
+static void fwdextractencodedbulk(GtEncseqReader *esr,
+                                  const GtEncseq *encseq,
+                                  GtUchar *buffer,
+                                  GtUword frompos,
+                                  GtUword topos);
+
+static void decodeextractedbuffer(const GtEncseq *encseq,
+                                  char *buffer,
+                                  GtUword len);
+
+/* Extracts the positions <frompos>..<topos> of the sharded <encseq> into
+   <encbuffer> if it is not NULL and decoded into <decbuffer> otherwise,
+   extracting the part of each volume with a single call. */
+static void gt_encseq_extract_volumes(const GtEncseq *encseq,
+                                      GtUchar *encbuffer,
+                                      char *decbuffer,
+                                      GtUword frompos,
+                                      GtUword topos)
+{
+  GtUword pos = frompos, localpos = frompos,
+          volnum = gt_encseq_volume_at(encseq, &localpos);
+
+  while (pos <= topos) {
+    const GtEncseq *volume = encseq->volumes[volnum];
+    GtUword idx = pos - frompos;
+
+    if (localpos == volume->totallength) {
+      if (encbuffer != NULL)
+        encbuffer[idx] = (GtUchar) SEPARATOR;
+      else
+        decbuffer[idx] = (char) SEPARATOR;
+      pos++;
+      volnum++;
+    } else {
+      GtUword localend = MIN(topos - encseq->volumestartpos[volnum],
+                             volume->totallength - 1);
+
+      if (encbuffer != NULL)
+        gt_encseq_extract_encoded(volume, encbuffer + idx, localpos, localend);
+      else
+        gt_encseq_extract_decoded(volume, decbuffer + idx, localpos, localend);
+      pos += localend - localpos + 1;
+    }
+    localpos = pos - encseq->volumestartpos[volnum];
+  }
+}
+
 void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
                                const GtEncseq *encseq,
                                GtUchar *buffer,
@@ -726,8 +988,16 @@ void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
+  if (encseq->volumes != NULL) {
+    gt_encseq_extract_volumes(encseq, buffer, NULL, frompos, topos);
+    return;
+  }
   gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
                                         frompos);
+  if (fwdextractencodedbulk_possible(encseq, topos)) {
+    fwdextractencodedbulk(esr, encseq, buffer, frompos, topos);
+    return;
+  }
   for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
     buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
   }
@@ -743,11 +1013,24 @@ void gt_encseq_extract_encoded(const GtEncseq *encseq,
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
+  if (encseq->volumes != NULL) {
+    gt_encseq_extract_volumes(encseq, buffer, NULL, frompos, topos);
+    return;
+  }
+  if (fwdextractencodedbulk_possible(encseq, topos) &&
+      !fwdextractencodedbulk_needsreader(encseq)) {
+    fwdextractencodedbulk(NULL, encseq, buffer, frompos, topos);
+    return;
+  }
   esr = gt_encseq_create_reader_with_readmode(encseq,
                                               GT_READMODE_FORWARD,
                                               frompos);
-  for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
-    buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
+  if (fwdextractencodedbulk_possible(encseq, topos)) {
+    fwdextractencodedbulk(esr, encseq, buffer, frompos, topos);
+  } else {
+    for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
+      buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
+    }
   }
   gt_encseq_reader_delete(esr);
 }
@@ -762,8 +1045,18 @@ void gt_encseq_extract_decoded_with_reader(GtEncseqReader *esr,
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
+  if (encseq->volumes != NULL) {
+    gt_encseq_extract_volumes(encseq, NULL, buffer, frompos, topos);
+    return;
+  }
   gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
                                         frompos);
+  if (!encseq->has_exceptiontable &&
+      fwdextractencodedbulk_possible(encseq, topos)) {
+    fwdextractencodedbulk(esr, encseq, (GtUchar *) buffer, frompos, topos);
+    decodeextractedbuffer(encseq, buffer, topos - frompos + 1);
+    return;
+  }
   for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
     buffer[idx] = gt_encseq_reader_next_decoded_char(esr);
   }
@@ -779,11 +1072,28 @@ void gt_encseq_extract_decoded(const GtEncseq *encseq,
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
+  if (encseq->volumes != NULL) {
+    gt_encseq_extract_volumes(encseq, NULL, buffer, frompos, topos);
+    return;
+  }
+  if (!encseq->has_exceptiontable &&
+      fwdextractencodedbulk_possible(encseq, topos) &&
+      !fwdextractencodedbulk_needsreader(encseq)) {
+    fwdextractencodedbulk(NULL, encseq, (GtUchar *) buffer, frompos, topos);
+    decodeextractedbuffer(encseq, buffer, topos - frompos + 1);
+    return;
+  }
   esr = gt_encseq_create_reader_with_readmode(encseq,
                                               GT_READMODE_FORWARD,
                                               frompos);
-  for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
-    buffer[idx] = gt_encseq_reader_next_decoded_char(esr);
+  if (!encseq->has_exceptiontable &&
+      fwdextractencodedbulk_possible(encseq, topos)) {
+    fwdextractencodedbulk(esr, encseq, (GtUchar *) buffer, frompos, topos);
+    decodeextractedbuffer(encseq, buffer, topos - frompos + 1);
+  } else {
+    for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
+      buffer[idx] = gt_encseq_reader_next_decoded_char(esr);
+    }
   }
   gt_encseq_reader_delete(esr);
 }
@@ -791,6 +1101,8 @@ void gt_encseq_extract_decoded(const GtEncseq *encseq,
 const char* gt_encseq_accessname(const GtEncseq *encseq)
 {
   gt_assert(encseq != NULL);
+  if (encseq->volumes != NULL)
+    return encseq->satname;
   return gt_encseq_access_type_str(encseq->sat);
 }
 
@@ -816,6 +1128,10 @@ static int getsatforcevalue(const char *str, GtError *err)
 bool gt_encseq_has_twobitencoding(const GtEncseq *encseq)
 {
   gt_assert(encseq != NULL);
+  /* the volumes of a sharded encoded sequence keep their own tables, so
+     there is no two bit encoding to export */
+  if (encseq->volumes != NULL)
+    return false;
   return (encseq->accesstype_via_utables ||
           encseq->sat >= GT_ACCESS_TYPE_EQUALLENGTH ||
           encseq->sat == GT_ACCESS_TYPE_BITACCESS) ? true : false;
@@ -823,7 +1139,18 @@ bool gt_encseq_has_twobitencoding(const GtEncseq *encseq)
 
 bool gt_encseq_has_twobitencoding_stoppos_support(const GtEncseq *encseq)
 {
-  gt_assert(encseq != NULL && encseq->sat != GT_ACCESS_TYPE_UNDEFINED);
+  gt_assert(encseq != NULL);
+  if (encseq->volumes != NULL) {
+    GtUword volnum;
+
+    for (volnum = 0; volnum < encseq->numofvolumes; volnum++) {
+      if (!gt_encseq_has_twobitencoding_stoppos_support(
+                                                      encseq->volumes[volnum]))
+        return false;
+    }
+    return true;
+  }
+  gt_assert(encseq->sat != GT_ACCESS_TYPE_UNDEFINED);
   return (encseq->accesstype_via_utables ||
           encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH) ? true : false;
 }
@@ -1655,6 +1982,8 @@ static int fillencseqmapspecstartptr(GtEncseq *encseq,
     haserr = true;
   }
   if (!haserr) {
+    gt_fa_mmap_apply_policy_for_suffix(encseq->mappedptr, GT_ENCSEQFILESUFFIX,
+                                       GT_FA_MAP_NORMAL);
     encseq->totallength = *encseq->headerptr.totallengthptr;
     encseq->logicaltotallength = encseq->totallength;
     encseq->numofdbsequences = *encseq->headerptr.numofdbsequencesptr;
@@ -1943,6 +2272,17 @@ void gt_encseq_delete(GtEncseq *encseq)
     gt_mutex_unlock(encseq->refcount_lock);
     return;
   }
+  if (encseq->volumes != NULL) {
+    GtUword volnum;
+
+    for (volnum = 0; volnum < encseq->numofvolumes; volnum++)
+      gt_encseq_delete(encseq->volumes[volnum]);
+    gt_free(encseq->volumes);
+    gt_free(encseq->volumestartpos);
+    gt_free(encseq->volumefirstseqnum);
+    gt_free(encseq->volumefirstfilenum);
+    encseq->volumes = NULL;
+  }
   if (encseq->mappedptr != NULL) {
     if (encseq->bitpackarray != NULL) {
       /* store points to some subarea of the region mapped by mappedptr:
@@ -3052,6 +3392,13 @@ void gt_encseq_reader_reinit_with_readmode(GtEncseqReader *esr,
   if (GT_ISDIRREVERSE(readmode))
     startpos = GT_REVERSEPOS(encseq->logicaltotallength, startpos);
   esr->originalreadmode = readmode;
+  if (encseq->volumes != NULL) {
+    gt_assert(startpos <= encseq->totallength);
+    esr->readmode = readmode;
+    esr->currentpos = startpos;
+    gt_encseq_reader_seek_volume(esr);
+    return;
+  }
 
   /* if inside virtual mirror sequence, adjust start position and reading
      direction */
@@ -3172,6 +3519,7 @@ void gt_encseq_reader_delete(GtEncseqReader *esr)
    gt_free(esr->wildcardrangestate);
   if (esr->ssptabstate != NULL)
     gt_free(esr->ssptabstate);
+  gt_encseq_reader_delete(esr->volumereader);
   gt_free(esr);
 }
 
@@ -3196,6 +3544,16 @@ static GtUword gt_encseq_seqstartpos_viautables(const GtEncseq *encseq,
 
 GtUword *gt_all_sequence_separators_get(const GtEncseq *encseq)
 {
+  if (encseq->volumes != NULL) {
+    GtUword seqnum, *ssptab;
+
+    if (encseq->numofdbsequences == 1UL)
+      return NULL;
+    ssptab = gt_malloc(sizeof (*ssptab) * (encseq->numofdbsequences - 1));
+    for (seqnum = 1UL; seqnum < encseq->numofdbsequences; seqnum++)
+      ssptab[seqnum - 1] = gt_encseq_seqstartpos(encseq, seqnum) - 1;
+    return ssptab;
+  }
   switch (encseq->satsep) {
     case GT_ACCESS_TYPE_UCHARTABLES:
       return gt_all_ssps_get_uchar(&encseq->ssptab.st_uchar);
@@ -3298,7 +3656,8 @@ bool gt_encseq_has_wildcardranges(const GtEncseq *encseq)
 
 bool gt_encseq_bitwise_cmp_ok(const GtEncseq *encseq)
 {
-  return (encseq->sat == GT_ACCESS_TYPE_DIRECTACCESS ||
+  return (encseq->volumes != NULL ||
+          encseq->sat == GT_ACCESS_TYPE_DIRECTACCESS ||
           encseq->sat == GT_ACCESS_TYPE_BYTECOMPRESS) ? false : true;
 }
 
@@ -3318,6 +3677,9 @@ struct GtSpecialrangeiterator
                 jumppos; /* position jumping along the sequence to find the
                             special ranges, only need when
                             !encseq->accesstype_via_utables */
+  /* for a sharded encoded sequence: the iterator over the current volume */
+  GtSpecialrangeiterator *volumesri;
+  GtUword volumenum;
 };
 
 void gt_specialrangeiterator_reinit_with_startpos(GtSpecialrangeiterator *sri,
@@ -3345,6 +3707,19 @@ void gt_specialrangeiterator_reinit_with_startpos(GtSpecialrangeiterator *sri,
   /* the reader initialization may have changed the direction! so reevaluate. */
   sri->moveforward = !GT_ISDIRREVERSE(sri->esr->readmode);
 
+  if (encseq->volumes != NULL) {
+    const GtEncseq *volume;
+
+    gt_assert(startpos == 0);
+    sri->volumenum = sri->moveforward ? 0 : encseq->numofvolumes - 1;
+    volume = encseq->volumes[sri->volumenum];
+    gt_specialrangeiterator_delete(sri->volumesri);
+    sri->volumesri = gt_encseq_has_specialranges(volume)
+                       ? gt_specialrangeiterator_new(volume, sri->moveforward)
+                       : NULL;
+    return;
+  }
+
   if (sri->esr->readmode == GT_READMODE_COMPL)
     sri->esr->readmode = GT_READMODE_FORWARD;
   if (sri->esr->readmode == GT_READMODE_REVCOMPL)
@@ -3381,6 +3756,7 @@ GtSpecialrangeiterator* gt_specialrangeiterator_new(const GtEncseq *encseq,
               || (encseq->hasmirror && encseq->logicalnumofdbsequences == 2UL));
   sri = gt_malloc(sizeof (*sri));
   sri->esr = NULL;
+  sri->volumesri = NULL;
   sri->originalmoveforward = moveforward;
   gt_specialrangeiterator_reinit(sri, encseq, moveforward);
   sri->reflected = false;
@@ -3734,10 +4110,74 @@ static inline void gt_specialrangeiterator_invert_range(GtEncseq *encseq,
   }
 }
 
+/* Delivers the special ranges of the volumes of a sharded encoded sequence
+   and the separators between them, without merging adjacent ranges. */
+static bool gt_volumes_specialrangeiterator_next_unmerged(
+                                                   GtSpecialrangeiterator *sri,
+                                                   GtRange *range)
+{
+  const GtEncseq *encseq = sri->esr->encseq, *volume;
+  GtUword volnum = sri->volumenum;
+
+  if (sri->volumesri != NULL &&
+      gt_specialrangeiterator_next(sri->volumesri, range)) {
+    range->start += encseq->volumestartpos[volnum];
+    range->end += encseq->volumestartpos[volnum];
+    return true;
+  }
+  if (sri->moveforward ? volnum + 1 == encseq->numofvolumes : volnum == 0)
+    return false;
+  /* the separator to the next volume */
+  if (sri->moveforward) {
+    range->start = encseq->volumestartpos[volnum]
+                   + encseq->volumes[volnum]->totallength;
+    sri->volumenum++;
+  } else {
+    range->start = encseq->volumestartpos[volnum] - 1;
+    sri->volumenum--;
+  }
+  range->end = range->start + 1;
+  volume = encseq->volumes[sri->volumenum];
+  gt_specialrangeiterator_delete(sri->volumesri);
+  sri->volumesri = gt_encseq_has_specialranges(volume)
+                     ? gt_specialrangeiterator_new(volume, sri->moveforward)
+                     : NULL;
+  return true;
+}
+
+static bool gt_volumes_specialrangeiterator_next(GtSpecialrangeiterator *sri,
+                                                 GtRange *range)
+{
+  GtRange next;
+
+  if (!sri->queued.defined &&
+      !gt_volumes_specialrangeiterator_next_unmerged(sri, &sri->queued.rng))
+    return false;
+  *range = sri->queued.rng;
+  sri->queued.defined = false;
+  /* a range at the border of a volume continues with the separator and
+     possibly with a range at the border of the next volume */
+  while (gt_volumes_specialrangeiterator_next_unmerged(sri, &next)) {
+    if (sri->moveforward && next.start == range->end)
+      range->end = next.end;
+    else if (!sri->moveforward && next.end == range->start)
+      range->start = next.start;
+    else {
+      sri->queued.rng = next;
+      sri->queued.defined = true;
+      break;
+    }
+  }
+  return true;
+}
+
 bool gt_specialrangeiterator_next(GtSpecialrangeiterator *sri, GtRange *range)
 {
   bool retval;
 
+  if (sri->esr->encseq->volumes != NULL)
+    return gt_volumes_specialrangeiterator_next(sri, range);
+
   /* handle special case where only one sequence is mirrored w/o wildcards  */
   if (sri->esr->encseq->hasmirror
         && !sri->esr->encseq->has_specialranges
@@ -3811,6 +4251,7 @@ void gt_specialrangeiterator_delete(GtSpecialrangeiterator *sri)
 {
   if (sri != NULL) {
     gt_encseq_reader_delete(sri->esr);
+    gt_specialrangeiterator_delete(sri->volumesri);
     gt_free(sri);
   }
 }
@@ -3902,6 +4343,8 @@ GtUword gt_encseq_seqnum_ssptab(const GtEncseq *encseq,
                                          GtUword position)
 {
   gt_assert(position < encseq->totallength);
+  if (encseq->volumes != NULL)
+    return gt_encseq_seqnum(encseq, position);
   switch (encseq->satsep) {
     case GT_ACCESS_TYPE_UCHARTABLES:
       return gt_encseq_seqnum_uchar(&encseq->ssptab.st_uchar,position);
@@ -3920,6 +4363,16 @@ GtUword gt_encseq_seqnum(const GtEncseq *encseq,
 {
   GtUword num;
   bool wasmirrored = false;
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_at(encseq, &position);
+    const GtEncseq *volume = encseq->volumes[volnum];
+
+    /* a separator between two volumes belongs to the preceding sequence */
+    return encseq->volumefirstseqnum[volnum]
+           + (position == volume->totallength
+                ? volume->numofdbsequences - 1
+                : gt_encseq_seqnum(volume, position));
+  }
   if (encseq->hasmirror && position >= encseq->totallength) {
     position = encseq->logicaltotallength - 1 - position;
     wasmirrored = true;
@@ -3948,6 +4401,13 @@ GtUword gt_encseq_seqstartpos(const GtEncseq *encseq,
   GtUword pos;
   bool wasmirrored = false;
   gt_assert(encseq != NULL && seqnum < encseq->logicalnumofdbsequences);
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_search(encseq->volumefirstseqnum,
+                                             encseq->numofvolumes, seqnum);
+    return encseq->volumestartpos[volnum]
+           + gt_encseq_seqstartpos(encseq->volumes[volnum],
+                                   seqnum - encseq->volumefirstseqnum[volnum]);
+  }
   if (encseq->hasmirror && seqnum >= encseq->numofdbsequences) {
     seqnum = encseq->logicalnumofdbsequences - 1 - seqnum;
     wasmirrored = true;
@@ -3990,6 +4450,12 @@ GtUword gt_encseq_seqstartpos(const GtEncseq *encseq,
 GtUword gt_encseq_seqlength(const GtEncseq *encseq, GtUword seqnum)
 {
   gt_assert(encseq != NULL && seqnum < encseq->logicalnumofdbsequences);
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_search(encseq->volumefirstseqnum,
+                                             encseq->numofvolumes, seqnum);
+    return gt_encseq_seqlength(encseq->volumes[volnum],
+                               seqnum - encseq->volumefirstseqnum[volnum]);
+  }
   if (encseq->hasmirror && seqnum >= encseq->numofdbsequences) {
     seqnum = GT_REVERSEPOS(encseq->logicalnumofdbsequences, seqnum);
   }
@@ -4014,6 +4480,155 @@ GtUword gt_encseq_seqlength(const GtEncseq *encseq, GtUword seqnum)
     return encseq->equallength.valueunsignedlong;
 }
 
+void gt_encseq_seqnum_batch(const GtEncseq *encseq,
+                            GtUword *seqnums,
+                            GtUword *relpositions,
+                            const GtUword *positions,
+                            GtUword numofpositions)
+{
+  GtUword idx;
+
+  gt_assert(encseq != NULL && seqnums != NULL && positions != NULL);
+  if (numofpositions <= 1UL || encseq->hasmirror || encseq->volumes != NULL ||
+      encseq->numofdbsequences == 1UL ||
+      encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH) {
+    /* the lookup is cheap, the sequences do not partition the positions
+       into consecutive intervals or the tables are those of the volumes */
+    for (idx = 0; idx < numofpositions; idx++) {
+      GtUword pos = positions[idx],
+              seqnum = gt_encseq_seqnum(encseq, pos);
+
+      seqnums[idx] = seqnum;
+      if (relpositions != NULL) {
+        relpositions[idx] = pos - gt_encseq_seqstartpos(encseq, seqnum);
+      }
+    }
+  } else {
+    GtUwordPair *sortedpositions;
+    GtUword seqnum = 0, seqstartpos = 0, nextseqstartpos = 0;
+    bool sorted = true;
+
+    sortedpositions = gt_malloc(sizeof (*sortedpositions) * numofpositions);
+    for (idx = 0; idx < numofpositions; idx++) {
+      sortedpositions[idx].a = positions[idx];
+      sortedpositions[idx].b = idx;
+      if (idx > 0 && positions[idx-1] > positions[idx]) {
+        sorted = false;
+      }
+    }
+    if (!sorted) {
+      gt_radixsort_inplace_GtUwordPair(sortedpositions, numofpositions);
+    }
+    /* each sequence is looked up only once for all positions it contains */
+    for (idx = 0; idx < numofpositions; idx++) {
+      GtUword pos = sortedpositions[idx].a;
+
+      gt_assert(pos < encseq->totallength);
+      if (idx == 0 || pos >= nextseqstartpos) {
+        seqnum = gt_encseq_seqnum_ssptab(encseq, pos);
+        seqstartpos = gt_encseq_seqstartpos_viautables(encseq, seqnum);
+        nextseqstartpos = (seqnum + 1 < encseq->numofdbsequences)
+                            ? gt_encseq_seqstartpos_viautables(encseq,
+                                                               seqnum + 1)
+                            : encseq->totallength;
+      }
+      seqnums[sortedpositions[idx].b] = seqnum;
+      if (relpositions != NULL) {
+        relpositions[sortedpositions[idx].b] = pos - seqstartpos;
+      }
+    }
+    gt_free(sortedpositions);
+  }
+}
+
+void gt_encseq_seqstartpos_batch(const GtEncseq *encseq,
+                                 GtUword *seqstartpositions,
+                                 const GtUword *seqnums,
+                                 GtUword numofseqnums)
+{
+  GtUword idx;
+
+  gt_assert(encseq != NULL && seqstartpositions != NULL && seqnums != NULL);
+  if (numofseqnums <= 1UL || encseq->hasmirror || encseq->volumes != NULL ||
+      encseq->numofdbsequences == 1UL ||
+      encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH) {
+    for (idx = 0; idx < numofseqnums; idx++) {
+      seqstartpositions[idx] = gt_encseq_seqstartpos(encseq, seqnums[idx]);
+    }
+  } else {
+    GtUwordPair *sortedseqnums;
+    GtUword seqnum = 0, seqstartpos = 0;
+    bool sorted = true;
+
+    sortedseqnums = gt_malloc(sizeof (*sortedseqnums) * numofseqnums);
+    for (idx = 0; idx < numofseqnums; idx++) {
+      sortedseqnums[idx].a = seqnums[idx];
+      sortedseqnums[idx].b = idx;
+      if (idx > 0 && seqnums[idx-1] > seqnums[idx]) {
+        sorted = false;
+      }
+    }
+    if (!sorted) {
+      gt_radixsort_inplace_GtUwordPair(sortedseqnums, numofseqnums);
+    }
+    for (idx = 0; idx < numofseqnums; idx++) {
+      if (idx == 0 || sortedseqnums[idx].a != seqnum) {
+        seqnum = sortedseqnums[idx].a;
+        gt_assert(seqnum < encseq->numofdbsequences);
+        seqstartpos = gt_encseq_seqstartpos_viautables(encseq, seqnum);
+      }
+      seqstartpositions[sortedseqnums[idx].b] = seqstartpos;
+    }
+    gt_free(sortedseqnums);
+  }
+}
+
+#define GT_ENCSEQ_PREFETCHDISTANCE 8UL
+
+static inline void gt_encseq_prefetch_char(GT_UNUSED const GtEncseq *encseq,
+                                           GT_UNUSED GtUword pos,
+                                           GT_UNUSED GtReadmode readmode)
+{
+#ifdef __GNUC__
+  if (!encseq->hasmirror) {
+    if (GT_ISDIRREVERSE(readmode)) {
+      pos = GT_REVERSEPOS(encseq->totallength, pos);
+    }
+    if (encseq->twobitencoding != NULL) {
+      __builtin_prefetch(encseq->twobitencoding +
+                         GT_DIVBYUNITSIN2BITENC(pos), 0, 1);
+    } else {
+      if (encseq->sat == GT_ACCESS_TYPE_DIRECTACCESS) {
+        __builtin_prefetch(encseq->plainseq + pos, 0, 1);
+      }
+    }
+  }
+#endif
+}
+
+void gt_encseq_get_encoded_char_batch(const GtEncseq *encseq,
+                                      GtUchar *chars,
+                                      const GtUword *positions,
+                                      GtUword numofpositions,
+                                      GtReadmode readmode)
+{
+  GtUword idx;
+
+  gt_assert(encseq != NULL && chars != NULL && positions != NULL);
+  for (idx = 0; idx < MIN(numofpositions, GT_ENCSEQ_PREFETCHDISTANCE);
+       idx++) {
+    gt_encseq_prefetch_char(encseq, positions[idx], readmode);
+  }
+  for (idx = 0; idx < numofpositions; idx++) {
+    if (idx + GT_ENCSEQ_PREFETCHDISTANCE < numofpositions) {
+      gt_encseq_prefetch_char(encseq,
+                              positions[idx + GT_ENCSEQ_PREFETCHDISTANCE],
+                              readmode);
+    }
+    chars[idx] = gt_encseq_get_encoded_char(encseq, positions[idx], readmode);
+  }
+}
+
 void gt_encseq_check_markpos(const GtEncseq *encseq)
 {
   if (encseq->numofdbsequences > 1UL) {
@@ -4130,6 +4745,8 @@ static GtEncseq *determineencseqkeyvalues(GtEncseqAccessType sat,
   encseq->fsptab = NULL;
   encseq->md5_tab = NULL;
   encseq->hasallocatedssptab = false;
+  encseq->volumes = NULL;
+  encseq->numofvolumes = 0;
   if (equallength == NULL) {
     encseq->equallength.defined = false;
     encseq->equallength.valueunsignedlong = 0;
@@ -4628,6 +5245,7 @@ static GtEncseq *files2encodedsequence(const GtStrArray *filenametab,
                            true);
     }
     gt_sequence_buffer_set_symbolmap(fb, gt_alphabet_symbolmap(alphabet));
+    gt_sequence_buffer_enable_readahead(fb);
     if (encodedseqfunctab[(int) sat].fillposition.function(encseq,
                                                            ssptaboutinfo,
                                                            fb, err) != 0)
@@ -4819,7 +5437,14 @@ const char* gt_encseq_description(const GtEncseq *encseq,
 {
   GtUword destablen;
 
-  gt_assert(encseq != NULL && encseq->destab != NULL);
+  gt_assert(encseq != NULL);
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_search(encseq->volumefirstseqnum,
+                                             encseq->numofvolumes, seqnum);
+    return gt_encseq_description(encseq->volumes[volnum], desclen,
+                                 seqnum - encseq->volumefirstseqnum[volnum]);
+  }
+  gt_assert(encseq->destab != NULL);
   if (encseq->destab[encseq->destablength - 1] == '\n') {
     destablen = encseq->destablength;
   } else {
@@ -4854,7 +5479,18 @@ const char* gt_encseq_description(const GtEncseq *encseq,
 
 GtUword gt_encseq_max_desc_length(const GtEncseq *encseq)
 {
-  gt_assert(encseq && encseq->destab);
+  gt_assert(encseq);
+  if (encseq->volumes != NULL) {
+    GtUword volnum, maxlen = 0;
+
+    for (volnum = 0; volnum < encseq->numofvolumes; volnum++) {
+      GtUword len = gt_encseq_max_desc_length(encseq->volumes[volnum]);
+      if (len > maxlen)
+        maxlen = len;
+    }
+    return maxlen;
+  }
+  gt_assert(encseq->destab);
   /* decides whether destab contains max desc length as a separate field */
   if (encseq->destab[encseq->destablength - 1] == '\n') {
     GtUword i,
@@ -4886,6 +5522,13 @@ void gt_encseq_check_descriptions(const GtEncseq *encseq)
   char *copydestab;
 
   gt_assert(encseq != NULL);
+  if (encseq->volumes != NULL) {
+    GtUword volnum;
+
+    for (volnum = 0; volnum < encseq->numofvolumes; volnum++)
+      gt_encseq_check_descriptions(encseq->volumes[volnum]);
+    return;
+  }
   totaldesclength = encseq->numofdbsequences; /* for each new line */
   for (seqnum = 0; seqnum < encseq->numofdbsequences; seqnum++) {
     (void) gt_encseq_description(encseq, &desclen, seqnum);
@@ -4942,17 +5585,39 @@ void gt_encseq_check_startpositions(const GtEncseq *encseq, GtLogger *logger)
 
 bool gt_encseq_has_multiseq_support(const GtEncseq *encseq)
 {
-  bool ret =  encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH ||
-              encseq->has_ssptab ||
-              encseq->accesstype_via_utables;
+  bool ret;
+  if (encseq->volumes != NULL) {
+    GtUword volnum;
+
+    /* a volume with a single sequence needs no tables to map positions */
+    for (volnum = 0; volnum < encseq->numofvolumes; volnum++) {
+      if (encseq->volumes[volnum]->numofdbsequences > 1UL &&
+          !gt_encseq_has_multiseq_support(encseq->volumes[volnum]))
+        return false;
+    }
+    return true;
+  }
+  ret = encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH ||
+        encseq->has_ssptab ||
+        encseq->accesstype_via_utables;
   return ret;
 }
 
 bool gt_encseq_has_description_support(const GtEncseq *encseq)
 {
-  bool ret = (encseq->destab != NULL
-                && (encseq->numofdbsequences == 1UL
-                      || encseq->sdstab != NULL));
+  bool ret;
+  if (encseq->volumes != NULL) {
+    GtUword volnum;
+
+    for (volnum = 0; volnum < encseq->numofvolumes; volnum++) {
+      if (!gt_encseq_has_description_support(encseq->volumes[volnum]))
+        return false;
+    }
+    return true;
+  }
+  ret = (encseq->destab != NULL
+           && (encseq->numofdbsequences == 1UL
+                 || encseq->sdstab != NULL));
   return ret;
 }
 
@@ -5383,6 +6048,7 @@ static int countnumberofexceptionranges(const GtAlphabet *alpha,
     GtUchar charcode;
 
     gt_sequence_buffer_set_symbolmap(fb, gt_alphabet_symbolmap(alpha));
+    gt_sequence_buffer_enable_readahead(fb);
     for (currentpos = 0; /* Nothing */; currentpos++) {
       retval = gt_sequence_buffer_next_with_original(fb, &charcode, &cc, err);
       if (retval > 0) {
@@ -5516,6 +6182,7 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
     if (descqueue != NULL)
       gt_sequence_buffer_set_desc_buffer(fb, descqueue);
     gt_sequence_buffer_set_chardisttab(fb, characterdistribution);
+    gt_sequence_buffer_enable_readahead(fb);
     distspecialrangelength = gt_disc_distri_new();
     distwildcardrangelength = gt_disc_distri_new();
     originaldistribution = gt_calloc((size_t) UCHAR_MAX,
@@ -6059,6 +6726,157 @@ static GtUword fwdgetnexttwobitencodingstoppos(GtEncseqReader *esr)
   }
 }
 
+/* Unpack the two-bit codes of positions <frompos>,...,<endpos>-1 into
+   <buffer>. Whole units are handled with a loop of constant trip count,
+   which the compiler unrolls and vectorises. */
+static void fwdunpacktwobitencoding(GtUchar *buffer,
+                                    const GtTwobitencoding *tbe,
+                                    GtUword frompos,
+                                    GtUword endpos)
+{
+  GtUword pos = frompos;
+
+  while (pos < endpos && GT_MODBYUNITSIN2BITENC(pos) > 0) {
+    *buffer++ = (GtUchar) EXTRACTENCODEDCHAR(tbe, pos);
+    pos++;
+  }
+  tbe += GT_DIVBYUNITSIN2BITENC(pos);
+  while (pos + (GtUword) GT_UNITSIN2BITENC <= endpos) {
+    const GtTwobitencoding unit = *tbe++;
+    int idx;
+
+    for (idx = 0; idx < GT_UNITSIN2BITENC; idx++) {
+      buffer[idx] = (GtUchar) EXTRACTENCODEDCHARSCALARFROMLEFT(unit, idx);
+    }
+    buffer += GT_UNITSIN2BITENC;
+    pos += GT_UNITSIN2BITENC;
+  }
+  if (pos < endpos) {
+    const GtTwobitencoding unit = *tbe;
+    int idx;
+
+    for (idx = 0; pos < endpos; idx++, pos++) {
+      *buffer++ = (GtUchar) EXTRACTENCODEDCHARSCALARFROMLEFT(unit, idx);
+    }
+  }
+}
+
+/* Return the smallest special position in the range from <pos> to
+   <endpos>-1 of an encoded sequence with access type bitaccess, or <endpos>
+   if there is none. */
+static GtUword fwdnextspecialposViabitaccess(const GtEncseq *encseq,
+                                             GtUword pos,
+                                             GtUword endpos)
+{
+  while (pos < endpos) {
+    GtBitsequence spbits = encseq->specialbits[GT_DIVWORDSIZE(pos)]
+                           << GT_MODWORDSIZE(pos);
+
+    if (spbits != 0) {
+      pos += (GtUword) (GT_INTWORDSIZE - requiredUIntBits(spbits));
+      return MIN(pos, endpos);
+    }
+    pos += (GtUword) (GT_INTWORDSIZE - GT_MODWORDSIZE(pos));
+  }
+  return endpos;
+}
+
+static bool fwdextractencodedbulk_possible(const GtEncseq *encseq,
+                                           GtUword topos)
+{
+  return topos < encseq->totallength &&
+         encseq->sat != GT_ACCESS_TYPE_BYTECOMPRESS;
+}
+
+static bool fwdextractencodedbulk_needsreader(const GtEncseq *encseq)
+{
+  return encseq->has_specialranges &&
+         (encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH ||
+          encseq->accesstype_via_utables);
+}
+
+/* Extract the encoded characters of positions <frompos>,...,<topos> by
+   unpacking the two-bit encoding between two special positions in one go,
+   instead of looking up the special ranges once for every position. For
+   the access types equallength and ..tables, <esr> must have been
+   initialized for forward reading at <frompos>. */
+static void fwdextractencodedbulk(GtEncseqReader *esr,
+                                  const GtEncseq *encseq,
+                                  GtUchar *buffer,
+                                  GtUword frompos,
+                                  GtUword topos)
+{
+  GtUword pos = frompos, endpos = topos + 1, stoppos;
+
+  gt_assert(fwdextractencodedbulk_possible(encseq, topos));
+  if (encseq->sat == GT_ACCESS_TYPE_DIRECTACCESS) {
+    memcpy(buffer, encseq->plainseq + frompos,
+           sizeof (*buffer) * (size_t) (endpos - frompos));
+    return;
+  }
+  if (!encseq->has_specialranges) {
+    fwdunpacktwobitencoding(buffer, encseq->twobitencoding, frompos, endpos);
+    return;
+  }
+  while (pos < endpos) {
+    if (encseq->sat == GT_ACCESS_TYPE_BITACCESS) {
+      stoppos = fwdnextspecialposViabitaccess(encseq, pos, endpos);
+    } else {
+      gt_assert(esr != NULL && esr->encseq == encseq);
+      esr->currentpos = pos;
+      stoppos = MIN(fwdgetnexttwobitencodingstoppos(esr), endpos);
+    }
+    if (pos < stoppos) {
+      fwdunpacktwobitencoding(buffer + (pos - frompos),
+                              encseq->twobitencoding, pos, stoppos);
+      pos = stoppos;
+    } else {
+      /* the reader state of equallength and ..tables must see every special
+         position in order, so deliver it via the reader */
+      if (encseq->sat == GT_ACCESS_TYPE_BITACCESS) {
+        GtUword twobits = EXTRACTENCODEDCHAR(encseq->twobitencoding, pos);
+
+        gt_assert(GT_ISIBITSET(encseq->specialbits, pos));
+        if (twobits > 1UL) {
+          buffer[pos - frompos] = (GtUchar) twobits;
+        } else {
+          buffer[pos - frompos]
+            = (twobits == (GtUword) GT_TWOBITS_FOR_SEPARATOR)
+                ? (GtUchar) SEPARATOR
+                : (GtUchar) WILDCARD;
+        }
+      } else {
+        esr->currentpos = pos;
+        buffer[pos - frompos] = encseq->seqdeliverchar(esr);
+      }
+      pos++;
+    }
+  }
+  if (esr != NULL) {
+    esr->currentpos = endpos;
+  }
+}
+
+static void decodeextractedbuffer(const GtEncseq *encseq,
+                                  char *buffer,
+                                  GtUword len)
+{
+  char decodetab[UCHAR_MAX+1];
+  const GtUchar *encoded = (const GtUchar *) buffer;
+  unsigned int idx, mapsize = gt_alphabet_size(encseq->alpha);
+  GtUword pos;
+
+  for (idx = 0; idx <= (unsigned int) UCHAR_MAX; idx++) {
+    decodetab[idx] = (idx < mapsize || idx == (unsigned int) WILDCARD)
+                       ? gt_alphabet_decode(encseq->alpha, (GtUchar) idx)
+                       : (char) idx;
+  }
+  decodetab[SEPARATOR] = (char) SEPARATOR;
+  for (pos = 0; pos < len; pos++) {
+    buffer[pos] = decodetab[encoded[pos]];
+  }
+}
+
 static GtUword revgetnexttwobitencodingstoppos(GtEncseqReader *esr)
 {
   if (gt_encseq_has_specialranges(esr->encseq)) {
@@ -6139,6 +6957,27 @@ static GtUword revextract2bitenc(GtEndofTwobitencoding *ptbe,
   }
 }
 
+/* Returns the stop position for the sharded encoded sequence read by <esr>
+   from the stop position in the volume containing the current position. */
+static GtUword gt_volumes_getnexttwobitencodingstoppos(GtEncseqReader *esr)
+{
+  const GtEncseq *encseq = esr->encseq;
+  GtUword localpos = esr->currentpos,
+          volnum = gt_encseq_volume_at(encseq, &localpos);
+
+  if (localpos == encseq->volumes[volnum]->totallength) {
+    /* the separator following the volume */
+    return esr->currentpos + (GT_ISDIRREVERSE(esr->readmode) ? 1 : 0);
+  }
+  gt_encseq_reader_seek_volume(esr);
+  /* for a volume without special characters before or after the current
+     position the stop position is that of the separator before or after the
+     volume */
+  return encseq->volumestartpos[volnum]
+         + gt_getnexttwobitencodingstoppos(!GT_ISDIRREVERSE(esr->readmode),
+                                           esr->volumereader);
+}
+
 GtUword gt_getnexttwobitencodingstoppos(GT_UNUSED bool fwd,
                                         GtEncseqReader *esr)
 {
@@ -6147,6 +6986,9 @@ GtUword gt_getnexttwobitencodingstoppos(GT_UNUSED bool fwd,
   if (esr->currentpos == esr->encseq->totallength) {
     return esr->currentpos + (GT_ISDIRREVERSE(esr->originalreadmode) ? 1 : 0);
   }
+  if (esr->encseq->volumes != NULL) {
+    return gt_volumes_getnexttwobitencodingstoppos(esr);
+  }
   rawstoppos = (!GT_ISDIRREVERSE(esr->readmode)
                                       ? fwdgetnexttwobitencodingstoppos
                                       : revgetnexttwobitencodingstoppos) (esr);
@@ -6157,6 +6999,60 @@ GtUword gt_getnexttwobitencodingstoppos(GT_UNUSED bool fwd,
   return rawstoppos;
 }
 
+/* Delivers the units of the sharded <encseq> beginning at position
+   <currentpos> in the direction given by <fwd>, taking the characters from
+   the volumes. */
+static GtUword gt_volumes_extract2bitenc(GtEndofTwobitencoding *ptbe,
+                                         const GtEncseq *encseq,
+                                         bool fwd,
+                                         GtUword currentpos,
+                                         GtUword twobitencodingstoppos)
+{
+  GtUchar buffer[GT_UNITSIN2BITENC];
+  GtUword frompos, topos, maxunits;
+  unsigned int unit;
+
+  gt_assert(currentpos < encseq->totallength);
+  if (fwd) {
+    frompos = currentpos;
+    topos = MIN(currentpos + GT_UNITSIN2BITENC, encseq->totallength) - 1;
+  } else {
+    frompos = currentpos >= (GtUword) GT_UNITSIN2BITENC
+                ? currentpos - (GT_UNITSIN2BITENC - 1)
+                : 0;
+    topos = currentpos;
+  }
+  maxunits = topos - frompos + 1;
+  if (gt_encseq_has_twobitencoding_stoppos_support(encseq)) {
+    if (fwd) {
+      maxunits = currentpos < twobitencodingstoppos
+                   ? MIN(maxunits, twobitencodingstoppos - currentpos)
+                   : 0;
+    } else {
+      maxunits = currentpos >= twobitencodingstoppos
+                   ? MIN(maxunits, currentpos - twobitencodingstoppos + 1)
+                   : 0;
+    }
+  }
+  gt_encseq_extract_encoded(encseq, buffer, frompos, topos);
+  ptbe->tbe = 0;
+  for (unit = 0; unit < (unsigned int) maxunits; unit++) {
+    GtUchar cc = buffer[fwd ? unit : topos - frompos - unit];
+
+    if (ISSPECIAL(cc))
+      break;
+    ptbe->tbe |= ((GtTwobitencoding) cc)
+                 << GT_MULT2(fwd ? GT_UNITSIN2BITENC - 1 - unit : unit);
+  }
+  ptbe->unitsnotspecial = unit;
+  if (fwd) {
+    return currentpos + (GtUword) GT_UNITSIN2BITENC;
+  }
+  return currentpos > (GtUword) GT_UNITSIN2BITENC
+           ? currentpos - (GtUword) GT_UNITSIN2BITENC
+           : 0;
+}
+
 static GtUword gt_encseq_extract2bitenc(
                                             GtEndofTwobitencoding *ptbe,
                                             const GtEncseq *encseq,
@@ -6168,6 +7064,10 @@ static GtUword gt_encseq_extract2bitenc(
   GtUword pos;
 
   gt_assert(currentpos < encseq->logicaltotallength);
+  if (encseq->volumes != NULL) {
+    return gt_volumes_extract2bitenc(ptbe, encseq, fwd, currentpos,
+                                     twobitencodingstoppos);
+  }
   if (encseq->hasmirror && currentpos >= encseq->totallength) {
     if (currentpos == encseq->totallength) {
       /* handle special case where we start on the virtual separator */
@@ -7801,6 +8701,55 @@ static void testseqnumextraction(const GtEncseq *encseq)
   }
 }
 
+static void testbatchaccess(const GtEncseq *encseq)
+{
+  const GtUword numofpositions = 10000UL;
+  GtUword idx, totallength, *positions, *seqnums, *relpositions,
+          *seqstartpositions;
+  GtUchar *chars;
+
+  totallength = encseq->logicaltotallength;
+  positions = gt_malloc(sizeof (*positions) * numofpositions);
+  seqnums = gt_malloc(sizeof (*seqnums) * numofpositions);
+  relpositions = gt_malloc(sizeof (*relpositions) * numofpositions);
+  seqstartpositions = gt_malloc(sizeof (*seqstartpositions) * numofpositions);
+  chars = gt_malloc(sizeof (*chars) * numofpositions);
+  for (idx = 0; idx < numofpositions; idx++) {
+    do {
+      positions[idx] = (GtUword) (random() % totallength);
+    } while (gt_encseq_position_is_separator(encseq, positions[idx],
+                                             GT_READMODE_FORWARD));
+  }
+  gt_encseq_seqnum_batch(encseq, seqnums, relpositions, positions,
+                         numofpositions);
+  gt_encseq_seqstartpos_batch(encseq, seqstartpositions, seqnums,
+                              numofpositions);
+  gt_encseq_get_encoded_char_batch(encseq, chars, positions, numofpositions,
+                                   GT_READMODE_FORWARD);
+  for (idx = 0; idx < numofpositions; idx++) {
+    GtUword seqnum = gt_encseq_seqnum(encseq, positions[idx]),
+            seqstartpos = gt_encseq_seqstartpos(encseq, seqnum);
+
+    if (seqnum != seqnums[idx] ||
+        seqstartpos != seqstartpositions[idx] ||
+        positions[idx] - seqstartpos != relpositions[idx] ||
+        gt_encseq_get_encoded_char(encseq, positions[idx],
+                                   GT_READMODE_FORWARD) != chars[idx]) {
+      fprintf(stderr,
+              "testbatchaccess: pos="GT_WU": seqnum = "GT_WU" != "GT_WU" = "
+              "batch seqnum or relpos = "GT_WU" != "GT_WU" = batch relpos\n",
+              positions[idx], seqnum, seqnums[idx],
+              positions[idx] - seqstartpos, relpositions[idx]);
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
+  gt_free(positions);
+  gt_free(seqnums);
+  gt_free(relpositions);
+  gt_free(seqstartpositions);
+  gt_free(chars);
+}
+
 static void testscanatpos(const GtEncseq *encseq,
                           GtReadmode readmode,
                           GtUword scantrials)
@@ -7820,6 +8769,61 @@ static void testscanatpos(const GtEncseq *encseq,
   gt_encseq_reader_delete(esr);
 }
 
+static void runextractbulktrial(const GtEncseq *encseq,
+                                GtUchar *encbuffer,
+                                char *decbuffer,
+                                GtUword frompos,
+                                GtUword topos)
+{
+  GtUword pos;
+
+  gt_encseq_extract_encoded(encseq, encbuffer, frompos, topos);
+  gt_encseq_extract_decoded(encseq, decbuffer, frompos, topos);
+  for (pos = frompos; pos <= topos; pos++) {
+    GtUchar ccra = gt_encseq_get_encoded_char(encseq, pos,
+                                              GT_READMODE_FORWARD);
+    char dcra = gt_encseq_get_decoded_char(encseq, pos, GT_READMODE_FORWARD);
+
+    if (ccra != encbuffer[pos - frompos] ||
+        dcra != decbuffer[pos - frompos]) {
+      fprintf(stderr, "extract " GT_WU ".." GT_WU
+                      " access=%s: position="GT_WU
+                      ": random access (correct) = %u/%c != %u/%c = "
+                      " bulk extraction (wrong)\n",
+                      frompos, topos,
+                      gt_encseq_accessname(encseq),
+                      pos,
+                      (unsigned int) ccra, dcra,
+                      (unsigned int) encbuffer[pos - frompos],
+                      decbuffer[pos - frompos]);
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
+}
+
+static void testextractbulk(const GtEncseq *encseq, GtUword scantrials)
+{
+  const GtUword maxwidth = 1000UL;
+  GtUword frompos, topos, totallength, trial;
+  GtUchar *encbuffer;
+  char *decbuffer;
+
+  totallength = encseq->logicaltotallength;
+  encbuffer = gt_malloc(sizeof (*encbuffer) * totallength);
+  decbuffer = gt_malloc(sizeof (*decbuffer) * totallength);
+  runextractbulktrial(encseq, encbuffer, decbuffer, 0, totallength-1);
+  for (trial = 0; trial < scantrials; trial++) {
+    frompos = (GtUword) (random() % totallength);
+    topos = frompos + (GtUword) (random() % maxwidth);
+    if (topos >= totallength) {
+      topos = totallength - 1;
+    }
+    runextractbulktrial(encseq, encbuffer, decbuffer, frompos, topos);
+  }
+  gt_free(encbuffer);
+  gt_free(decbuffer);
+}
+
 static void testmulticharactercompare(const GtEncseq *encseq,
                                       GtReadmode readmode,
                                       GtUword multicharcmptrials)
@@ -7980,10 +8984,17 @@ int gt_encseq_check_consistency(const GtEncseq *encseq,
   if (scantrials > 0) {
     gt_logger_log(logger, "run testscanatpos for "GT_WU" trials", scantrials);
     testscanatpos(encseq, readmode, scantrials);
+    if (readmode == GT_READMODE_FORWARD) {
+      gt_logger_log(logger, "run testextractbulk for "GT_WU" trials",
+                    scantrials);
+      testextractbulk(encseq, scantrials);
+    }
   }
   if (withseqnumcheck && readmode == GT_READMODE_FORWARD) {
     gt_logger_log(logger, "run testseqnumextraction");
     testseqnumextraction(encseq);
+    gt_logger_log(logger, "run testbatchaccess");
+    testbatchaccess(encseq);
   }
   gt_logger_log(logger, "run testfullscan");
   return testfullscan(filenametab, encseq, readmode, err);
@@ -8000,6 +9011,11 @@ int gt_encseq_check_external_twobitencoding_to_file(const char *indexname,
   encseq = gt_encseq_loader_load(el, indexname, err);
   if (encseq == NULL)
     haserr = true;
+  else if (encseq->volumes != NULL) {
+    gt_error_set(err, "the sharded encoded sequence %s has no two bit "
+                      "encoding to write", indexname);
+    haserr = true;
+  }
   else {
     char *indexnamecopy;
     size_t indexname_len = strlen(indexname);
@@ -8724,43 +9740,275 @@ void gt_encseq_loader_do_not_mirror(GtEncseqLoader *el)
   el->mirrored = false;
 }
 
+static void gt_encseq_loader_autodiscover(GtEncseqLoader *el,
+                                          const char *indexname)
+{
+  char buf[BUFSIZ];
+  (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_DESTABFILESUFFIX);
+  if (gt_file_exists(buf))
+    el->destab = true;
+  (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_SDSTABFILESUFFIX);
+  if (gt_file_exists(buf))
+    el->sdstab = true;
+  (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_SSPTABFILESUFFIX);
+  if (gt_file_exists(buf))
+    el->ssptab = true;
+  (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_OISTABFILESUFFIX);
+  if (gt_file_exists(buf))
+    el->oistab = true;
+  (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_MD5TABFILESUFFIX);
+  if (gt_file_exists(buf))
+    el->md5tab = true;
+}
+
+/* Returns a sharded encoded sequence presenting the <numofvolumes>
+   encoded sequences <volumes> as one, taking over the ownership of the
+   volumes. The volumes follow each other, separated by a separator, so the
+   global positions and sequence numbers of a volume are translated by the
+   start position and the number of the first sequence of the volume. */
+static GtEncseq *gt_encseq_new_from_volumes(GtEncseq **volumes,
+                                            GtUword numofvolumes,
+                                            const char *indexname)
+{
+  GtEncseq *encseq;
+  GtSpecialcharinfo *sci;
+  GtMD5Tab **md5_tabs;
+  GtUword volnum, numofchars;
+  unsigned int cc;
+  bool withmd5 = true;
+
+  gt_assert(volumes != NULL && numofvolumes > 0);
+  encseq = gt_calloc((size_t) 1, sizeof (*encseq));
+  encseq->volumes = volumes;
+  encseq->numofvolumes = numofvolumes;
+  encseq->volumestartpos = gt_malloc(sizeof (GtUword) * numofvolumes);
+  encseq->volumefirstseqnum = gt_malloc(sizeof (GtUword) * numofvolumes);
+  encseq->volumefirstfilenum = gt_malloc(sizeof (GtUword) * numofvolumes);
+  encseq->refcount_lock = gt_mutex_new();
+  encseq->indexname = gt_cstr_dup(indexname);
+  /* the volumes may use different representations and there is no table of
+     the sharded encoded sequence itself, so everything is delegated to the
+     volumes */
+  encseq->sat = GT_ACCESS_TYPE_UNDEFINED;
+  encseq->satsep = GT_ACCESS_TYPE_UNDEFINED;
+  encseq->satname = "sharded";
+  encseq->version = volumes[0]->version;
+  encseq->is64bit = volumes[0]->is64bit;
+  encseq->alpha = gt_alphabet_ref(volumes[0]->alpha);
+  encseq->filenametab = gt_str_array_new();
+  encseq->minseqlen = GT_UWORD_MAX;
+  encseq->has_exceptiontable = true;
+  numofchars = (GtUword) gt_alphabet_num_of_chars(encseq->alpha);
+  encseq->headerptr.characterdistribution
+    = gt_calloc((size_t) numofchars, sizeof (GtUword));
+  for (volnum = 0; volnum < numofvolumes; volnum++)
+    encseq->numofdbfiles += volumes[volnum]->numofdbfiles;
+  encseq->headerptr.filelengthtab
+    = gt_malloc(sizeof (*encseq->headerptr.filelengthtab)
+                * encseq->numofdbfiles);
+  encseq->numofdbfiles = 0;
+  sci = &encseq->specialcharinfo;
+  md5_tabs = gt_malloc(sizeof (*md5_tabs) * numofvolumes);
+  for (volnum = 0; volnum < numofvolumes; volnum++) {
+    const GtEncseq *volume = volumes[volnum];
+    const GtSpecialcharinfo *vsci = &volume->specialcharinfo;
+    GtUword idx;
+
+    if (volnum > 0) {
+      encseq->totallength++; /* the separator between two volumes */
+      sci->specialcharacters++;
+      /* the separator extends the special ranges adjacent to it */
+      sci->realspecialranges++;
+      sci->specialranges++;
+      if (volumes[volnum-1]->specialcharinfo.lengthofspecialsuffix > 0) {
+        sci->realspecialranges--;
+        sci->specialranges--;
+      }
+      if (vsci->lengthofspecialprefix > 0) {
+        sci->realspecialranges--;
+        sci->specialranges--;
+      }
+    }
+    encseq->volumestartpos[volnum] = encseq->totallength;
+    encseq->volumefirstseqnum[volnum] = encseq->numofdbsequences;
+    encseq->volumefirstfilenum[volnum] = encseq->numofdbfiles;
+    encseq->totallength += volume->totallength;
+    encseq->numofdbsequences += volume->numofdbsequences;
+    for (idx = 0; idx < volume->numofdbfiles; idx++) {
+      GtFilelengthvalues *flv
+        = encseq->headerptr.filelengthtab + encseq->numofdbfiles + idx;
+
+      if (volume->headerptr.filelengthtab != NULL)
+        *flv = volume->headerptr.filelengthtab[idx];
+      else {
+        gt_assert(volume->numofdbfiles == 1UL);
+        flv->length = flv->effectivelength = (uint64_t) volume->totallength;
+      }
+    }
+    encseq->numofdbfiles += volume->numofdbfiles;
+    encseq->lengthofdbfilenames += volume->lengthofdbfilenames;
+    encseq->sizeofrep += volume->sizeofrep;
+    for (idx = 0; idx < gt_str_array_size(volume->filenametab); idx++) {
+      gt_str_array_add_cstr(encseq->filenametab,
+                            gt_str_array_get(volume->filenametab, idx));
+    }
+    for (cc = 0; cc < (unsigned int) numofchars; cc++) {
+      encseq->headerptr.characterdistribution[cc]
+        += gt_encseq_charcount(volume, (GtUchar) cc);
+    }
+    sci->specialcharacters += vsci->specialcharacters;
+    sci->specialranges += vsci->specialranges;
+    sci->realspecialranges += vsci->realspecialranges;
+    sci->wildcards += vsci->wildcards;
+    sci->wildcardranges += vsci->wildcardranges;
+    sci->realwildcardranges += vsci->realwildcardranges;
+    sci->exceptioncharacters += vsci->exceptioncharacters;
+    sci->exceptionranges += vsci->exceptionranges;
+    sci->realexceptionranges += vsci->realexceptionranges;
+    if (vsci->lengthoflongestnonspecial > sci->lengthoflongestnonspecial)
+      sci->lengthoflongestnonspecial = vsci->lengthoflongestnonspecial;
+    if (gt_encseq_min_seq_length(volume) < encseq->minseqlen)
+      encseq->minseqlen = gt_encseq_min_seq_length(volume);
+    if (gt_encseq_max_seq_length(volume) > encseq->maxseqlen)
+      encseq->maxseqlen = gt_encseq_max_seq_length(volume);
+    if (volume->maxsubalphasize > encseq->maxsubalphasize)
+      encseq->maxsubalphasize = volume->maxsubalphasize;
+    if (!volume->has_exceptiontable)
+      encseq->has_exceptiontable = false;
+    if (volume->md5_tab == NULL)
+      withmd5 = false;
+    else
+      md5_tabs[volnum] = volume->md5_tab;
+  }
+  /* a special prefix or suffix covering a whole volume continues with the
+     separator and the special prefix or suffix of the next volume */
+  for (volnum = 0; volnum < numofvolumes; volnum++) {
+    const GtEncseq *volume = volumes[volnum];
+
+    sci->lengthofspecialprefix
+      += volume->specialcharinfo.lengthofspecialprefix;
+    if (volume->specialcharinfo.lengthofspecialprefix < volume->totallength
+        || volnum == numofvolumes - 1)
+      break;
+    sci->lengthofspecialprefix++;
+  }
+  for (volnum = numofvolumes; volnum > 0; volnum--) {
+    const GtEncseq *volume = volumes[volnum-1];
+
+    sci->lengthofspecialsuffix
+      += volume->specialcharinfo.lengthofspecialsuffix;
+    if (volume->specialcharinfo.lengthofspecialsuffix < volume->totallength
+        || volnum == 1)
+      break;
+    sci->lengthofspecialsuffix++;
+  }
+  sci->lengthofwildcardprefix = volumes[0]->specialcharinfo
+                                           .lengthofwildcardprefix;
+  sci->lengthofwildcardsuffix = volumes[numofvolumes-1]->specialcharinfo
+                                                      .lengthofwildcardsuffix;
+  encseq->has_specialranges = sci->specialcharacters > 0;
+  encseq->has_wildcardranges = sci->wildcards > 0;
+  encseq->logicaltotallength = encseq->totallength;
+  encseq->logicalnumofdbsequences = encseq->numofdbsequences;
+  if (withmd5)
+    encseq->md5_tab = gt_md5_tab_new_from_tabs(md5_tabs, numofvolumes);
+  gt_free(md5_tabs);
+  return encseq;
+}
+
+/* Maps the volumes of the sharded encoded sequence <indexname> and presents
+   them as one encoded sequence. The tables to load are determined for each
+   volume separately, starting from the tables requested from <el>. */
+static GtEncseq* gt_encseq_new_from_shards(GtEncseqLoader *el,
+                                           const char *indexname,
+                                           GtError *err)
+{
+  GtStrArray *volumenames;
+  GtEncseq **volumes;
+  GtUword idx, numofvolumes = 0;
+  bool destab = el->destab,
+       sdstab = el->sdstab,
+       ssptab = el->ssptab,
+       oistab = el->oistab,
+       md5tab = el->md5tab;
+  int had_err = 0;
+
+  volumenames = gt_encseq_shards_volumes(indexname, err);
+  if (volumenames == NULL)
+    return NULL;
+  volumes = gt_malloc(sizeof (*volumes) * gt_str_array_size(volumenames));
+  for (idx = 0; !had_err && idx < gt_str_array_size(volumenames); idx++) {
+    const char *volumename = gt_str_array_get(volumenames, idx);
+
+    el->destab = destab;
+    el->sdstab = sdstab;
+    el->ssptab = ssptab;
+    el->oistab = oistab;
+    el->md5tab = md5tab;
+    if (el->autodiscover)
+      gt_encseq_loader_autodiscover(el, volumename);
+    gt_log_log("loading volume %s of sharded encseq %s with des: %d, sds: %d, "
+               "ssp: %d, ois: %d, md5: %d", volumename, indexname, el->destab,
+               el->sdstab, el->ssptab, el->oistab, el->md5tab);
+    volumes[idx] = gt_encseq_new_from_index(volumename,
+                                            el->destab,
+                                            el->sdstab,
+                                            el->ssptab,
+                                            el->oistab,
+                                            el->md5tab,
+                                            el->logger,
+                                            err);
+    if (volumes[idx] == NULL) {
+      had_err = -1;
+      break;
+    }
+    numofvolumes++;
+    if (!gt_alphabet_equals(volumes[0]->alpha, volumes[idx]->alpha)) {
+      gt_error_set(err, "alphabet of volume \"%s\" differs from the "
+                        "alphabet of the other volumes", volumename);
+      had_err = -1;
+    }
+  }
+  el->destab = destab;
+  el->sdstab = sdstab;
+  el->ssptab = ssptab;
+  el->oistab = oistab;
+  el->md5tab = md5tab;
+  gt_str_array_delete(volumenames);
+  if (had_err) {
+    for (idx = 0; idx < numofvolumes; idx++)
+      gt_encseq_delete(volumes[idx]);
+    gt_free(volumes);
+    return NULL;
+  }
+  return gt_encseq_new_from_volumes(volumes, numofvolumes, indexname);
+}
+
 GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
                                 GtError *err)
 {
   GtEncseq *encseq = NULL;
   gt_assert(el && indexname);
 
-  if (el->autodiscover) {
-    char buf[BUFSIZ];
-    (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_DESTABFILESUFFIX);
-    if (gt_file_exists(buf))
-      el->destab = true;
-    (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_SDSTABFILESUFFIX);
-    if (gt_file_exists(buf))
-      el->sdstab = true;
-    (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_SSPTABFILESUFFIX);
-    if (gt_file_exists(buf))
-      el->ssptab = true;
-    (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_OISTABFILESUFFIX);
-    if (gt_file_exists(buf))
-      el->oistab = true;
-    (void) snprintf(buf, BUFSIZ, "%s%s", indexname, GT_MD5TABFILESUFFIX);
-    if (gt_file_exists(buf))
-      el->md5tab = true;
-  }
-  gt_log_log("loading encseq %s with des: %d, sds: %d, ssp: %d, ois: %d, "
-             "md5: %d, mirr: %d",
-             indexname, el->destab, el->sdstab, el->ssptab, el->oistab,
-             el->md5tab, el->mirrored);
-
-  encseq = gt_encseq_new_from_index(indexname,
-                                    el->destab,
-                                    el->sdstab,
-                                    el->ssptab,
-                                    el->oistab,
-                                    el->md5tab,
-                                    el->logger,
-                                    err);
+  if (gt_encseq_shards_exist(indexname)) {
+    encseq = gt_encseq_new_from_shards(el, indexname, err);
+  } else {
+    if (el->autodiscover)
+      gt_encseq_loader_autodiscover(el, indexname);
+    gt_log_log("loading encseq %s with des: %d, sds: %d, ssp: %d, ois: %d, "
+               "md5: %d, mirr: %d",
+               indexname, el->destab, el->sdstab, el->ssptab, el->oistab,
+               el->md5tab, el->mirrored);
+
+    encseq = gt_encseq_new_from_index(indexname,
+                                      el->destab,
+                                      el->sdstab,
+                                      el->ssptab,
+                                      el->oistab,
+                                      el->md5tab,
+                                      el->logger,
+                                      err);
+  }
   if (encseq && el->mirrored) {
     if (gt_encseq_mirror(encseq, err) != 0) {
       gt_encseq_delete(encseq);
@@ -9474,6 +10722,12 @@ GtUword gt_encseq_num_of_files(const GtEncseq *encseq)
 GtUint64 gt_encseq_effective_filelength(const GtEncseq *encseq,
                                         GtUword filenum)
 {
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_search(encseq->volumefirstfilenum,
+                                             encseq->numofvolumes, filenum);
+    return gt_encseq_effective_filelength(encseq->volumes[volnum],
+                                  filenum - encseq->volumefirstfilenum[volnum]);
+  }
   if (encseq->numofdbfiles == 1UL)
     return (GtUint64) encseq->totallength;
   gt_assert(encseq != NULL && encseq->headerptr.filelengthtab != NULL);
@@ -9484,6 +10738,15 @@ GtUint64 gt_encseq_effective_filelength(const GtEncseq *encseq,
 GtUword gt_encseq_filenum(const GtEncseq *encseq,
                                 GtUword position)
 {
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_at(encseq, &position);
+    const GtEncseq *volume = encseq->volumes[volnum];
+
+    return encseq->volumefirstfilenum[volnum]
+           + (position == volume->totallength
+                ? volume->numofdbfiles - 1
+                : gt_encseq_filenum(volume, position));
+  }
   gt_assert(encseq->numofdbfiles == 1UL || encseq->fsptab != NULL);
 
   /* handle virtual coordinates */
@@ -9504,6 +10767,13 @@ GtUword gt_encseq_filenum(const GtEncseq *encseq,
 GtUword gt_encseq_filestartpos(const GtEncseq *encseq,
                                      GtUword filenum)
 {
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_search(encseq->volumefirstfilenum,
+                                             encseq->numofvolumes, filenum);
+    return encseq->volumestartpos[volnum]
+           + gt_encseq_filestartpos(encseq->volumes[volnum],
+                                  filenum - encseq->volumefirstfilenum[volnum]);
+  }
   gt_assert(encseq->numofdbfiles == 1UL || encseq->fsptab != NULL);
   if (filenum > 0)
     return encseq->fsptab[filenum-1] + 1;
@@ -9513,6 +10783,13 @@ GtUword gt_encseq_filestartpos(const GtEncseq *encseq,
 GtUword gt_encseq_filenum_first_seqnum(const GtEncseq *encseq,
                                              GtUword filenum)
 {
+  if (encseq->volumes != NULL) {
+    GtUword volnum = gt_encseq_volume_search(encseq->volumefirstfilenum,
+                                             encseq->numofvolumes, filenum);
+    return encseq->volumefirstseqnum[volnum]
+           + gt_encseq_filenum_first_seqnum(encseq->volumes[volnum],
+                                  filenum - encseq->volumefirstfilenum[volnum]);
+  }
   gt_assert(encseq->numofdbfiles == 1UL || encseq->fsptab != NULL);
   if (filenum > 0)
     return gt_encseq_seqnum(encseq, encseq->fsptab[filenum-1] + 1);
@@ -9557,7 +10834,12 @@ int gt_encseq_mirror(GtEncseq *encseq, GtError *err)
   int had_err = 0;
   gt_assert(encseq && !encseq->hasmirror);
   gt_error_check(err);
-  if (!gt_alphabet_is_dna(encseq->alpha)) {
+  if (encseq->volumes != NULL) {
+    gt_error_set(err, "mirroring is not supported for the sharded encoded "
+                      "sequence %s", encseq->indexname);
+    had_err = -1;
+  }
+  if (!had_err && !gt_alphabet_is_dna(encseq->alpha)) {
     gt_error_set(err, "mirroring can only be enabled for DNA sequences, "
                       "this encoded sequence has alphabet: %.*s",
                       gt_alphabet_num_of_chars(encseq->alpha),
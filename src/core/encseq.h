@@ -510,6 +510,10 @@ GtUword gt_encseq_sizeofstructure(void);
    sequence. */
 GtEncseqAccessType gt_encseq_accesstype_get(const GtEncseq *encseq);
 
+/* The following function delivers the name of the accesstype of a given
+   encoded sequence, which is "sharded" for a sharded encoded sequence. */
+const char* gt_encseq_accessname(const GtEncseq *encseq);
+
 /* The following function delivers the encseq->equallength.valueunsignedlong
    if encseq->equallength.defined is true */
 GtUword gt_encseq_equallength(const GtEncseq *encseq);
@@ -542,6 +546,41 @@ GtUword *gt_all_sequence_separators_get(const GtEncseq *encseq);
 
 GtUword *gt_all_sequence_lengths_get(const GtEncseq *encseq);
 
+/* Store the sequence number of <positions>[i] in <seqnums>[i] for all
+   i < <numofpositions>. The positions must not be separator positions.
+   If <relpositions> is not <NULL>, store the position relative to the start
+   of this sequence in <relpositions>[i]. <relpositions> may be identical to
+   <positions>. The result is the same as for <gt_encseq_seqnum()> and
+   <gt_encseq_seqstartpos()> applied to each position, but the positions are
+   processed in ascending order, so that the sequence boundaries are only
+   looked up once for all positions in the same sequence. */
+
+void gt_encseq_seqnum_batch(const GtEncseq *encseq,
+                            GtUword *seqnums,
+                            GtUword *relpositions,
+                            const GtUword *positions,
+                            GtUword numofpositions);
+
+/* Store the start position of the sequence with number <seqnums>[i] in
+   <seqstartpositions>[i] for all i < <numofseqnums>. Each distinct sequence
+   number is only looked up once. */
+
+void gt_encseq_seqstartpos_batch(const GtEncseq *encseq,
+                                 GtUword *seqstartpositions,
+                                 const GtUword *seqnums,
+                                 GtUword numofseqnums);
+
+/* Store the encoded character at position <positions>[i] wrt. <readmode> in
+   <chars>[i] for all i < <numofpositions>. The memory holding the character
+   of a position is prefetched a few positions ahead, so that the cache
+   misses of scattered positions overlap. */
+
+void gt_encseq_get_encoded_char_batch(const GtEncseq *encseq,
+                                      GtUchar *chars,
+                                      const GtUword *positions,
+                                      GtUword numofpositions,
+                                      GtReadmode readmode);
+
 /* The following functions are for testing */
 
 #ifndef NDEBUG
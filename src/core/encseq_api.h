@@ -442,9 +442,11 @@ void              gt_encseq_loader_mirror(GtEncseqLoader *el);
    the start. */
 void              gt_encseq_loader_do_not_mirror(GtEncseqLoader *el);
 /* Attempts to map the index files as specified by <indexname> using the options
-   set in <el> using this interface. Returns a <GtEncseq> instance
-   on success, or <NULL> on error. If an error occurred, <err> is set
-   accordingly. */
+   set in <el> using this interface. If <indexname> is a sharded encoded
+   sequence, all its volumes are mapped and accessed as one sequence through
+   the functions of this interface; mirroring is not supported for it.
+   Returns a <GtEncseq> instance on success, or <NULL> on error. If an error
+   occurred, <err> is set accordingly. */
 GtEncseq*         gt_encseq_loader_load(GtEncseqLoader *el,
                                         const char *indexname,
                                         GtError *err);
@@ -224,5 +224,14 @@ struct GtEncseq
 
   GtUword minseqlen,
                 maxseqlen;
+
+  /* only for sharded encoded sequences: the mapped volumes and, for each
+     volume, the global position of its first symbol and the global numbers
+     of its first sequence and its first file */
+  GtEncseq **volumes;
+  GtUword numofvolumes,
+          *volumestartpos,
+          *volumefirstseqnum,
+          *volumefirstfilenum;
 };
 #endif
@@ -0,0 +1,174 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdio.h>
+#include "core/assert_api.h"
+#include "core/encseq_api.h"
+#include "core/encseq_metadata.h"
+#include "core/encseq_shards.h"
+#include "core/fa.h"
+#include "core/fileutils_api.h"
+#include "core/str_api.h"
+#include "core/xansi_api.h"
+
+static void encseq_shards_manifestname(GtStr *manifestname,
+                                       const char *indexname)
+{
+  gt_str_set(manifestname, indexname);
+  gt_str_append_cstr(manifestname, GT_ENCSEQSHARDSFILESUFFIX);
+}
+
+static void encseq_shards_resolve(GtStr *path, const char *indexname,
+                                  const char *volume)
+{
+  gt_str_reset(path);
+  if (volume[0] != '/') {
+    gt_file_dirname(path, indexname);
+    if (gt_str_length(path) > 0)
+      gt_str_append_char(path, '/');
+  }
+  gt_str_append_cstr(path, volume);
+}
+
+bool gt_encseq_shards_exist(const char *indexname)
+{
+  gt_assert(indexname);
+  return !gt_file_exists_with_suffix(indexname, GT_ENCSEQFILESUFFIX) &&
+         gt_file_exists_with_suffix(indexname, GT_ENCSEQSHARDSFILESUFFIX);
+}
+
+GtStrArray* gt_encseq_shards_volumes(const char *indexname, GtError *err)
+{
+  GtStrArray *volumes = NULL;
+  GtStr *manifestname, *line, *path;
+  FILE *fp;
+  bool eof = false;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(indexname);
+
+  manifestname = gt_str_new();
+  encseq_shards_manifestname(manifestname, indexname);
+  fp = gt_fa_fopen(gt_str_get(manifestname), "r", err);
+  if (fp == NULL)
+    had_err = -1;
+  if (!had_err) {
+    line = gt_str_new();
+    path = gt_str_new();
+    volumes = gt_str_array_new();
+    while (!eof) {
+      gt_str_reset(line);
+      eof = (gt_str_read_next_line(line, fp) == EOF);
+      /* skip empty lines and comments */
+      if (gt_str_length(line) == 0 || gt_str_get(line)[0] == '#')
+        continue;
+      encseq_shards_resolve(path, indexname, gt_str_get(line));
+      gt_str_array_add(volumes, path);
+    }
+    if (gt_str_array_size(volumes) == 0) {
+      gt_error_set(err, "manifest \"%s\" does not list any volume",
+                   gt_str_get(manifestname));
+      had_err = -1;
+    }
+    gt_str_delete(line);
+    gt_str_delete(path);
+    gt_fa_xfclose(fp);
+  }
+  gt_str_delete(manifestname);
+  if (had_err) {
+    gt_str_array_delete(volumes);
+    return NULL;
+  }
+  return volumes;
+}
+
+/* checks that <volume> is an encoded sequence over alphabet <*alpha>, or
+   sets <*alpha> to its alphabet if <*alpha> is NULL */
+static int encseq_shards_check_volume(GtAlphabet **alpha, const char *volume,
+                                      GtError *err)
+{
+  GtEncseqMetadata *emd;
+  int had_err = 0;
+
+  if (!gt_file_exists_with_suffix(volume, GT_ENCSEQFILESUFFIX)) {
+    gt_error_set(err, "volume \"%s\" is not an encoded sequence: file "
+                      "\"%s%s\" does not exist", volume, volume,
+                      GT_ENCSEQFILESUFFIX);
+    return -1;
+  }
+  emd = gt_encseq_metadata_new(volume, err);
+  if (emd == NULL)
+    return -1;
+  if (*alpha == NULL) {
+    *alpha = gt_alphabet_ref(gt_encseq_metadata_alphabet(emd));
+  } else if (!gt_alphabet_equals(*alpha, gt_encseq_metadata_alphabet(emd))) {
+    gt_error_set(err, "alphabet of volume \"%s\" differs from the alphabet "
+                      "of the other volumes", volume);
+    had_err = -1;
+  }
+  gt_encseq_metadata_delete(emd);
+  return had_err;
+}
+
+int gt_encseq_shards_add(const char *indexname, const GtStrArray *volumes,
+                         GtError *err)
+{
+  GtAlphabet *alpha = NULL;
+  GtStr *manifestname, *path;
+  GtUword idx;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(indexname && volumes);
+
+  if (gt_file_exists_with_suffix(indexname, GT_ENCSEQFILESUFFIX)) {
+    gt_error_set(err, "\"%s\" is an encoded sequence, cannot add volumes to "
+                      "it", indexname);
+    return -1;
+  }
+  manifestname = gt_str_new();
+  path = gt_str_new();
+  encseq_shards_manifestname(manifestname, indexname);
+  if (gt_file_exists(gt_str_get(manifestname))) {
+    GtStrArray *present = gt_encseq_shards_volumes(indexname, err);
+    if (present == NULL)
+      had_err = -1;
+    else {
+      had_err = encseq_shards_check_volume(&alpha,
+                                           gt_str_array_get(present, 0), err);
+      gt_str_array_delete(present);
+    }
+  }
+  for (idx = 0; !had_err && idx < gt_str_array_size(volumes); idx++) {
+    encseq_shards_resolve(path, indexname, gt_str_array_get(volumes, idx));
+    had_err = encseq_shards_check_volume(&alpha, gt_str_get(path), err);
+  }
+  if (!had_err) {
+    FILE *fp = gt_fa_fopen(gt_str_get(manifestname), "a", err);
+    if (fp == NULL)
+      had_err = -1;
+    else {
+      for (idx = 0; idx < gt_str_array_size(volumes); idx++) {
+        gt_xfputs(gt_str_array_get(volumes, idx), fp);
+        gt_xfputc('\n', fp);
+      }
+      gt_fa_xfclose(fp);
+    }
+  }
+  gt_alphabet_delete(alpha);
+  gt_str_delete(manifestname);
+  gt_str_delete(path);
+  return had_err;
+}
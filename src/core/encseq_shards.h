@@ -0,0 +1,53 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef ENCSEQ_SHARDS_H
+#define ENCSEQ_SHARDS_H
+
+#include <stdbool.h>
+#include "core/error_api.h"
+#include "core/str_array_api.h"
+
+/* A sharded encoded sequence consists of a manifest file
+   <indexname>.esh and a list of independently encoded sequences, the
+   volumes. The manifest lists the index names of the volumes, one per
+   line. Relative volume names are interpreted relative to the directory of
+   the manifest. New volumes are appended to the manifest, so neither the
+   manifest entries nor the volumes already present are ever rewritten. */
+
+/* The file suffix used for manifests of sharded encoded sequences. */
+#define GT_ENCSEQSHARDSFILESUFFIX ".esh"
+
+/* Returns true if a manifest for <indexname> exists and there is no
+   encoded sequence file <indexname>.esq. */
+bool          gt_encseq_shards_exist(const char *indexname);
+
+/* Returns the index names of the volumes listed in the manifest of
+   <indexname>, resolved relative to the directory of the manifest, in the
+   order in which they were added. Returns NULL and sets <err> if the
+   manifest cannot be read or lists no volume. */
+GtStrArray*   gt_encseq_shards_volumes(const char *indexname, GtError *err);
+
+/* Appends the volumes with index names <volumes> to the manifest of
+   <indexname>, creating the manifest if necessary. Each volume must be an
+   existing encoded sequence over the same alphabet as the volumes already
+   listed. Returns 0 on success and -1 on error, in which case the manifest
+   is left unchanged. */
+int           gt_encseq_shards_add(const char *indexname,
+                                   const GtStrArray *volumes,
+                                   GtError *err);
+
+#endif
@@ -21,8 +21,15 @@
 #include <windows.h>
 #endif
 #include <fcntl.h>
+#include <limits.h>
+#include <string.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#include "core/array.h"
 #include "core/compat.h"
+#include "core/cstr_api.h"
 #include "core/dynalloc.h"
 #include "core/eansi.h"
 #include "core/ebzlib.h"
@@ -34,6 +41,7 @@
 #include "core/thread_api.h"
 #include "core/types_api.h"
 #include "core/unused_api.h"
+#include "core/warning_api.h"
 #include "core/xansi_api.h"
 #include "core/xbsd.h"
 #include "core/xbzlib.h"
@@ -45,10 +53,13 @@ typedef struct {
   GtMutex *file_mutex,
           *mmap_mutex;
   GtHashmap *file_pointer,
-            *memory_maps;
+            *memory_maps,
+            *cached_maps;
   GtUword current_size,
                 max_size;
-  bool global_space_peak;
+  bool global_space_peak,
+       mmap_policy_warned,
+       mmap_cache;
 } FA;
 
 static FA *fa = NULL;
@@ -62,7 +73,14 @@ typedef struct {
   size_t len;
   const char *src_file;
   int src_line;
-#ifdef _WIN32
+#ifndef _WIN32
+  /* identity of the mapped file and number of users, for cached maps only */
+  dev_t dev;
+  ino_t ino;
+  time_t mtime;
+  GtUword references;
+  bool cached;
+#else
   /* additional handles necessary for memory maps on Windows */
   HANDLE filehandle,
          filemapping;
@@ -93,7 +111,10 @@ void gt_fa_init(void)
                                     (GtFree) free_FAFileInfo);
   fa->memory_maps = gt_hashmap_new(GT_HASH_DIRECT, NULL,
                                    (GtFree) free_FAMapInfo);
+  fa->cached_maps = gt_hashmap_new(GT_HASH_STRING, gt_free_func, NULL);
   fa->global_space_peak = false;
+  fa->mmap_policy_warned = false;
+  fa->mmap_cache = false;
 }
 
 static void* fileopen_generic(FA *fa, const char *path, const char *mode,
@@ -481,6 +502,67 @@ static size_t fd_to_file_size(int fd,const char *path,bool hard_fail,
   return sb.st_size;
 }
 
+#ifndef _WIN32
+/* returns the cached map of the file <path> opened as <fd> if the file did
+   not change since it was mapped, NULL otherwise */
+static void* mmap_cache_lookup(int fd, const char *path, size_t *len)
+{
+  FAMapInfo *mapinfo;
+  struct stat sb;
+  void *map;
+
+  if (fstat(fd, &sb) != 0)
+    return NULL;
+  gt_mutex_lock(fa->mmap_mutex);
+  if ((map = gt_hashmap_get(fa->cached_maps, path)) != NULL) {
+    mapinfo = gt_hashmap_get(fa->memory_maps, map);
+    gt_assert(mapinfo && mapinfo->cached);
+    if (mapinfo->dev == sb.st_dev && mapinfo->ino == sb.st_ino &&
+        mapinfo->mtime == sb.st_mtime && mapinfo->len == (size_t) sb.st_size) {
+      mapinfo->references++;
+      *len = mapinfo->len;
+    }
+    else
+      map = NULL;
+  }
+  gt_mutex_unlock(fa->mmap_mutex);
+  return map;
+}
+
+/* makes the new read-only <map> of the file <path> opened as <fd> available
+   to later calls of mmap_cache_lookup(), replacing an outdated map of the same
+   file */
+static void mmap_cache_add(int fd, const char *path, void *map)
+{
+  FAMapInfo *mapinfo, *oldmapinfo;
+  struct stat sb;
+  void *oldmap, *unmap = NULL;
+
+  if (fstat(fd, &sb) != 0)
+    return;
+  gt_mutex_lock(fa->mmap_mutex);
+  if ((oldmap = gt_hashmap_get(fa->cached_maps, path)) != NULL) {
+    oldmapinfo = gt_hashmap_get(fa->memory_maps, oldmap);
+    gt_assert(oldmapinfo && oldmapinfo->cached);
+    oldmapinfo->cached = false;
+    if (oldmapinfo->references == 0)
+      unmap = oldmap;
+    gt_hashmap_remove(fa->cached_maps, (void*) path);
+  }
+  mapinfo = gt_hashmap_get(fa->memory_maps, map);
+  gt_assert(mapinfo);
+  mapinfo->dev = sb.st_dev;
+  mapinfo->ino = sb.st_ino;
+  mapinfo->mtime = sb.st_mtime;
+  mapinfo->references = 1UL;
+  mapinfo->cached = true;
+  gt_hashmap_add(fa->cached_maps, gt_cstr_dup(path), map);
+  gt_mutex_unlock(fa->mmap_mutex);
+  if (unmap != NULL)
+    gt_fa_xmunmap(unmap);
+}
+#endif
+
 static void* mmap_generic_path_func(const char *path, size_t *len,
                                     bool mapwritable, bool hard_fail,
                                     const char *src_file, int src_line,
@@ -502,10 +584,25 @@ static void* mmap_generic_path_func(const char *path, size_t *len,
   {
     return NULL;
   }
+#ifndef _WIN32
+  if (fa->mmap_cache && !mapwritable) {
+    map = mmap_cache_lookup(fd, path, &file_size);
+    if (map != NULL) {
+      if (len != NULL)
+        *len = file_size;
+      gt_xclose(fd);
+      return map;
+    }
+  }
+#endif
   map = gt_fa_mmap_generic_fd_func(fd, path, file_size, 0, mapwritable,
                                    hard_fail, src_file, src_line, err);
   if (map != NULL && len != NULL)
     *len = file_size;
+#ifndef _WIN32
+  if (map != NULL && fa->mmap_cache && !mapwritable)
+    mmap_cache_add(fd, path, map);
+#endif
   gt_xclose(fd);
   return map;
 }
@@ -661,6 +758,13 @@ void gt_fa_xmunmap(void *addr)
   mapinfo = gt_hashmap_get(fa->memory_maps, addr);
   gt_assert(mapinfo);
 #ifndef _WIN32
+  if (mapinfo->cached) {
+    /* keep the map for later users */
+    gt_assert(mapinfo->references > 0);
+    mapinfo->references--;
+    gt_mutex_unlock(fa->mmap_mutex);
+    return;
+  }
   gt_xmunmap(addr, mapinfo->len);
 #else
   if (!UnmapViewOfFile(addr)) {
@@ -687,6 +791,187 @@ void gt_fa_xmunmap(void *addr)
   gt_mutex_unlock(fa->mmap_mutex);
 }
 
+#ifndef _WIN32
+static void fa_mmap_populate(void *addr, size_t len)
+{
+#ifdef MADV_POPULATE_READ
+  if (madvise(addr, len, MADV_POPULATE_READ) == 0)
+    return;
+#endif
+  {
+    /* touch one byte per page, for kernels without MADV_POPULATE_READ */
+    const volatile char *ptr = addr;
+    size_t offset, pagesize = (size_t) sysconf(_SC_PAGESIZE);
+    char sum = 0;
+
+    for (offset = 0; offset < len; offset += pagesize)
+      sum ^= ptr[offset];
+    (void) sum;
+  }
+}
+
+#if defined (__linux__) && defined (SYS_set_mempolicy) && \
+    defined (SYS_get_mempolicy)
+#define GT_FA_MPOL_DEFAULT    0
+#define GT_FA_MPOL_INTERLEAVE 3
+#define GT_FA_MAXNODEWORDS    16
+
+/* Page cache pages are allocated according to the memory policy of the
+   faulting thread, so the interleave policy is set for the calling thread
+   while the map is populated and restored afterwards. */
+static void fa_mmap_populate_interleaved(void *addr, size_t len)
+{
+  unsigned long oldmask[GT_FA_MAXNODEWORDS],
+                allnodes[GT_FA_MAXNODEWORDS];
+  const unsigned long maxnode = (unsigned long) GT_FA_MAXNODEWORDS *
+                                sizeof (unsigned long) * CHAR_BIT;
+  int oldmode;
+
+  if (syscall(SYS_get_mempolicy, &oldmode, oldmask, maxnode, NULL, 0) != 0) {
+    fa_mmap_populate(addr, len);
+    return;
+  }
+  memset(allnodes, 0xff, sizeof allnodes);
+  if (syscall(SYS_set_mempolicy, GT_FA_MPOL_INTERLEAVE, allnodes,
+              maxnode) != 0) {
+    fa_mmap_populate(addr, len);
+    return;
+  }
+  fa_mmap_populate(addr, len);
+  if (oldmode == GT_FA_MPOL_DEFAULT)
+    (void) syscall(SYS_set_mempolicy, GT_FA_MPOL_DEFAULT, NULL, 0UL);
+  else
+    (void) syscall(SYS_set_mempolicy, oldmode, oldmask, maxnode);
+}
+#else
+#define fa_mmap_populate_interleaved(ADDR, LEN) fa_mmap_populate(ADDR, LEN)
+#endif
+#endif
+
+void gt_fa_mmap_apply_policy(void *addr, unsigned int policy)
+{
+  FAMapInfo *mapinfo;
+  size_t len;
+  gt_assert(fa);
+  if (!addr || policy == (unsigned int) GT_FA_MAP_NORMAL) return;
+  gt_mutex_lock(fa->mmap_mutex);
+  mapinfo = gt_hashmap_get(fa->memory_maps, addr);
+  gt_assert(mapinfo);
+  len = mapinfo->len;
+  gt_mutex_unlock(fa->mmap_mutex);
+#ifndef _WIN32
+  if (policy & GT_FA_MAP_SEQUENTIAL)
+    (void) madvise(addr, len, MADV_SEQUENTIAL);
+  if (policy & GT_FA_MAP_RANDOM)
+    (void) madvise(addr, len, MADV_RANDOM);
+#ifdef MADV_HUGEPAGE
+  if (policy & GT_FA_MAP_HUGEPAGES)
+    (void) madvise(addr, len, MADV_HUGEPAGE);
+#endif
+  if (policy & GT_FA_MAP_WILLNEED)
+    (void) madvise(addr, len, MADV_WILLNEED);
+  if (policy & GT_FA_MAP_INTERLEAVE)
+    fa_mmap_populate_interleaved(addr, len);
+  else if (policy & GT_FA_MAP_POPULATE)
+    fa_mmap_populate(addr, len);
+#else
+  (void) len;
+#endif
+}
+
+static const struct {
+  const char *name;
+  GtFaMapPolicy policy;
+} fa_mmap_policy_names[] = {
+  {"normal",     GT_FA_MAP_NORMAL},
+  {"sequential", GT_FA_MAP_SEQUENTIAL},
+  {"random",     GT_FA_MAP_RANDOM},
+  {"willneed",   GT_FA_MAP_WILLNEED},
+  {"hugepages",  GT_FA_MAP_HUGEPAGES},
+  {"populate",   GT_FA_MAP_POPULATE},
+  {"interleave", GT_FA_MAP_INTERLEAVE}
+};
+
+/* parses the hints in <hints> of length <len> into <policy>, returns false
+   if one of them is unknown */
+static bool fa_mmap_parse_hints(const char *hints, size_t len,
+                                unsigned int *policy)
+{
+  const char *end = hints + len;
+
+  *policy = (unsigned int) GT_FA_MAP_NORMAL;
+  while (hints < end) {
+    const char *comma = memchr(hints, ',', (size_t) (end - hints));
+    size_t idx, hintlen = (size_t) ((comma ? comma : end) - hints);
+
+    for (idx = 0; idx < sizeof fa_mmap_policy_names /
+                        sizeof fa_mmap_policy_names[0]; idx++) {
+      if (strlen(fa_mmap_policy_names[idx].name) == hintlen &&
+          strncmp(fa_mmap_policy_names[idx].name, hints, hintlen) == 0) {
+        *policy |= (unsigned int) fa_mmap_policy_names[idx].policy;
+        break;
+      }
+    }
+    if (idx == sizeof fa_mmap_policy_names / sizeof fa_mmap_policy_names[0])
+      return false;
+    hints += hintlen + 1;
+  }
+  return true;
+}
+
+unsigned int gt_fa_mmap_policy_for_suffix(const char *suffix,
+                                          unsigned int default_policy)
+{
+  const char *env, *entry, *end;
+  unsigned int policy = default_policy;
+  bool found = false;
+
+  gt_assert(fa && suffix);
+  if (!(env = getenv("GT_MMAP_POLICY")))
+    return default_policy;
+  if (*suffix == '.')
+    suffix++;
+  for (entry = env; *entry != '\0'; entry = *end ? end + 1 : end) {
+    const char *equal;
+    size_t keylen;
+    unsigned int entrypolicy;
+
+    if (!(end = strchr(entry, ';')))
+      end = entry + strlen(entry);
+    if (end == entry)
+      continue;
+    if (!(equal = memchr(entry, '=', (size_t) (end - entry))) ||
+        !fa_mmap_parse_hints(equal + 1, (size_t) (end - equal - 1),
+                             &entrypolicy)) {
+      /* warn only once, the variable is consulted for every mapped table */
+      gt_mutex_lock(fa->mmap_mutex);
+      if (!fa->mmap_policy_warned) {
+        gt_warning("ignoring malformed entry \"%.*s\" in GT_MMAP_POLICY",
+                   (int) (end - entry), entry);
+        fa->mmap_policy_warned = true;
+      }
+      gt_mutex_unlock(fa->mmap_mutex);
+      continue;
+    }
+    keylen = (size_t) (equal - entry);
+    if (keylen == strlen(suffix) && strncmp(entry, suffix, keylen) == 0) {
+      /* an entry for the suffix itself takes precedence over "*" */
+      policy = entrypolicy;
+      found = true;
+    }
+    else if (!found && keylen == (size_t) 1 && *entry == '*')
+      policy = entrypolicy;
+  }
+  return policy;
+}
+
+void gt_fa_mmap_apply_policy_for_suffix(void *addr, const char *suffix,
+                                        unsigned int default_policy)
+{
+  gt_fa_mmap_apply_policy(addr, gt_fa_mmap_policy_for_suffix(suffix,
+                                                             default_policy));
+}
+
 void* gt_fa_mmap_read_with_suffix_func(const char *path, const char *suffix,
                                        size_t *len, const char *src_file,
                                        int src_line, GtError *err)
@@ -822,6 +1107,70 @@ void gt_fa_show_space_peak(FILE *fp)
           (double) fa->max_size / (1 << 20));
 }
 
+void gt_fa_enable_mmap_cache(void)
+{
+  gt_assert(fa);
+#ifndef _WIN32
+  gt_mutex_lock(fa->mmap_mutex);
+  fa->mmap_cache = true;
+  gt_mutex_unlock(fa->mmap_mutex);
+#endif
+}
+
+static int collect_idle_cached_map(GT_UNUSED void *key, void *value,
+                                   void *data, GT_UNUSED GtError *err)
+{
+  gt_assert(value && data);
+#ifndef _WIN32
+  {
+    FAMapInfo *mapinfo = gt_hashmap_get(fa->memory_maps, value);
+    gt_assert(mapinfo);
+    mapinfo->cached = false;
+    if (mapinfo->references == 0)
+      gt_array_add((GtArray*) data, value);
+  }
+#endif
+  return 0;
+}
+
+void gt_fa_disable_mmap_cache(void)
+{
+  GtArray *idle;
+  GtUword idx;
+  GT_UNUSED int had_err;
+  gt_assert(fa);
+  idle = gt_array_new(sizeof (void*));
+  gt_mutex_lock(fa->mmap_mutex);
+  fa->mmap_cache = false;
+  had_err = gt_hashmap_foreach(fa->cached_maps, collect_idle_cached_map, idle,
+                               NULL);
+  gt_assert(!had_err); /* cannot happen, collect_idle_cached_map() is sane */
+  gt_hashmap_reset(fa->cached_maps);
+  gt_mutex_unlock(fa->mmap_mutex);
+  for (idx = 0; idx < gt_array_size(idle); idx++)
+    gt_fa_xmunmap(*(void**) gt_array_get(idle, idx));
+  gt_array_delete(idle);
+}
+
+static int add_cached_map_path(void *key, GT_UNUSED void *value, void *data,
+                               GT_UNUSED GtError *err)
+{
+  gt_assert(key && data);
+  gt_str_array_add_cstr((GtStrArray*) data, (const char*) key);
+  return 0;
+}
+
+void gt_fa_mmap_cache_paths(GtStrArray *paths)
+{
+  GT_UNUSED int had_err;
+  gt_assert(fa && paths);
+  gt_mutex_lock(fa->mmap_mutex);
+  had_err = gt_hashmap_foreach(fa->cached_maps, add_cached_map_path, paths,
+                               NULL);
+  gt_assert(!had_err); /* cannot happen, add_cached_map_path() is sane */
+  gt_mutex_unlock(fa->mmap_mutex);
+}
+
 void gt_fa_clean(void)
 {
   if (!fa) return;
@@ -829,6 +1178,7 @@ void gt_fa_clean(void)
   gt_mutex_delete(fa->mmap_mutex);
   gt_hashmap_delete(fa->file_pointer);
   gt_hashmap_delete(fa->memory_maps);
+  gt_hashmap_delete(fa->cached_maps);
   gt_free(fa);
   fa = NULL;
 }
@@ -25,6 +25,7 @@
 #include <zlib.h>
 #include "core/error_api.h"
 #include "core/str.h"
+#include "core/str_array.h"
 
 /* the file allocator module */
 
@@ -166,6 +167,47 @@ void*   gt_fa_mmap_check_size_with_suffix(const char *path, const char *suffix,
                                           GtUword expectedunits,
                                           size_t sizeofunit, GtError *err);
 
+/* access hints for memory maps, may be combined by bitwise or */
+typedef enum {
+  GT_FA_MAP_NORMAL     = 0,
+  GT_FA_MAP_SEQUENTIAL = 1U,      /* data is read in ascending order */
+  GT_FA_MAP_RANDOM     = 1U << 1, /* data is read in no particular order */
+  GT_FA_MAP_WILLNEED   = 1U << 2, /* start reading ahead in the background */
+  GT_FA_MAP_HUGEPAGES  = 1U << 3, /* back the map by transparent huge pages */
+  GT_FA_MAP_POPULATE   = 1U << 4, /* fault in all pages before returning */
+  GT_FA_MAP_INTERLEAVE = 1U << 5  /* spread the pages over all NUMA nodes,
+                                     implies <GT_FA_MAP_POPULATE> */
+} GtFaMapPolicy;
+
+/* Apply the bitwise or of <GtFaMapPolicy> values given by <policy> to the
+   memory map starting at <addr>, which must have been returned by one of the
+   gt_fa_mmap functions. All hints are advisory, those not supported by the
+   platform are silently ignored. */
+void    gt_fa_mmap_apply_policy(void *addr, unsigned int policy);
+/* Return the policy for memory maps of files ending with <suffix>. This is
+   <default_policy> unless the environment variable GT_MMAP_POLICY contains an
+   entry for <suffix> (or an entry for all suffixes, denoted by "*"). Entries
+   are separated by ';' and have the form <suffix>=<hint>[,<hint>...], where
+   <suffix> is given without its leading '.' and <hint> is one of "normal",
+   "sequential", "random", "willneed", "hugepages", "populate" or
+   "interleave". Example: GT_MMAP_POLICY="suf=random,hugepages;lcp=sequential"
+*/
+unsigned int gt_fa_mmap_policy_for_suffix(const char *suffix,
+                                          unsigned int default_policy);
+/* Shorthand for applying the policy for <suffix> to the map at <addr>. */
+void    gt_fa_mmap_apply_policy_for_suffix(void *addr, const char *suffix,
+                                           unsigned int default_policy);
+
+/* Keep read-only memory maps of whole files mapped after <gt_fa_xmunmap()>
+   and hand them out again if the same unchanged file is mapped later. Used by
+   long running processes to avoid mapping and faulting in index tables over
+   and over again. */
+void    gt_fa_enable_mmap_cache(void);
+/* Stop caching memory maps and unmap all cached maps not in use. */
+void    gt_fa_disable_mmap_cache(void);
+/* Add the paths of all files with a cached memory map to <paths>. */
+void    gt_fa_mmap_cache_paths(GtStrArray *paths);
+
 /* check if all allocated file pointer have been released, prints to stderr */
 int     gt_fa_check_fptr_leak(void);
 /* check if all allocated memory maps have been freed, prints to stderr */
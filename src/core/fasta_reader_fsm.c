@@ -45,6 +45,8 @@ static int gt_fasta_reader_fsm_run(GtFastaReader *fasta_reader,
                                    void *data, GtError *err)
 {
   GtFastaReaderFSM *fr = gt_fasta_reader_fsm_cast(fasta_reader);
+  const char *span = NULL;
+  size_t spanlength = 0, spanpos = 0;
   unsigned char cc;
   GtFastaReaderState state = EXPECTING_SEPARATOR;
   GtUword sequence_length = 0, line_counter = 1;
@@ -65,8 +67,16 @@ static int gt_fasta_reader_fsm_run(GtFastaReader *fasta_reader,
   if (fr->sequence_file)
     gt_file_xrewind(fr->sequence_file);
 
-  /* reading */
-  while (!had_err && gt_file_xread(fr->sequence_file, &cc, 1) != 0) {
+  /* reading, the characters are taken span by span from the buffer of the
+     sequence file */
+  while (!had_err) {
+    if (spanpos == spanlength) {
+      span = gt_file_xread_span(fr->sequence_file, &spanlength);
+      if (!span)
+        break;
+      spanpos = 0;
+    }
+    cc = (unsigned char) span[spanpos++];
     switch (state) {
       case EXPECTING_SEPARATOR:
         if (cc != GT_FASTA_SEPARATOR) {
@@ -210,7 +220,9 @@ GtFastaReader* gt_fasta_reader_fsm_new(GtStr *sequence_filename)
     gt_fasta_reader_fsm->sequence_file =
       gt_file_xopen(gt_str_get(sequence_filename), "r");
   }
-  else
+  else {
     gt_fasta_reader_fsm->sequence_filename = gt_str_new_cstr("stdin");
+    gt_fasta_reader_fsm->sequence_file = gt_file_xopen(NULL, "r");
+  }
   return fr;
 }
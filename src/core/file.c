@@ -15,8 +15,11 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
+#include "core/bgzf.h"
 #include "core/cstr_api.h"
 #include "core/fa.h"
 #include "core/ma.h"
@@ -24,19 +27,28 @@
 #include "core/xbzlib.h"
 #include "core/xzlib.h"
 
+/* size of the buffer used for reading from a GtFile */
+#define GT_FILE_BUFSIZE (1 << 16)
+
 struct GtFile {
   GtFileMode mode;
   GtUword reference_count;
   union {
-    FILE *file;
+    FILE *file;     /* also the underlying file of a BGZF reader or writer */
     gzFile gzfile;
     BZFILE *bzfile;
   } fileptr;
+  GtBgzfReader *bgzfreader;
+  GtBgzfWriter *bgzfwriter;
   char *orig_path,
        *orig_mode,
-       unget_char;
+       unget_char,
+       *buf;        /* read ahead characters, allocated on the first read */
+  size_t bufpos,    /* position of the next unread character in <buf> */
+         buflen;    /* number of characters in <buf> */
   bool is_stdin,
-       unget_used;
+       unget_used,
+       unbuffered;  /* the file pointer is shared with the caller */
 };
 
 GtFileMode gt_file_mode_determine(const char *path)
@@ -84,6 +96,61 @@ size_t gt_file_basename_length(const char *path)
   return path_length;
 }
 
+/* Returns false if <path> exists and is not a regular file, e.g. a named
+   pipe, which cannot be probed for the BGZF format and read again. */
+static bool file_is_seekable(const char *path)
+{
+  struct stat sb;
+  return stat(path, &sb) != 0 || S_ISREG(sb.st_mode);
+}
+
+/* Opens the gzip compressed file <path> for <file>. Regular files in the
+   BGZF format are read and, if <bgzf> is true, files are written block by
+   block, such that the blocks can be decompressed and compressed by several
+   threads. Other gzip files are read and written with zlib. If <err> is
+   <NULL>, the program terminates if <path> cannot be opened. */
+static int file_gzopen(GtFile *file, const char *path, const char *mode,
+                       bool bgzf, GtError *err)
+{
+  FILE *fp;
+  if ((mode[0] == 'r' && !file_is_seekable(path)) ||
+      (mode[0] != 'r' && !bgzf)) {
+    file->fileptr.gzfile = err ? gt_fa_gzopen(path, mode, err)
+                               : gt_fa_xgzopen(path, mode);
+    return file->fileptr.gzfile ? 0 : -1;
+  }
+  if (mode[0] == 'r') {
+    fp = err ? gt_fa_fopen(path, "rb", err) : gt_fa_xfopen(path, "rb");
+    if (!fp)
+      return -1;
+    if (gt_bgzf_is_bgzf(fp)) {
+      file->fileptr.file = fp;
+      file->bgzfreader = gt_bgzf_reader_new(fp);
+      return 0;
+    }
+    gt_fa_fclose(fp);
+    file->fileptr.gzfile = err ? gt_fa_gzopen(path, mode, err)
+                               : gt_fa_xgzopen(path, mode);
+    return file->fileptr.gzfile ? 0 : -1;
+  }
+  else {
+    const char *level;
+    gt_assert(mode[0] == 'w' || mode[0] == 'a');
+    fp = err ? gt_fa_fopen(path, mode[0] == 'w' ? "wb" : "ab", err)
+             : gt_fa_xfopen(path, mode[0] == 'w' ? "wb" : "ab");
+    if (!fp)
+      return -1;
+    /* the compression level may be given in the mode as for gzopen() */
+    for (level = mode; *level != '\0' && !isdigit((int) *level); level++)
+      /* Nothing */ ;
+    file->fileptr.file = fp;
+    file->bgzfwriter = gt_bgzf_writer_new(fp, *level != '\0'
+                                              ? *level - '0'
+                                              : Z_DEFAULT_COMPRESSION);
+    return 0;
+  }
+}
+
 GtFile* gt_file_new(const char *path, const char *mode, GtError *err)
 {
   gt_error_check(err);
@@ -117,8 +184,7 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
         }
         break;
       case GT_FILE_MODE_GZIP:
-        file->fileptr.gzfile = gt_fa_gzopen(path, mode, err);
-        if (!file->fileptr.gzfile) {
+        if (file_gzopen(file, path, mode, false, err)) {
           gt_file_delete_without_handle(file);
           return NULL;
         }
@@ -143,8 +209,8 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
   return file;
 }
 
-GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
-                                const char *mode)
+static GtFile* file_xopen_generic(GtFileMode file_mode, const char *path,
+                                  const char *mode, bool bgzf)
 {
   GtFile *file;
   gt_assert(mode);
@@ -157,7 +223,7 @@ GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
         file->fileptr.file = gt_fa_xfopen(path, mode);
         break;
       case GT_FILE_MODE_GZIP:
-        file->fileptr.gzfile = gt_fa_xgzopen(path, mode);
+        (void) file_gzopen(file, path, mode, bgzf, NULL);
         break;
       case GT_FILE_MODE_BZIP2:
         file->fileptr.bzfile = gt_fa_xbzopen(path, mode);
@@ -175,6 +241,19 @@ GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
   return file;
 }
 
+GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
+                                const char *mode)
+{
+  gt_assert(mode);
+  return file_xopen_generic(file_mode, path, mode, false);
+}
+
+GtFile* gt_file_xopen_bgzf(const char *path, const char *mode)
+{
+  gt_assert(path && mode);
+  return file_xopen_generic(GT_FILE_MODE_GZIP, path, mode, true);
+}
+
 GtFile* gt_file_xopen(const char *path, const char *mode)
 {
   gt_assert(mode);
@@ -189,6 +268,9 @@ GtFile* gt_file_new_from_fileptr(FILE *fp)
   file->reference_count = 0;
   file->mode = GT_FILE_MODE_UNCOMPRESSED;
   file->fileptr.file = fp;
+  /* the caller may continue to read from <fp> directly, so reading ahead
+     is not possible */
+  file->unbuffered = true;
   return file;
 }
 
@@ -198,6 +280,74 @@ GtFileMode gt_file_mode(const GtFile *file)
   return file->mode;
 }
 
+static int file_bgzf_xread(GtBgzfReader *reader, void *buf, size_t nbytes)
+{
+  GtError *err = gt_error_new();
+  int rval;
+  if ((rval = gt_bgzf_reader_read(reader, buf, nbytes, err)) == -1) {
+    fprintf(stderr, "%s\n", gt_error_get(err));
+    exit(EXIT_FAILURE);
+  }
+  gt_error_delete(err);
+  return rval;
+}
+
+static void file_bgzf_xwrite(GtBgzfWriter *writer, const void *buf,
+                             size_t nbytes)
+{
+  GtError *err = gt_error_new();
+  if (gt_bgzf_writer_write(writer, buf, nbytes, err)) {
+    fprintf(stderr, "%s\n", gt_error_get(err));
+    exit(EXIT_FAILURE);
+  }
+  gt_error_delete(err);
+}
+
+static void file_bgzf_xfinish(GtBgzfWriter *writer)
+{
+  GtError *err = gt_error_new();
+  if (gt_bgzf_writer_finish(writer, err)) {
+    fprintf(stderr, "%s\n", gt_error_get(err));
+    exit(EXIT_FAILURE);
+  }
+  gt_error_delete(err);
+}
+
+static int file_xread_unbuffered(GtFile *file, void *buf, size_t nbytes)
+{
+  int rval = -1;
+  switch (file->mode) {
+    case GT_FILE_MODE_UNCOMPRESSED:
+      rval = gt_xfread(buf, 1, nbytes, file->fileptr.file);
+      break;
+    case GT_FILE_MODE_GZIP:
+      if (file->bgzfreader)
+        rval = file_bgzf_xread(file->bgzfreader, buf, nbytes);
+      else
+        rval = gt_xgzread(file->fileptr.gzfile, buf, nbytes);
+      break;
+    case GT_FILE_MODE_BZIP2:
+      rval = gt_xbzread(file->fileptr.bzfile, buf, nbytes);
+      break;
+    default: gt_assert(0);
+  }
+  return rval;
+}
+
+/* Refills the buffer of <file>, which must be empty, and returns the number
+   of characters read. */
+static size_t file_refill(GtFile *file)
+{
+  int rval;
+  gt_assert(file && !file->unbuffered && file->bufpos == file->buflen);
+  if (!file->buf)
+    file->buf = gt_malloc(GT_FILE_BUFSIZE * sizeof (char));
+  rval = file_xread_unbuffered(file, file->buf, GT_FILE_BUFSIZE);
+  file->bufpos = 0;
+  file->buflen = rval > 0 ? (size_t) rval : 0;
+  return file->buflen;
+}
+
 int gt_file_xfgetc(GtFile *file)
 {
   int c = -1;
@@ -206,26 +356,66 @@ int gt_file_xfgetc(GtFile *file)
       c = file->unget_char;
       file->unget_used = false;
     }
-    else {
-      switch (file->mode) {
-        case GT_FILE_MODE_UNCOMPRESSED:
-          c = gt_xfgetc(file->fileptr.file);
-          break;
-        case GT_FILE_MODE_GZIP:
-          c = gt_xgzfgetc(file->fileptr.gzfile);
-          break;
-        case GT_FILE_MODE_BZIP2:
-          c = gt_xbzfgetc(file->fileptr.bzfile);
-          break;
-        default: gt_assert(0);
-      }
-    }
+    else if (file->bufpos < file->buflen)
+      c = (unsigned char) file->buf[file->bufpos++];
+    else if (file->unbuffered)
+      c = gt_xfgetc(file->fileptr.file);
+    else if (file_refill(file))
+      c = (unsigned char) file->buf[file->bufpos++];
+    else
+      c = EOF;
   }
   else
     c = gt_xfgetc(stdin);
   return c;
 }
 
+/* Returns a span consisting of the unget character or, for an unbuffered
+   <file>, the next character. */
+static const char* file_xread_single_char(GtFile *file, size_t *length)
+{
+  if (file->unget_used)
+    file->unget_used = false;
+  else {
+    int c = gt_xfgetc(file->fileptr.file);
+    if (c == EOF)
+      return NULL;
+    file->unget_char = (char) c;
+  }
+  *length = 1;
+  return &file->unget_char;
+}
+
+const char* gt_file_xread_span(GtFile *file, size_t *length)
+{
+  const char *span;
+  gt_assert(file && length);
+  if (file->unget_used || file->unbuffered)
+    return file_xread_single_char(file, length);
+  if (file->bufpos == file->buflen && !file_refill(file))
+    return NULL;
+  span = file->buf + file->bufpos;
+  *length = file->buflen - file->bufpos;
+  file->bufpos = file->buflen;
+  return span;
+}
+
+const char* gt_file_xread_line_span(GtFile *file, size_t *length)
+{
+  const char *span, *newline;
+  gt_assert(file && length);
+  if (file->unget_used || file->unbuffered)
+    return file_xread_single_char(file, length);
+  if (file->bufpos == file->buflen && !file_refill(file))
+    return NULL;
+  span = file->buf + file->bufpos;
+  newline = memchr(span, '\n', file->buflen - file->bufpos);
+  *length = newline ? (size_t) (newline - span) + 1
+                    : file->buflen - file->bufpos;
+  file->bufpos += *length;
+  return span;
+}
+
 void gt_file_unget_char(GtFile *file, char c)
 {
   if (file) {
@@ -284,6 +474,30 @@ static int vbzprintf(BZFILE *file, const char *format, va_list va, int buflen)
   return 0; /* success */
 }
 
+static int vbgzfprintf(GtBgzfWriter *writer, const char *format, va_list va,
+                       int buflen)
+{
+  int len;
+  if (!buflen) {
+    char buf[BUFSIZ];
+    /* no buffer length given -> try static buffer */
+    len = gt_xvsnprintf(buf, sizeof (buf), format, va);
+    if (len >= BUFSIZ)
+      return len; /* unsuccessful trial -> return buffer length for next call */
+    file_bgzf_xwrite(writer, buf, (size_t) len);
+  }
+  else {
+    char *dynbuf;
+    /* buffer length given -> use dynamic buffer */
+    dynbuf = gt_malloc((buflen + 1) * sizeof (char));
+    len = gt_xvsnprintf(dynbuf, (buflen + 1) * sizeof (char), format, va);
+    gt_assert(len == buflen);
+    file_bgzf_xwrite(writer, dynbuf, (size_t) buflen);
+    gt_free(dynbuf);
+  }
+  return 0; /* success */
+}
+
 static int xvprintf(GtFile *file, const char *format, va_list va, int buflen)
 {
   int rval = 0;
@@ -296,7 +510,10 @@ static int xvprintf(GtFile *file, const char *format, va_list va, int buflen)
         gt_xvfprintf(file->fileptr.file, format, va);
         break;
       case GT_FILE_MODE_GZIP:
-        rval = vgzprintf(file->fileptr.gzfile, format, va, buflen);
+        if (file->bgzfwriter)
+          rval = vbgzfprintf(file->bgzfwriter, format, va, buflen);
+        else
+          rval = vgzprintf(file->fileptr.gzfile, format, va, buflen);
         break;
       case GT_FILE_MODE_BZIP2:
         rval = vbzprintf(file->fileptr.bzfile, format, va, buflen);
@@ -334,7 +551,12 @@ void gt_file_xfputc(int c, GtFile *file)
       gt_xfputc(c, file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzfputc(c, file->fileptr.gzfile);
+      if (file->bgzfwriter) {
+        char cc = (char) c;
+        file_bgzf_xwrite(file->bgzfwriter, &cc, (size_t) 1);
+      }
+      else
+        gt_xgzfputc(c, file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzfputc(c, file->fileptr.bzfile);
@@ -352,7 +574,10 @@ void gt_file_xfputs(const char *cstr, GtFile *file)
       gt_xfputs(cstr, file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzfputs(cstr, file->fileptr.gzfile);
+      if (file->bgzfwriter)
+        file_bgzf_xwrite(file->bgzfwriter, cstr, strlen(cstr));
+      else
+        gt_xgzfputs(cstr, file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzfputs(cstr, file->fileptr.bzfile);
@@ -365,18 +590,36 @@ int gt_file_xread(GtFile *file, void *buf, size_t nbytes)
 {
   int rval = -1;
   if (file) {
-    switch (file->mode) {
-      case GT_FILE_MODE_UNCOMPRESSED:
-        rval = gt_xfread(buf, 1, nbytes, file->fileptr.file);
-        break;
-      case GT_FILE_MODE_GZIP:
-        rval = gt_xgzread(file->fileptr.gzfile, buf, nbytes);
-        break;
-      case GT_FILE_MODE_BZIP2:
-        rval = gt_xbzread(file->fileptr.bzfile, buf, nbytes);
-        break;
-      default: gt_assert(0);
+    char *cbuf = buf;
+    size_t nread = 0, available;
+    if (file->unget_used && nbytes > 0) {
+      cbuf[nread++] = file->unget_char;
+      file->unget_used = false;
     }
+    available = file->buflen - file->bufpos;
+    if (available > 0 && nread < nbytes) {
+      if (available > nbytes - nread)
+        available = nbytes - nread;
+      memcpy(cbuf + nread, file->buf + file->bufpos, available);
+      file->bufpos += available;
+      nread += available;
+    }
+    if (nread < nbytes) {
+      /* large reads bypass the buffer */
+      if (file->unbuffered || nbytes - nread >= GT_FILE_BUFSIZE) {
+        rval = file_xread_unbuffered(file, cbuf + nread, nbytes - nread);
+        if (rval > 0)
+          nread += rval;
+      }
+      else if ((available = file_refill(file)) > 0) {
+        if (available > nbytes - nread)
+          available = nbytes - nread;
+        memcpy(cbuf + nread, file->buf, available);
+        file->bufpos = available;
+        nread += available;
+      }
+    }
+    rval = (int) nread;
   }
   else
     rval = gt_xfread(buf, 1, nbytes, stdin);
@@ -394,7 +637,10 @@ void gt_file_xwrite(GtFile *file, void *buf, size_t nbytes)
       gt_xfwrite(buf, 1, nbytes, file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzwrite(file->fileptr.gzfile, buf, nbytes);
+      if (file->bgzfwriter)
+        file_bgzf_xwrite(file->bgzfwriter, buf, nbytes);
+      else
+        gt_xgzwrite(file->fileptr.gzfile, buf, nbytes);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzwrite(file->fileptr.bzfile, buf, nbytes);
@@ -406,12 +652,16 @@ void gt_file_xwrite(GtFile *file, void *buf, size_t nbytes)
 void gt_file_xrewind(GtFile *file)
 {
   gt_assert(file);
+  file->bufpos = file->buflen = 0;
   switch (file->mode) {
     case GT_FILE_MODE_UNCOMPRESSED:
       rewind(file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzrewind(file->fileptr.gzfile);
+      if (file->bgzfreader)
+        gt_bgzf_reader_rewind(file->bgzfreader);
+      else
+        gt_xgzrewind(file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzrewind(&file->fileptr.bzfile, file->orig_path, file->orig_mode);
@@ -425,6 +675,7 @@ void gt_file_delete_without_handle(GtFile *file)
   if (!file) return;
   gt_free(file->orig_path);
   gt_free(file->orig_mode);
+  gt_free(file->buf);
   gt_free(file);
 }
 
@@ -441,7 +692,15 @@ void gt_file_delete(GtFile *file)
           gt_fa_fclose(file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-        gt_fa_gzclose(file->fileptr.gzfile);
+        if (file->bgzfreader || file->bgzfwriter) {
+          if (file->bgzfwriter)
+            file_bgzf_xfinish(file->bgzfwriter);
+          gt_bgzf_reader_delete(file->bgzfreader);
+          gt_bgzf_writer_delete(file->bgzfwriter);
+          gt_fa_fclose(file->fileptr.file);
+        }
+        else
+          gt_fa_gzclose(file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
         gt_fa_bzclose(file->fileptr.bzfile);
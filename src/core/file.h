@@ -56,6 +56,12 @@ GtFile*     gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
    automatically via gt_file_mode_determine(path). */
 GtFile*     gt_file_xopen(const char *path, const char *mode);
 
+/* Like <gt_file_xopen_file_mode()> with <GT_FILE_MODE_GZIP>, but a file
+   opened for writing is written in the BGZF format, whose blocks are
+   compressed by <gt_jobs> threads. Aborts if the file <path> could not be
+   opened. */
+GtFile*     gt_file_xopen_bgzf(const char *path, const char *mode);
+
 /* Returns the mode of the given <file>. */
 GtFileMode  gt_file_mode(const GtFile *file);
 
@@ -63,4 +69,18 @@ GtFileMode  gt_file_mode(const GtFile *file);
    Can only be used once at a time. */
 void        gt_file_unget_char(GtFile *file, char c);
 
+/* Returns a pointer to the characters of <file> which have been read ahead
+   but not consumed yet and stores their number in <length>. If there are no
+   such characters, the buffer of <file> is refilled first. Returns <NULL> if
+   the end of <file> has been reached. The returned characters are consumed
+   and stay valid until the next read operation on <file>. This allows to
+   scan a file without a function call per character. <file> must not be
+   <NULL>. Files created with <gt_file_new_from_fileptr()> are not read
+   ahead, for them the spans consist of single characters. */
+const char* gt_file_xread_span(GtFile *file, size_t *length);
+
+/* Like <gt_file_xread_span()>, but the returned characters end with the
+   first newline character among them, if there is one. */
+const char* gt_file_xread_line_span(GtFile *file, size_t *length);
+
 #endif
@@ -15,6 +15,7 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include "core/cstr_api.h"
 #include "core/fa.h"
 #include "core/fileutils_api.h"
 #include "core/hashmap_api.h"
@@ -160,6 +161,25 @@ GtMD5Tab* gt_md5_tab_new_from_cache_file(const char *cache_file,
   return md5_tab;
 }
 
+GtMD5Tab* gt_md5_tab_new_from_tabs(GtMD5Tab **md5_tabs,
+                                   GtUword num_of_md5_tabs)
+{
+  GtMD5Tab *md5_tab;
+  GtUword i, j, k = 0;
+  gt_assert(md5_tabs);
+  md5_tab = gt_calloc(1, sizeof *md5_tab);
+  for (i = 0; i < num_of_md5_tabs; i++)
+    md5_tab->num_of_md5s += gt_md5_tab_size(md5_tabs[i]);
+  md5_tab->md5_fingerprints = gt_calloc(md5_tab->num_of_md5s, sizeof (char*));
+  for (i = 0; i < num_of_md5_tabs; i++) {
+    for (j = 0; j < gt_md5_tab_size(md5_tabs[i]); j++)
+      md5_tab->md5_fingerprints[k++] = gt_cstr_dup(gt_md5_tab_get(md5_tabs[i],
+                                                                  j));
+  }
+  md5_tab->owns_md5s = true;
+  return md5_tab;
+}
+
 GtMD5Tab* gt_md5_tab_ref(GtMD5Tab *md5_tab)
 {
   if (!md5_tab) return NULL;
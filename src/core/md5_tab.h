@@ -51,6 +51,11 @@ GtMD5Tab*     gt_md5_tab_new_from_cache_file(const char *cache_file,
                                              bool use_file_locking,
                                              GtError *err);
 
+/* Create a new MD5 table object containing the MD5 sums of the
+   <num_of_md5_tabs> many tables <md5_tabs>, one table after the other. */
+GtMD5Tab*     gt_md5_tab_new_from_tabs(GtMD5Tab **md5_tabs,
+                                       GtUword num_of_md5_tabs);
+
 GtMD5Tab*     gt_md5_tab_ref(GtMD5Tab *md5_tab);
 void          gt_md5_tab_disable_file_locking(GtMD5Tab *md5_tab);
 /* Return the MD5 sum for sequence <index>. */
@@ -25,6 +25,7 @@
 struct GtOutputFileInfo {
   GtStr *output_filename;
   bool gzip,
+       bgzip,
        bzip2,
        force;
   GtFile **outfp;
@@ -47,8 +48,9 @@ static int determine_outfp(void *data, GtError *err)
   if (!gt_str_length(ofi->output_filename))
     *ofi->outfp = NULL; /* no output file given -> use stdout */
   else { /* outputfile given -> create generic file pointer */
-    gt_assert(!(ofi->gzip && ofi->bzip2));
-    if (ofi->gzip)
+    gt_assert(!(ofi->gzip && ofi->bzip2) && !(ofi->bgzip && ofi->gzip) &&
+              !(ofi->bgzip && ofi->bzip2));
+    if (ofi->gzip || ofi->bgzip)
       file_mode = GT_FILE_MODE_GZIP;
     else if (ofi->bzip2)
       file_mode = GT_FILE_MODE_BZIP2;
@@ -70,7 +72,11 @@ static int determine_outfp(void *data, GtError *err)
                      GT_FORCE_OPT_CSTR);
         had_err = -1;
     }
-    if (!had_err) {
+    if (!had_err && ofi->bgzip) {
+      *ofi->outfp = gt_file_xopen_bgzf(gt_str_get(ofi->output_filename), "w");
+      gt_assert(*ofi->outfp);
+    }
+    else if (!had_err) {
       *ofi->outfp = gt_file_xopen_file_mode(file_mode,
                                             gt_str_get(ofi->output_filename),
                                             "w");
@@ -83,7 +89,7 @@ static int determine_outfp(void *data, GtError *err)
 void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
                                           GtOptionParser *op, GtFile **outfp)
 {
-  GtOption *opto, *optgzip, *optbzip2, *optforce;
+  GtOption *opto, *optgzip, *optbgzip, *optbzip2, *optforce;
   gt_assert(outfp && ofi);
   ofi->outfp = outfp;
   /* register option -o */
@@ -94,6 +100,12 @@ void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
   optgzip = gt_option_new_bool("gzip", "write gzip compressed output file",
                                &ofi->gzip, false);
   gt_option_parser_add_option(op, optgzip);
+  /* register option -bgzip */
+  optbgzip = gt_option_new_bool("bgzip", "write gzip compressed output file "
+                                "in the blocked BGZF format, which is "
+                                "compressed with several threads (see -j)",
+                                &ofi->bgzip, false);
+  gt_option_parser_add_option(op, optbgzip);
   /* register option -bzip2 */
   optbzip2 = gt_option_new_bool("bzip2", "write bzip2 compressed output file",
                                 &ofi->bzip2, false);
@@ -105,8 +117,11 @@ void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
   gt_option_parser_add_option(op, optforce);
   /* options -gzip and -bzip2 exclude each other */
   gt_option_exclude(optgzip, optbzip2);
+  gt_option_exclude(optbgzip, optgzip);
+  gt_option_exclude(optbgzip, optbzip2);
   /* option implications */
   gt_option_imply(optgzip, opto);
+  gt_option_imply(optbgzip, opto);
   gt_option_imply(optbzip2, opto);
   gt_option_imply(optforce, opto);
   /* set hook function to determine <outfp> */
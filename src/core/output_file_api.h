@@ -28,7 +28,7 @@ typedef struct GtOutputFileInfo GtOutputFileInfo;
 
 /* Create a new <GtOutputFileInfo> object. */
 GtOutputFileInfo* gt_output_file_info_new(void);
-/* Registers the options `-o', `-gzip', `-bzip2' and `-force' in
+/* Registers the options `-o', `-gzip', `-bgzip', `-bzip2' and `-force' in
    <option_parser>. Options chosen during option parsing will be stored in
    <output_file_info> and the output file will be accessible using <*outfp>.
    If no option is given, default <*outfp> will use stdout.
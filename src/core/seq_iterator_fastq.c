@@ -15,10 +15,12 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
 #include "core/chardef.h"
 #include "core/class_alloc_lock.h"
 #include "core/colorspace.h"
 #include "core/cstr_api.h"
+#include "core/fa.h"
 #include "core/file.h"
 #include "core/filelengthvalues.h"
 #include "core/seq_iterator_fastq_api.h"
@@ -43,6 +45,8 @@ struct GtSeqIteratorFastQ
         *qualsbuffer;
   GtStr *qdescbuffer;
   GtFile *curfile;
+  void *mappedinput;
+  const unsigned char *inptr;
   GtUword *chardisttab,
                 currentfillpos,
                 currentinpos,
@@ -73,17 +77,48 @@ static inline int fastq_buf_getchar(GtSeqIteratorFastQ *seqit)
     return seqit->ungetchar;
   } else {
     if (seqit->currentinpos >= seqit->currentfillpos) {
+      if (seqit->mappedinput != NULL)
+        return EOF;
       seqit->currentfillpos = gt_file_xread(seqit->curfile, seqit->inbuf,
                                              GT_SEQIT_QUAL_INBUFSIZE);
       if (seqit->currentfillpos == 0)
          return EOF;
       seqit->currentinpos = 0;
     }
-    seqit->ungetchar = seqit->inbuf[seqit->currentinpos++];
+    seqit->ungetchar = seqit->inptr[seqit->currentinpos++];
     return seqit->ungetchar;
   }
 }
 
+/* Uncompressed files are mapped into memory and scanned in place, all other
+   files are read into <inbuf>. */
+static void fastq_open_file(GtSeqIteratorFastQ *seqit, const char *filename)
+{
+  size_t len = 0;
+  gt_assert(seqit->curfile == NULL && seqit->mappedinput == NULL);
+  seqit->currentinpos = 0;
+  seqit->currentfillpos = 0;
+  if (gt_file_mode_determine(filename) == GT_FILE_MODE_UNCOMPRESSED)
+    seqit->mappedinput = gt_fa_mmap_read(filename, &len, NULL);
+  if (seqit->mappedinput != NULL) {
+    seqit->inptr = seqit->mappedinput;
+    seqit->currentfillpos = (GtUword) len;
+  } else {
+    seqit->inptr = seqit->inbuf;
+    seqit->curfile = gt_file_xopen(filename, "r");
+  }
+}
+
+static void fastq_close_file(GtSeqIteratorFastQ *seqit)
+{
+  if (seqit->mappedinput != NULL) {
+    gt_fa_xmunmap(seqit->mappedinput);
+    seqit->mappedinput = NULL;
+  }
+  gt_file_delete(seqit->curfile);
+  seqit->curfile = NULL;
+}
+
 static inline void fastq_buf_ungetchar(GtSeqIteratorFastQ *seqit)
 {
   gt_assert(!seqit->use_ungetchar);
@@ -110,6 +145,21 @@ static inline int parse_fastq_seqname(GtSeqIteratorFastQ *seqit,
                       seqit->curline);
     return -2;
   }
+  if (seqit->mappedinput != NULL) {
+    /* copy the name directly from the mapped line */
+    const unsigned char *start = seqit->inptr + seqit->currentinpos,
+                        *newline = memchr(start, GT_FASTQ_NEWLINESYMBOL,
+                                          (size_t) (seqit->currentfillpos
+                                                    - seqit->currentinpos));
+    if (newline != NULL) {
+      GtUword namelen = (GtUword) (newline - start);
+      gt_str_append_cstr_nt(buffer, (const char*) start, namelen);
+      seqit->currentinpos += namelen + 1;
+      seqit->currentread += namelen + 1;
+      seqit->curline++;
+      return 0;
+    }
+  }
   while (currentchar != GT_FASTQ_NEWLINESYMBOL) {
     if (!firstsymbol)
       gt_str_append_char(buffer, currentchar);
@@ -380,8 +430,8 @@ int gt_seq_iterator_fastq_next(GtSeqIterator *seqit,
       if (seqitf->filenum+1 < gt_str_array_size(seqitf->filenametab)) {
         const char *filename;
         filename = gt_str_array_get(seqitf->filenametab, ++seqitf->filenum);
-        gt_file_delete(seqitf->curfile);
-        seqitf->curfile = gt_file_xopen(filename, "r");
+        fastq_close_file(seqitf);
+        fastq_open_file(seqitf, filename);
         seqitf->curline = 1;
         /* get first entry from next file*/
         errstatus = parse_fastq_block(seqitf, err);
@@ -426,8 +476,7 @@ void gt_seq_iterator_fastq_delete(GtSeqIterator *si)
   gt_str_delete(seqit->sequencebuffer);
   gt_str_delete(seqit->qualsbuffer);
   gt_str_delete(seqit->descbuffer);
-  if (seqit->curfile)
-    gt_file_delete(seqit->curfile);
+  fastq_close_file(seqit);
   seqit->currentread = seqit->maxread;
 }
 
@@ -458,7 +507,7 @@ static GtSeqIterator* seqiterator_fastq_new_gen(const GtStrArray *filenametab,
   seqit = gt_seq_iterator_create(gt_seq_iterator_fastq_class());
   seqitf = gt_seq_iterator_fastq_cast(seqit);
   seqitf->qdescbuffer = gt_str_new();
-  seqitf->curfile = gt_file_xopen(gt_str_array_get(filenametab, 0), "r");
+  fastq_open_file(seqitf, gt_str_array_get(filenametab, 0));
   seqitf->filenametab = filenametab;
   seqitf->curline = 1;
   seqitf->sequencebuffer = gt_str_new();
@@ -26,9 +26,38 @@
 #include "core/sequence_buffer_fastq.h"
 #include "core/sequence_buffer_gb.h"
 #include "core/sequence_buffer_inline.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 
+/* number of output buffers parsed ahead in one run of the reading thread */
+#define GT_SEQUENCE_BUFFER_BATCHBLOCKS 32
+
+typedef struct {
+  unsigned char outbuf[OUTBUFSIZE],
+                outbuforig[OUTBUFSIZE];
+  GtUword nextfree,
+          filenum;
+  GtDescBuffer *descbuffer;
+} GtSequenceBufferBlock;
+
+/* The blocks form two batches: while the reader consumes one batch, the
+   reading thread parses the input into the other one. */
+struct GtSequenceBufferReadahead {
+  GtSequenceBufferBlock *blocks,
+                        *current;
+  GtUword numofblocks[2],
+          blocknum,
+          nextread;
+  int had_err[2];
+  GtError *err[2];
+  unsigned int readbatch,
+               fillbatch;
+  bool started;
+  GtDescBuffer *descptr;
+  GtThread *thread;
+};
+
 GtSequenceBuffer*
 gt_sequence_buffer_create(const GtSequenceBufferClass *sic)
 {
@@ -37,9 +66,67 @@ gt_sequence_buffer_create(const GtSequenceBufferClass *sic)
   si = gt_calloc(1, sic->size);
   si->c_class = sic;
   si->pvt = gt_calloc(1, sizeof (GtSequenceBufferMembers));
+  si->pvt->inptr = si->pvt->inbuf;
+  si->pvt->outbuf = si->pvt->outbufspace;
+  si->pvt->outbuforig = si->pvt->outbuforigspace;
   return si;
 }
 
+void gt_sequence_buffer_open_input(GtSequenceBuffer *sb)
+{
+  GtSequenceBufferMembers *pvt;
+  const char *filename;
+  size_t len = 0;
+  gt_assert(sb && sb->pvt);
+  pvt = sb->pvt;
+  gt_assert(pvt->inputstream == NULL && pvt->mappedinput == NULL);
+  filename = gt_str_array_get(pvt->filenametab, (GtUword) pvt->filenum);
+  pvt->currentinpos = 0;
+  pvt->currentfillpos = 0;
+  /* empty files and files which cannot be mapped are read as before */
+  if (gt_file_mode_determine(filename) == GT_FILE_MODE_UNCOMPRESSED)
+    pvt->mappedinput = gt_fa_mmap_read(filename, &len, NULL);
+  if (pvt->mappedinput != NULL) {
+    pvt->inptr = pvt->mappedinput;
+    pvt->currentfillpos = (GtUword) len;
+  } else {
+    pvt->inptr = pvt->inbuf;
+    pvt->inputstream = gt_file_xopen(filename, "rb");
+  }
+}
+
+void gt_sequence_buffer_close_input(GtSequenceBuffer *sb)
+{
+  GtSequenceBufferMembers *pvt;
+  gt_assert(sb && sb->pvt);
+  pvt = sb->pvt;
+  if (pvt->mappedinput != NULL) {
+    gt_fa_xmunmap(pvt->mappedinput);
+    pvt->mappedinput = NULL;
+    pvt->inptr = pvt->inbuf;
+  }
+  gt_file_delete(pvt->inputstream);
+  pvt->inputstream = NULL;
+}
+
+static void sequence_buffer_readahead_delete(GtSequenceBufferReadahead *ra)
+{
+  GtUword idx;
+  if (!ra) return;
+#ifdef GT_THREADS_ENABLED
+  if (ra->thread != NULL) {
+    gt_thread_join(ra->thread);
+    gt_thread_delete(ra->thread);
+  }
+#endif
+  for (idx = 0; idx < 2UL * GT_SEQUENCE_BUFFER_BATCHBLOCKS; idx++)
+    gt_desc_buffer_delete(ra->blocks[idx].descbuffer);
+  gt_free(ra->blocks);
+  gt_error_delete(ra->err[0]);
+  gt_error_delete(ra->err[1]);
+  gt_free(ra);
+}
+
 void gt_sequence_buffer_delete(GtSequenceBuffer *si)
 {
   if (!si) return;
@@ -48,6 +135,7 @@ void gt_sequence_buffer_delete(GtSequenceBuffer *si)
     return;
   }
   gt_assert(si->c_class && si->c_class->free);
+  sequence_buffer_readahead_delete(si->pvt->readahead);
   si->c_class->free(si);
   gt_free(si->pvt);
   gt_free(si);
@@ -105,6 +193,12 @@ GtSequenceBuffer* gt_sequence_buffer_new_guess_type(const GtStrArray *seqs,
 GtUword gt_sequence_buffer_get_file_index(GtSequenceBuffer *si)
 {
   gt_assert(si && si->c_class && si->c_class->get_file_index);
+  if (si->pvt->readahead != NULL) {
+    /* the reading thread may already be in a later file */
+    return si->pvt->readahead->current != NULL
+             ? si->pvt->readahead->current->filenum
+             : 0;
+  }
   return si->c_class->get_file_index(si);
 }
 
@@ -154,11 +248,171 @@ int gt_sequence_buffer_advance(GtSequenceBuffer *sb, GtError *err)
   return sb->c_class->advance(sb, err);
 }
 
+void gt_sequence_buffer_enable_readahead(GtSequenceBuffer *sb)
+{
+  gt_assert(sb && sb->pvt && sb->pvt->readahead == NULL);
+  gt_assert(sb->pvt->nextread == 0 && sb->pvt->nextfree == 0);
+#ifdef GT_THREADS_ENABLED
+  if (gt_jobs > 1U
+        /* EMBL and GenBank parsers inspect the descriptions collected so
+           far, so these cannot be collected apart from the reader */
+        && (sb->pvt->descptr == NULL
+              || (sb->c_class != gt_sequence_buffer_embl_class()
+                    && sb->c_class != gt_sequence_buffer_gb_class()))) {
+    GtSequenceBufferReadahead *ra;
+    GtUword idx;
+
+    ra = gt_calloc(1, sizeof (*ra));
+    ra->blocks = gt_calloc((size_t) 2 * GT_SEQUENCE_BUFFER_BATCHBLOCKS,
+                           sizeof (*ra->blocks));
+    ra->err[0] = gt_error_new();
+    ra->err[1] = gt_error_new();
+    ra->descptr = sb->pvt->descptr;
+    if (ra->descptr != NULL) {
+      for (idx = 0; idx < 2UL * GT_SEQUENCE_BUFFER_BATCHBLOCKS; idx++)
+        ra->blocks[idx].descbuffer = gt_desc_buffer_new();
+    }
+    sb->pvt->readahead = ra;
+  }
+#endif
+}
+
+/* Parses the next batch of output buffers. This runs in the reading thread,
+   which exclusively owns all parsing state of <sb> while it runs. */
+static void *sequence_buffer_fill_batch(void *data)
+{
+  GtSequenceBuffer *sb = (GtSequenceBuffer*) data;
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtSequenceBufferReadahead *ra = pvt->readahead;
+  const unsigned int batch = ra->fillbatch;
+  GtSequenceBufferBlock *block;
+  GtUword idx;
+
+  ra->numofblocks[batch] = 0;
+  ra->had_err[batch] = 0;
+  gt_error_unset(ra->err[batch]);
+  for (idx = 0; idx < (GtUword) GT_SEQUENCE_BUFFER_BATCHBLOCKS
+                && !pvt->complete; idx++) {
+    block = ra->blocks + batch * GT_SEQUENCE_BUFFER_BATCHBLOCKS + idx;
+    pvt->outbuf = block->outbuf;
+    pvt->outbuforig = block->outbuforig;
+    pvt->descptr = block->descbuffer;
+    if (gt_sequence_buffer_advance(sb, ra->err[batch]) != 0) {
+      ra->had_err[batch] = -1;
+      break;
+    }
+    block->nextfree = pvt->nextfree;
+    block->filenum = sb->c_class->get_file_index(sb);
+    ra->numofblocks[batch]++;
+    if (pvt->nextfree == 0)
+      break;
+  }
+  return NULL;
+}
+
+static bool sequence_buffer_readahead_more(const GtSequenceBuffer *sb,
+                                           unsigned int batch)
+{
+  const GtSequenceBufferReadahead *ra = sb->pvt->readahead;
+  return !sb->pvt->complete && ra->had_err[batch] == 0
+         && ra->numofblocks[batch] > 0
+         && ra->blocks[batch * GT_SEQUENCE_BUFFER_BATCHBLOCKS
+                       + ra->numofblocks[batch] - 1].nextfree > 0;
+}
+
+static void sequence_buffer_readahead_start(GtSequenceBuffer *sb)
+{
+  GtSequenceBufferReadahead *ra = sb->pvt->readahead;
+  gt_assert(ra->thread == NULL);
+  ra->fillbatch = 1U - ra->readbatch;
+  ra->thread = gt_thread_new(sequence_buffer_fill_batch, sb, NULL);
+  gt_assert(ra->thread != NULL);
+}
+
+/* Makes the next parsed output buffer the current one. Returns 1 if it
+   contains characters, 0 if all input is consumed and -1 on error. */
+static int sequence_buffer_readahead_advance(GtSequenceBuffer *sb,
+                                             GtError *err)
+{
+  GtSequenceBufferReadahead *ra = sb->pvt->readahead;
+
+  if (!ra->started) {
+    ra->started = true;
+    ra->readbatch = ra->fillbatch = 0;
+    (void) sequence_buffer_fill_batch(sb);
+    if (sequence_buffer_readahead_more(sb, 0))
+      sequence_buffer_readahead_start(sb);
+    ra->blocknum = 0;
+  } else {
+    if (ra->current == NULL)
+      return 0;
+    ra->blocknum++;
+  }
+  if (ra->blocknum == ra->numofblocks[ra->readbatch]) {
+    if (ra->had_err[ra->readbatch] != 0) {
+      gt_error_set(err, "%s", gt_error_get(ra->err[ra->readbatch]));
+      ra->current = NULL;
+      return -1;
+    }
+    if (ra->thread == NULL) {
+      ra->current = NULL;
+      return 0;
+    }
+#ifdef GT_THREADS_ENABLED
+    gt_thread_join(ra->thread);
+    gt_thread_delete(ra->thread);
+#endif
+    ra->thread = NULL;
+    ra->readbatch = ra->fillbatch;
+    ra->blocknum = 0;
+    if (sequence_buffer_readahead_more(sb, ra->readbatch))
+      sequence_buffer_readahead_start(sb);
+    if (ra->numofblocks[ra->readbatch] == 0) {
+      gt_assert(ra->had_err[ra->readbatch] != 0);
+      gt_error_set(err, "%s", gt_error_get(ra->err[ra->readbatch]));
+      ra->current = NULL;
+      return -1;
+    }
+  }
+  ra->current = ra->blocks + ra->readbatch * GT_SEQUENCE_BUFFER_BATCHBLOCKS
+                + ra->blocknum;
+  if (ra->descptr != NULL) {
+    if (ra->nextread > 0)
+      gt_desc_buffer_reset(ra->descptr);
+    gt_desc_buffer_transfer(ra->descptr, ra->current->descbuffer);
+  }
+  ra->nextread = 0;
+  if (ra->current->nextfree == 0) {
+    ra->current = NULL;
+    return 0;
+  }
+  return 1;
+}
+
+static int sequence_buffer_readahead_next(GtSequenceBuffer *sb,
+                                          GtUchar *val, char *orig,
+                                          GtError *err)
+{
+  GtSequenceBufferReadahead *ra = sb->pvt->readahead;
+  if (ra->current == NULL || ra->nextread >= ra->current->nextfree) {
+    int retval = sequence_buffer_readahead_advance(sb, err);
+    if (retval <= 0)
+      return retval;
+  }
+  *val = ra->current->outbuf[ra->nextread];
+  if (orig != NULL)
+    *orig = (char) ra->current->outbuforig[ra->nextread];
+  ra->nextread++;
+  return 1;
+}
+
 int gt_sequence_buffer_next(GtSequenceBuffer *sb, GtUchar *val,
                             GtError *err)
 {
   GtSequenceBufferMembers *pvt;
   pvt = sb->pvt;
+  if (pvt->readahead != NULL)
+    return sequence_buffer_readahead_next(sb, val, NULL, err);
   if (pvt->nextread >= pvt->nextfree)
   {
     if (pvt->complete)
@@ -187,6 +441,8 @@ int gt_sequence_buffer_next_with_original(GtSequenceBuffer *sb,
 {
   GtSequenceBufferMembers *pvt;
   pvt = sb->pvt;
+  if (pvt->readahead != NULL)
+    return sequence_buffer_readahead_next(sb, val, orig, err);
   if (pvt->nextread >= pvt->nextfree)
   {
     if (pvt->complete)
@@ -87,6 +87,14 @@ void          gt_sequence_buffer_set_desc_buffer(GtSequenceBuffer *si,
 void          gt_sequence_buffer_set_chardisttab(GtSequenceBuffer*,
                                                  GtUword*);
 
+/* Makes the <GtSequenceBuffer> parse its input files in a separate thread,
+   several output buffers ahead of the reader, if more than one job is
+   available (see <gt_jobs>). Must be called after all other settings and
+   before the first character is read. Descriptions are passed on to the
+   <GtDescBuffer> in step with the reader. The character distribution and
+   file length tables are only complete once all characters have been read.
+*/
+void          gt_sequence_buffer_enable_readahead(GtSequenceBuffer*);
 /* Returns the length of the last processed continuous stretch of special
    characters (wildcards or separators, see chardef.h). */
 uint64_t      gt_sequence_buffer_get_lastspeciallength(const GtSequenceBuffer*);
@@ -75,18 +75,13 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
       currentfileadd = 0;
       currentfileread = 0;
       pvt->linenum = (uint64_t) 1;
-      pvt->inputstream = gt_file_xopen(gt_str_array_get(pvt->filenametab,
-                                                  (GtUword) pvt->filenum),
-                                       "rb");
-      pvt->currentinpos = 0;
-      pvt->currentfillpos = 0;
+      gt_sequence_buffer_open_input(sb);
     } else
     {
       currentchar = inlinebuf_getchar(sb, pvt->inputstream);
       if (currentchar == EOF)
       {
-        gt_file_delete(pvt->inputstream);
-        pvt->inputstream = NULL;
+        gt_sequence_buffer_close_input(sb);
         if (pvt->filelengthtab != NULL)
         {
           pvt->filelengthtab[pvt->filenum].length += currentfileread;
@@ -119,6 +114,13 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
               if (currentchar != CRSYMBOL)
                 gt_desc_buffer_append_char(pvt->descptr, currentchar);
             }
+          } else
+          {
+            if (sbf->indesc && pvt->mappedinput != NULL)
+            {
+              /* descriptions are not stored, so skip them in place */
+              currentfileread += inlinebuf_skip_to(sb, NEWLINESYMBOL);
+            }
           }
         } else
         {
@@ -173,7 +175,7 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
 static void gt_sequence_buffer_fasta_free(GtSequenceBuffer *sb)
 {
   GtSequenceBufferFasta *sbf = gt_sequence_buffer_fasta_cast(sb);
-  gt_file_delete(sb->pvt->inputstream);
+  gt_sequence_buffer_close_input(sb);
   gt_str_delete(sbf->headerbuffer);
 }
 
@@ -19,6 +19,7 @@
 #ifndef SEQUENCE_BUFFER_INLINE_H
 #define SEQUENCE_BUFFER_INLINE_H
 
+#include <string.h>
 #include "core/compat.h"
 #include "core/file.h"
 #include "core/sequence_buffer_rep.h"
@@ -67,17 +68,38 @@
     return (int) pvt->ungetchar;
   } else {
     if (pvt->currentinpos >= pvt->currentfillpos) {
+      if (pvt->mappedinput != NULL)
+        return EOF;
       pvt->currentfillpos = (GtUword) gt_file_xread(f, pvt->inbuf,
                                                           (size_t) INBUFSIZE);
       if (pvt->currentfillpos == 0)
          return EOF;
       pvt->currentinpos = 0;
     }
-    pvt->ungetchar = pvt->inbuf[pvt->currentinpos++];
+    pvt->ungetchar = pvt->inptr[pvt->currentinpos++];
     return (int) pvt->ungetchar;
   }
 }
 
+/* Skips the characters of a mapped input up to, but excluding, the next
+   occurrence of <cc> and returns their number. */
+/*@unused@*/ static inline GtUword inlinebuf_skip_to(GtSequenceBuffer *sb,
+                                                   unsigned char cc)
+{
+  GtSequenceBufferMembers *pvt;
+  const unsigned char *start, *found;
+  GtUword skipped;
+  pvt = sb->pvt;
+  gt_assert(pvt->mappedinput != NULL && !pvt->use_ungetchar);
+  start = pvt->inptr + pvt->currentinpos;
+  found = memchr(start, cc, (size_t) (pvt->currentfillpos
+                                      - pvt->currentinpos));
+  skipped = found != NULL ? (GtUword) (found - start)
+                          : pvt->currentfillpos - pvt->currentinpos;
+  pvt->currentinpos += skipped;
+  return skipped;
+}
+
 /*@unused@*/ static inline void inlinebuf_ungetchar(GtSequenceBuffer *sb)
 {
   gt_assert(!sb->pvt->use_ungetchar);
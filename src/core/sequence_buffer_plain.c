@@ -20,7 +20,6 @@
 #include "core/sequence_buffer_plain.h"
 #include "core/sequence_buffer_rep.h"
 #include "core/sequence_buffer_inline.h"
-#include "core/unused_api.h"
 
 struct GtSequenceBufferPlain {
   const GtSequenceBuffer parent_instance;
@@ -70,18 +69,13 @@ static int gt_sequence_buffer_plain_advance(GtSequenceBuffer *sb, GtError *err)
       sbp->nextfile = false;
       sbp->firstseqinfile = true;
       currentfileread = 0;
-      pvt->inputstream = gt_file_xopen(gt_str_array_get(pvt->filenametab,
-                                                  (GtUword) pvt->filenum),
-                                          "rb");
-      pvt->currentinpos = 0;
-      pvt->currentfillpos = 0;
+      gt_sequence_buffer_open_input(sb);
     } else
     {
       currentchar = inlinebuf_getchar(sb, pvt->inputstream);
       if (currentchar == EOF)
       {
-        gt_file_delete(pvt->inputstream);
-        pvt->inputstream = NULL;
+        gt_sequence_buffer_close_input(sb);
         if (pvt->filelengthtab != NULL)
         {
           pvt->filelengthtab[pvt->filenum].length
@@ -121,9 +115,9 @@ gt_sequence_buffer_plain_get_file_index(GtSequenceBuffer *sb)
   return (GtUword) sb->pvt->filenum;
 }
 
-void gt_sequence_buffer_plain_free(GT_UNUSED GtSequenceBuffer *sb)
+void gt_sequence_buffer_plain_free(GtSequenceBuffer *sb)
 {
-  /* not needed */
+  gt_sequence_buffer_close_input(sb);
 }
 
 const GtSequenceBufferClass* gt_sequence_buffer_plain_class(void)
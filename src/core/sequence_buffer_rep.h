@@ -37,6 +37,7 @@ struct GtSequenceBufferClass {
 };
 
 typedef struct GtSequenceBufferMembers GtSequenceBufferMembers;
+typedef struct GtSequenceBufferReadahead GtSequenceBufferReadahead;
 
 struct GtSequenceBuffer {
   const GtSequenceBufferClass *c_class;
@@ -51,6 +52,8 @@ struct GtSequenceBufferMembers {
        use_ungetchar;
   GtDescBuffer *descptr;
   GtFile *inputstream;
+  void *mappedinput;
+  const unsigned char *inptr;
   GtUword reference_count,
                 *chardisttab,
                 currentfillpos,
@@ -62,13 +65,21 @@ struct GtSequenceBufferMembers {
   const GtStrArray *filenametab;
   unsigned char ungetchar,
                 inbuf[INBUFSIZE],
-                outbuf[OUTBUFSIZE],
-                outbuforig[OUTBUFSIZE];
+                outbufspace[OUTBUFSIZE],
+                outbuforigspace[OUTBUFSIZE],
+                *outbuf,
+                *outbuforig;
   const unsigned char *symbolmap;
+  GtSequenceBufferReadahead *readahead;
 };
 
 GtSequenceBuffer* gt_sequence_buffer_create(const GtSequenceBufferClass*);
 void*             gt_sequence_buffer_cast(const GtSequenceBufferClass*,
                                           GtSequenceBuffer*);
+/* Opens the input file with number <filenum>. Uncompressed files are mapped
+   into memory and scanned in place, all other files are read into <inbuf>. */
+void              gt_sequence_buffer_open_input(GtSequenceBuffer*);
+/* Closes the input file opened by <gt_sequence_buffer_open_input()>. */
+void              gt_sequence_buffer_close_input(GtSequenceBuffer*);
 
 #endif
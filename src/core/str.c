@@ -247,17 +247,16 @@ GtStr* gt_str_clone(const GtStr *s)
 GtStr* gt_str_ref(GtStr *s)
 {
   if (!s) return NULL;
+#ifdef GT_THREADS_ENABLED
+  /* strings referenced by genome nodes are shared between the threads of
+     pipelined node streams, a lock per string would be too costly */
+  (void) __sync_add_and_fetch(&s->reference_count, 1);
+#else
   s->reference_count++; /* increase the reference counter */
+#endif
   return s;
 }
 
-/* The body of of the following two functions is identical except for the
-   following:
-   gt_str_read_next_line uses gt_xfgetc while
-   gt_str_read_next_line_generic uses gt_file_xfgetc
-   Also gt_str_read_next_line_generic does not assert <fpin> != NULL
-*/
-
 int gt_str_read_next_line(GtStr *s, FILE *fpin)
 {
   int cc;
@@ -317,62 +316,35 @@ int gt_str_read_next_line(GtStr *s, FILE *fpin)
   }
 }
 
+/* Reads the line span by span from the buffer of <fpin> instead of character
+   by character. Carriage returns are handled as in gt_str_read_next_line():
+   they are paired with the following character and only an unpaired
+   carriage return directly before the newline is removed. */
 int gt_str_read_next_line_generic(GtStr *s, GtFile *fpin)
 {
-  int cc;
-  char c;
+  const char *span;
+  size_t length;
+  GtUword linestart, carriagereturns;
   gt_assert(s);
-  for (;;) {
-    cc = gt_file_xfgetc(fpin);
-    if (cc == EOF)
-      return EOF;
-    if (cc == '\n') {
-      if ((s->length+1) * sizeof (char) > s->allocated) {
-        s->cstr = gt_dynalloc(s->cstr, &s->allocated,
-                              (s->length+1) * sizeof (char));
-      }
+  if (!fpin)
+    return gt_str_read_next_line(s, stdin);
+  linestart = s->length;
+  while ((span = gt_file_xread_line_span(fpin, &length)) != NULL) {
+    if (span[length-1] == '\n') {
+      gt_str_append_cstr_nt(s, span, length - 1);
+      for (carriagereturns = 0;
+           s->length - carriagereturns > linestart &&
+           s->cstr[s->length - carriagereturns - 1] == '\r';
+           carriagereturns++)
+        /* Nothing */ ;
+      if (carriagereturns % 2 == 1)
+        s->length--;
       s->cstr[s->length] = '\0';
       return 0;
     }
-    else if (cc == '\r') {
-      /* check if we have a Windows newline "\r\n" */
-      int ncc;
-      char nc;
-      ncc = gt_file_xfgetc(fpin);
-      if (ncc == EOF) {
-        c = cc;
-        if ((s->length+2) * sizeof (char) > s->allocated) {
-          s->cstr = gt_dynalloc(s->cstr, &s->allocated,
-                                (s->length+2) * sizeof (char));
-        }
-        s->cstr[s->length++] = c;
-        return EOF;
-      }
-      if (ncc == '\n') {
-        if ((s->length+1) * sizeof (char) > s->allocated) {
-          s->cstr = gt_dynalloc(s->cstr, &s->allocated,
-                                (s->length+1) * sizeof (char));
-        }
-        s->cstr[s->length] = '\0';
-        return 0;
-      }
-      c = cc;
-      nc = ncc;
-      if ((s->length+3) * sizeof (char) > s->allocated) {
-        s->cstr = gt_dynalloc(s->cstr, &s->allocated,
-                              (s->length+3) * sizeof (char));
-      }
-      s->cstr[s->length++] = c;
-      s->cstr[s->length++] = nc;
-      continue;
-    }
-    c = cc;
-    if ((s->length+2) * sizeof (char) > s->allocated) {
-      s->cstr = gt_dynalloc(s->cstr, &s->allocated,
-                            (s->length+2) * sizeof (char));
-    }
-    s->cstr[s->length++] = c;
+    gt_str_append_cstr_nt(s, span, length);
   }
+  return EOF;
 }
 
 int gt_str_unit_test(GtError *err)
@@ -465,10 +437,23 @@ int gt_str_unit_test(GtError *err)
 void gt_str_delete(GtStr *s)
 {
   if (!s) return;           /* return without action if 's' is NULL */
+#ifdef GT_THREADS_ENABLED
+  {
+    unsigned int reference_count;
+    /* decrement the reference counter, if there are multiple references */
+    while ((reference_count = s->reference_count)) {
+      if (__sync_bool_compare_and_swap(&s->reference_count, reference_count,
+                                       reference_count - 1)) {
+        return;
+      }
+    }
+  }
+#else
   if (s->reference_count) { /* there are multiple references to this string */
     s->reference_count--;   /* decrement the reference counter */
     return;                 /* return without freeing the object */
   }
+#endif
   gt_free(s->cstr);         /* free the stored the C string */
   gt_free(s);               /* free the actual string object */
 }
@@ -19,7 +19,7 @@
 #include "core/array_api.h"
 #include "core/compat.h"
 #include "core/ma_api.h"
-#include "core/thread_api.h"
+#include "core/thread.h"
 #include "core/unused_api.h"
 
 unsigned int gt_jobs = 1;
@@ -85,6 +85,28 @@ void gt_rwlock_delete(GtRWLock *rwlock)
   free(rwlock);
 }
 
+size_t gt_rwlock_size(void)
+{
+  return sizeof (pthread_rwlock_t);
+}
+
+GtRWLock* gt_rwlock_init(void *space)
+{
+  GT_UNUSED int rval;
+  gt_assert(space);
+  rval = pthread_rwlock_init((pthread_rwlock_t*) space, NULL);
+  gt_assert(!rval);
+  return space;
+}
+
+void gt_rwlock_destroy(GtRWLock *rwlock)
+{
+  GT_UNUSED int rval;
+  if (!rwlock) return;
+  rval = pthread_rwlock_destroy((pthread_rwlock_t*) rwlock);
+  gt_assert(!rval);
+}
+
 void gt_rwlock_rdlock_func(GtRWLock *rwlock)
 {
   GT_UNUSED int rval;
@@ -146,6 +168,43 @@ void gt_mutex_unlock_func(GtMutex *mutex)
   gt_assert(!rval);
 }
 
+GtCondition* gt_condition_new(void)
+{
+  GtCondition *condition;
+  GT_UNUSED int rval;
+  condition = thread_xmalloc(sizeof (pthread_cond_t), __FILE__, __LINE__);
+  /* initialize condition variable with default attributes */
+  rval = pthread_cond_init((pthread_cond_t*) condition, NULL);
+  gt_assert(!rval);
+  return condition;
+}
+
+void gt_condition_delete(GtCondition *condition)
+{
+  GT_UNUSED int rval;
+  if (!condition) return;
+  rval = pthread_cond_destroy((pthread_cond_t*) condition);
+  gt_assert(!rval);
+  free(condition);
+}
+
+void gt_condition_wait_func(GtCondition *condition, GtMutex *mutex)
+{
+  GT_UNUSED int rval;
+  gt_assert(condition && mutex);
+  rval = pthread_cond_wait((pthread_cond_t*) condition,
+                           (pthread_mutex_t*) mutex);
+  gt_assert(!rval);
+}
+
+void gt_condition_broadcast_func(GtCondition *condition)
+{
+  GT_UNUSED int rval;
+  gt_assert(condition);
+  rval = pthread_cond_broadcast((pthread_cond_t*) condition);
+  gt_assert(!rval);
+}
+
 #else
 
 GtThread* gt_thread_new(GtThreadFunc function, void *data,
@@ -169,6 +228,21 @@ void gt_rwlock_delete(GT_UNUSED GtRWLock *rwlock)
   return;
 }
 
+size_t gt_rwlock_size(void)
+{
+  return 0;
+}
+
+GtRWLock* gt_rwlock_init(GT_UNUSED void *space)
+{
+  return NULL;
+}
+
+void gt_rwlock_destroy(GT_UNUSED GtRWLock *rwlock)
+{
+  return;
+}
+
 GtMutex* gt_mutex_new(void)
 {
   return NULL;
@@ -179,6 +253,16 @@ void gt_mutex_delete(GT_UNUSED GtMutex *mutex)
   return;
 }
 
+GtCondition* gt_condition_new(void)
+{
+  return NULL;
+}
+
+void gt_condition_delete(GT_UNUSED GtCondition *condition)
+{
+  return;
+}
+
 #endif
 
 void gt_thread_delete(GtThread *thread)
@@ -31,6 +31,11 @@ typedef struct GtRWLock GtRWLock;
 /* The <GtMutex> class represents a simple mutex structure. */
 typedef struct GtMutex GtMutex;
 
+/* The <GtCondition> class represents a condition variable, which lets threads
+   wait until another thread signals a change of the data protected by a
+   <GtMutex>. */
+typedef struct GtCondition GtCondition;
+
 /* A function to be multithreaded. */
 typedef void* (*GtThreadFunc)(void *data);
 
@@ -108,4 +113,33 @@ void      gt_mutex_unlock_func(GtMutex *mutex);
           ((void) 0)
 #endif
 
+/* Return a new <GtCondition*> object. */
+GtCondition* gt_condition_new(void);
+
+/* Delete the given <condition>. */
+void      gt_condition_delete(GtCondition *condition);
+
+#ifdef GT_THREADS_ENABLED
+/* Unlock <mutex>, which must be locked by the calling thread, and wait until
+   <condition> is signaled. <mutex> is locked again before returning. As the
+   waiting may also end spuriously, the waited for state must be checked in a
+   loop. */
+#define   gt_condition_wait(condition, mutex) \
+          gt_condition_wait_func(condition, mutex)
+void      gt_condition_wait_func(GtCondition *condition, GtMutex *mutex);
+#else
+#define   gt_condition_wait(condition, mutex) \
+          ((void) 0)
+#endif
+
+#ifdef GT_THREADS_ENABLED
+/* Wake up all threads waiting for <condition>. */
+#define   gt_condition_broadcast(condition) \
+          gt_condition_broadcast_func(condition)
+void      gt_condition_broadcast_func(GtCondition *condition);
+#else
+#define   gt_condition_broadcast(condition) \
+          ((void) 0)
+#endif
+
 #endif
@@ -21,6 +21,7 @@
 #include "core/class_alloc_lock.h"
 #include "core/cstr_api.h"
 #include "core/ensure.h"
+#include "core/hashmap_api.h"
 #include "core/hashtable.h"
 #include "core/ma.h"
 #include "core/queue_api.h"
@@ -81,12 +82,20 @@ typedef struct {
   GtUword number;
 } GtTypeTraverseInfo;
 
+/* the arena the attributes and children list of <fn> are allocated from */
+static GtArena* feature_node_arena(const GtFeatureNode *fn)
+{
+  return gt_genome_node_get_arena((const GtGenomeNode*) fn);
+}
+
 static void feature_node_free(GtGenomeNode *gn)
 {
   GtFeatureNode *fn = gt_feature_node_cast(gn);
   gt_str_delete(fn->seqid);
   gt_str_delete(fn->source);
-  gt_tag_value_map_delete(fn->attributes);
+  /* attributes and children list from an arena are reclaimed with it */
+  if (!feature_node_arena(fn))
+    gt_tag_value_map_delete(fn->attributes);
   if (fn->children) {
     GtDlistelem *dlistelem;
     for (dlistelem = gt_dlist_first(fn->children);
@@ -234,12 +243,19 @@ static void set_tree_status(unsigned int *bit_field, TreeStatus tree_status)
 GtGenomeNode* gt_feature_node_new(GtStr *seqid, const char *type,
                                   GtUword start, GtUword end,
                                   GtStrand strand)
+{
+  return gt_feature_node_new_in_arena(seqid, type, start, end, strand, NULL);
+}
+
+GtGenomeNode* gt_feature_node_new_in_arena(GtStr *seqid, const char *type,
+                                           GtUword start, GtUword end,
+                                           GtStrand strand, GtArena *arena)
 {
   GtGenomeNode *gn;
   GtFeatureNode *fn;
   gt_assert(seqid && type);
   gt_assert(start <= end);
-  gn = gt_genome_node_create(gt_feature_node_class());
+  gn = gt_genome_node_create_in_arena(gt_feature_node_class(), arena);
   fn = gt_feature_node_cast(gn);
   fn->seqid       = gt_str_ref(seqid);
   fn->source      = NULL;
@@ -670,10 +686,14 @@ void gt_feature_node_add_attribute(GtFeatureNode *fn,
   gt_assert(fn && attr_name && attr_value);
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(strlen(attr_value)); /* attribute value cannot be empty */
-  if (!fn->attributes)
-    fn->attributes = gt_tag_value_map_new(attr_name, attr_value);
-  else
-    gt_tag_value_map_add(&fn->attributes, attr_name, attr_value);
+  if (!fn->attributes) {
+    fn->attributes = gt_tag_value_map_new_in_arena(attr_name, attr_value,
+                                                   feature_node_arena(fn));
+  }
+  else {
+    gt_tag_value_map_add_in_arena(&fn->attributes, attr_name, attr_value,
+                                  feature_node_arena(fn));
+  }
   if (fn->observer && fn->observer->attribute_changed) {
     fn->observer->attribute_changed(fn, true, attr_name, attr_value,
                                     fn->observer->data);
@@ -687,10 +707,14 @@ void gt_feature_node_set_attribute(GtFeatureNode *fn,
   gt_assert(fn && attr_name && attr_value);
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(strlen(attr_value)); /* attribute value cannot be empty */
-  if (!fn->attributes)
-    fn->attributes = gt_tag_value_map_new(attr_name, attr_value);
-  else
-    gt_tag_value_map_set(&fn->attributes, attr_name, attr_value);
+  if (!fn->attributes) {
+    fn->attributes = gt_tag_value_map_new_in_arena(attr_name, attr_value,
+                                                   feature_node_arena(fn));
+  }
+  else {
+    gt_tag_value_map_set_in_arena(&fn->attributes, attr_name, attr_value,
+                                  feature_node_arena(fn));
+  }
   if (fn->observer && fn->observer->attribute_changed) {
     fn->observer->attribute_changed(fn, false, attr_name, attr_value,
                                     fn->observer->data);
@@ -704,10 +728,13 @@ void gt_feature_node_remove_attribute(GtFeatureNode *fn,
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(fn->attributes); /* attribute list must exist already */
   if (gt_tag_value_map_size(fn->attributes) == 1) {
-    gt_tag_value_map_delete(fn->attributes);
+    if (!feature_node_arena(fn))
+      gt_tag_value_map_delete(fn->attributes);
     fn->attributes = NULL;
-  } else
-    gt_tag_value_map_remove(&fn->attributes, attr_name);
+  } else {
+    gt_tag_value_map_remove_in_arena(&fn->attributes, attr_name,
+                                     feature_node_arena(fn));
+  }
   if (fn->observer && fn->observer->attribute_deleted) {
     fn->observer->attribute_deleted(fn, attr_name, fn->observer->data);
   }
@@ -1100,8 +1127,10 @@ void gt_feature_node_add_child(GtFeatureNode *parent, GtFeatureNode *child)
   /* pseudo-features have to be top-level */
   gt_assert(!gt_feature_node_is_pseudo((GtFeatureNode*) child));
   /* create children list on demand */
-  if (!parent->children)
-    parent->children = gt_dlist_new((GtCompare) gt_genome_node_cmp);
+  if (!parent->children) {
+    parent->children = gt_dlist_new_with_arena((GtCompare) gt_genome_node_cmp,
+                                               feature_node_arena(parent));
+  }
   gt_dlist_add(parent->children, child); /* XXX: check for cycles */
   /* update tree status of <parent> */
   set_tree_status(&parent->bit_field, TREE_STATUS_UNDETERMINED);
@@ -1319,6 +1348,241 @@ bool gt_feature_node_overlaps_nodes_mark(GtFeatureNode *fn, GtArray *nodes,
   return rval;
 }
 
+#define SERIALIZE_KEPT_BITS \
+        (~((PARENT_STATUS_MASK << PARENT_STATUS_OFFSET) | \
+           (TREE_STATUS_MASK << TREE_STATUS_OFFSET) | \
+           (DFS_STATUS_MASK << DFS_STATUS_OFFSET)))
+
+static void serialize_append(GtStr *buf, const void *data, size_t size)
+{
+  gt_str_append_cstr_nt(buf, data, (GtUword) size);
+}
+
+static void serialize_append_cstr(GtStr *buf, const char *cstr)
+{
+  gt_str_append_cstr_nt(buf, cstr ? cstr : "",
+                        cstr ? (GtUword) strlen(cstr) + 1 : 1);
+}
+
+static void serialize_attribute(const char *attr_name, const char *attr_value,
+                                void *data)
+{
+  GtStr *buf = data;
+  serialize_append_cstr(buf, attr_name);
+  serialize_append_cstr(buf, attr_value);
+}
+
+static bool serialize_is_standalone(const GtFeatureNode *fn)
+{
+  return !fn->observer && !fn->parent_instance.reference_count &&
+         !fn->parent_instance.userdata_nof_items;
+}
+
+bool gt_feature_node_serialize(GtFeatureNode *fn, GtStr *buf)
+{
+  GtHashmap *index;
+  GtArray *nodes;
+  GtDlistelem *dlistelem;
+  GtFeatureNode *node, *child;
+  GtUword i, nofnodes, nofchildren, idx;
+  unsigned int bits;
+  unsigned char present;
+  bool standalone = true;
+  gt_assert(fn && buf);
+  /* number the nodes of the graph in breadth first order, every node of a
+     multi-parent graph gets numbered only once */
+  index = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  nodes = gt_array_new(sizeof (GtFeatureNode*));
+  gt_array_add(nodes, fn);
+  gt_hashmap_add(index, fn, (void*) 1);
+  for (i = 0; standalone && i < gt_array_size(nodes); i++) {
+    node = *(GtFeatureNode**) gt_array_get(nodes, i);
+    if (!serialize_is_standalone(node)) {
+      standalone = false;
+      break;
+    }
+    if (!node->children)
+      continue;
+    for (dlistelem = gt_dlist_first(node->children); dlistelem != NULL;
+         dlistelem = gt_dlistelem_next(dlistelem)) {
+      child = gt_dlistelem_get_data(dlistelem);
+      if (!gt_hashmap_get(index, child)) {
+        gt_array_add(nodes, child);
+        gt_hashmap_add(index, child, (void*) gt_array_size(nodes));
+      }
+    }
+  }
+  nofnodes = gt_array_size(nodes);
+  /* all representatives of multi-features must be part of the graph */
+  for (i = 0; standalone && i < nofnodes; i++) {
+    node = *(GtFeatureNode**) gt_array_get(nodes, i);
+    if (node->representative && !gt_hashmap_get(index, node->representative))
+      standalone = false;
+  }
+  if (!standalone) {
+    gt_array_delete(nodes);
+    gt_hashmap_delete(index);
+    return false;
+  }
+  serialize_append(buf, &nofnodes, sizeof nofnodes);
+  serialize_append_cstr(buf, gt_str_get(fn->seqid));
+  for (i = 0; i < nofnodes; i++) {
+    node = *(GtFeatureNode**) gt_array_get(nodes, i);
+    bits = node->bit_field & SERIALIZE_KEPT_BITS;
+    serialize_append(buf, &bits, sizeof bits);
+    serialize_append(buf, &node->range, sizeof node->range);
+    serialize_append(buf, &node->score, sizeof node->score);
+    serialize_append(buf, &node->parent_instance.line_number,
+                     sizeof node->parent_instance.line_number);
+    /* sources and filenames may be empty, but present */
+    present = (node->source ? 1 : 0) |
+              (node->parent_instance.filename ? 2 : 0);
+    serialize_append(buf, &present, sizeof present);
+    serialize_append_cstr(buf, node->type);
+    if (node->source)
+      serialize_append_cstr(buf, gt_str_get(node->source));
+    if (node->parent_instance.filename) {
+      serialize_append_cstr(buf,
+                            gt_str_get(node->parent_instance.filename));
+    }
+    idx = node->representative
+          ? (GtUword) gt_hashmap_get(index, node->representative) - 1
+          : GT_UNDEF_UWORD;
+    serialize_append(buf, &idx, sizeof idx);
+    /* the attributes are stored in the layout of a <GtTagValueMap> */
+    if (node->attributes)
+      gt_tag_value_map_foreach(node->attributes, serialize_attribute, buf);
+    serialize_append_cstr(buf, NULL);
+    nofchildren = node->children ? gt_dlist_size(node->children) : 0;
+    serialize_append(buf, &nofchildren, sizeof nofchildren);
+    if (node->children) {
+      for (dlistelem = gt_dlist_first(node->children); dlistelem != NULL;
+           dlistelem = gt_dlistelem_next(dlistelem)) {
+        idx = (GtUword) gt_hashmap_get(index,
+                                       gt_dlistelem_get_data(dlistelem)) - 1;
+        serialize_append(buf, &idx, sizeof idx);
+      }
+    }
+  }
+  gt_array_delete(nodes);
+  gt_hashmap_delete(index);
+  return true;
+}
+
+static GtStr* deserialize_shared_str(GtStr **cache, const char *cstr)
+{
+  if (!*cache || strcmp(gt_str_get(*cache), cstr)) {
+    gt_str_delete(*cache);
+    *cache = gt_str_new_cstr(cstr);
+  }
+  return *cache;
+}
+
+static const char* deserialize_cstr(const char **ptr)
+{
+  const char *cstr = *ptr;
+  *ptr += strlen(cstr) + 1;
+  return cstr;
+}
+
+typedef struct {
+  GtFeatureNode *fn;
+  GtUword representative,
+          nofchildren;
+  const char *children;
+} GtFeatureNodeDeserializeInfo;
+
+GtFeatureNode* gt_feature_node_deserialize(const char **data,
+                                           GtFeatureNodeStrings *strings)
+{
+  GtFeatureNodeDeserializeInfo *info;
+  GtFeatureNode *fn, *root;
+  const char *ptr, *cstr, *attributes;
+  GtUword i, j, nofnodes, idx;
+  unsigned char present;
+  gt_assert(data && *data && strings);
+  ptr = *data;
+  memcpy(&nofnodes, ptr, sizeof nofnodes);
+  ptr += sizeof nofnodes;
+  gt_assert(nofnodes > 0);
+  (void) deserialize_shared_str(&strings->seqid, deserialize_cstr(&ptr));
+  info = gt_malloc(sizeof *info * nofnodes);
+  for (i = 0; i < nofnodes; i++) {
+    fn = gt_feature_node_cast(gt_genome_node_create(gt_feature_node_class()));
+    memcpy(&fn->bit_field, ptr, sizeof fn->bit_field);
+    ptr += sizeof fn->bit_field;
+    set_tree_status(&fn->bit_field, IS_TREE);
+    memcpy(&fn->range, ptr, sizeof fn->range);
+    ptr += sizeof fn->range;
+    memcpy(&fn->score, ptr, sizeof fn->score);
+    ptr += sizeof fn->score;
+    memcpy(&fn->parent_instance.line_number, ptr,
+           sizeof fn->parent_instance.line_number);
+    ptr += sizeof fn->parent_instance.line_number;
+    present = (unsigned char) *ptr++;
+    fn->seqid = gt_str_ref(strings->seqid);
+    cstr = deserialize_cstr(&ptr);
+    fn->type = *cstr ? gt_symbol(cstr) : NULL;
+    fn->source = NULL;
+    if (present & 1) {
+      cstr = deserialize_cstr(&ptr);
+      fn->source = gt_str_ref(deserialize_shared_str(&strings->source, cstr));
+    }
+    if (present & 2) {
+      cstr = deserialize_cstr(&ptr);
+      fn->parent_instance.filename =
+        gt_str_ref(deserialize_shared_str(&strings->filename, cstr));
+    }
+    memcpy(&info[i].representative, ptr, sizeof info[i].representative);
+    ptr += sizeof info[i].representative;
+    attributes = ptr;
+    while (*ptr != '\0') {
+      (void) deserialize_cstr(&ptr); /* tag */
+      (void) deserialize_cstr(&ptr); /* value */
+    }
+    ptr++;
+    if (ptr - attributes > 1) {
+      fn->attributes = gt_malloc(sizeof (char) * (ptr - attributes));
+      memcpy(fn->attributes, attributes, sizeof (char) * (ptr - attributes));
+    }
+    else
+      fn->attributes = NULL;
+    memcpy(&info[i].nofchildren, ptr, sizeof info[i].nofchildren);
+    ptr += sizeof info[i].nofchildren;
+    info[i].children = ptr;
+    ptr += info[i].nofchildren * sizeof (GtUword);
+    fn->children = NULL;
+    fn->representative = NULL;
+    fn->observer = NULL;
+    info[i].fn = fn;
+  }
+  /* link the graph in the order the children were stored */
+  for (i = 0; i < nofnodes; i++) {
+    for (j = 0; j < info[i].nofchildren; j++) {
+      memcpy(&idx, info[i].children + j * sizeof idx, sizeof idx);
+      gt_assert(idx < nofnodes);
+      gt_feature_node_add_child(info[i].fn, info[idx].fn);
+    }
+    if (info[i].representative != GT_UNDEF_UWORD) {
+      gt_assert(info[i].representative < nofnodes);
+      info[i].fn->representative = info[info[i].representative].fn;
+    }
+  }
+  root = info[0].fn;
+  gt_free(info);
+  *data = ptr;
+  return root;
+}
+
+void gt_feature_node_strings_reset(GtFeatureNodeStrings *strings)
+{
+  gt_assert(strings);
+  gt_str_delete(strings->seqid);
+  gt_str_delete(strings->source);
+  gt_str_delete(strings->filename);
+  strings->seqid = strings->source = strings->filename = NULL;
+}
+
 GtFeatureNode* gt_feature_node_try_cast(GtGenomeNode *gn)
 {
   return gt_genome_node_try_cast(gt_feature_node_class(), gn);
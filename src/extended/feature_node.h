@@ -18,6 +18,7 @@
 #ifndef FEATURE_NODE_H
 #define FEATURE_NODE_H
 
+#include "core/arena.h"
 #include "core/bittab.h"
 #include "core/range.h"
 #include "core/strand_api.h"
@@ -32,6 +33,13 @@ typedef int (*GtFeatureNodeTraverseFunc)(GtFeatureNode*, void*, GtError*);
 
 const GtGenomeNodeClass* gt_feature_node_class(void);
 
+/* Like <gt_feature_node_new()>, but the node, its lock, its attributes and
+   its list of children are allocated from <arena>, if it is not NULL. The node
+   keeps <arena> alive until it is deleted. */
+GtGenomeNode*  gt_feature_node_new_in_arena(GtStr *seqid, const char *type,
+                                            GtUword start, GtUword end,
+                                            GtStrand strand, GtArena *arena);
+
 GtFeatureNode* gt_feature_node_clone(const GtFeatureNode*);
 void           gt_feature_node_get_exons(GtFeatureNode*,
                                          GtArray *exon_features);
@@ -86,4 +94,29 @@ bool           gt_feature_node_overlaps_nodes_mark(GtFeatureNode *feature_node,
                                                    GtArray *array,
                                                    GtBittab *bttab);
 
+/* Append a self-contained binary representation of the feature node graph
+   rooted at <feature_node> to <buf>. Returns <false> and leaves <buf>
+   unchanged, if the graph cannot be represented on its own, because one of its
+   nodes is referenced from elsewhere, carries user data or an observer, or has
+   its multi-feature representative outside of the graph. */
+bool           gt_feature_node_serialize(GtFeatureNode *feature_node,
+                                         GtStr *buf);
+
+/* The strings shared by the feature nodes recreated by
+   <gt_feature_node_deserialize()>. Must be zero initialized. */
+typedef struct {
+  GtStr *seqid,
+        *source,
+        *filename;
+} GtFeatureNodeStrings;
+
+/* Recreate the feature node graph whose representation created by
+   <gt_feature_node_serialize()> starts at <*data> and advance <*data> behind
+   it. Sequence IDs, sources and filenames equal to the previous ones are
+   shared via <strings>. */
+GtFeatureNode* gt_feature_node_deserialize(const char **data,
+                                           GtFeatureNodeStrings *strings);
+/* Release the strings in <strings> and zero them again. */
+void           gt_feature_node_strings_reset(GtFeatureNodeStrings *strings);
+
 #endif
@@ -26,6 +26,7 @@
 #include "core/msort.h"
 #include "core/parseutils_api.h"
 #include "core/queue_api.h"
+#include "core/thread.h"
 #include "core/unused_api.h"
 #include "extended/eof_node_api.h"
 #include "extended/genome_node_rep.h"
@@ -213,10 +214,26 @@ static int compare_genome_nodes_with_delta(GtGenomeNode *gn_a,
 }
 
 GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass *gnc)
+{
+  return gt_genome_node_create_in_arena(gnc, NULL);
+}
+
+GtGenomeNode* gt_genome_node_create_in_arena(const GtGenomeNodeClass *gnc,
+                                             GtArena *arena)
 {
   GtGenomeNode *gn;
   gt_assert(gnc && gnc->size);
-  gn                     = gt_malloc(gnc->size);
+  if (arena) {
+    /* the node holds a reference to its arena, stored in front of it */
+    GtArena **block = gt_arena_alloc(arena, sizeof (GtArena*) + gnc->size);
+    *block               = gt_arena_ref(arena);
+    gn                   = (GtGenomeNode*) (block + 1);
+    gn->arena_allocated  = true;
+  }
+  else {
+    gn                   = gt_malloc(gnc->size);
+    gn->arena_allocated  = false;
+  }
   gn->c_class            = gnc;
   gn->filename           = NULL; /* means the node is generated */
   gn->line_number        = 0;
@@ -224,7 +241,11 @@ GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass *gnc)
   gn->userdata           = NULL;
   gn->userdata_nof_items = 0;
 #ifdef GT_THREADS_ENABLED
-  gn->lock              = gt_rwlock_new();
+  if (arena)
+    gn->lock             = gt_rwlock_init(gt_arena_alloc(arena,
+                                                         gt_rwlock_size()));
+  else
+    gn->lock             = gt_rwlock_new();
 #endif
   return gn;
 }
@@ -537,7 +558,20 @@ void gt_genome_node_delete(GtGenomeNode *gn)
     gt_hashmap_delete(gn->userdata);
   gt_rwlock_unlock(gn->lock);
 #ifdef GT_THREADS_ENABLED
-  gt_rwlock_delete(gn->lock);
+  if (gn->arena_allocated)
+    gt_rwlock_destroy(gn->lock);
+  else
+    gt_rwlock_delete(gn->lock);
 #endif
-  gt_free(gn);
+  /* the memory of a node from an arena is reclaimed with the whole arena */
+  if (gn->arena_allocated)
+    gt_arena_delete(gt_genome_node_get_arena(gn));
+  else
+    gt_free(gn);
+}
+
+GtArena* gt_genome_node_get_arena(const GtGenomeNode *gn)
+{
+  gt_assert(gn);
+  return gn->arena_allocated ? *((GtArena* const*) gn - 1) : NULL;
 }
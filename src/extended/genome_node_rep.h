@@ -19,6 +19,7 @@
 #define GENOME_NODE_REP_H
 
 #include <stdio.h>
+#include "core/arena.h"
 #include "core/dlist.h"
 #include "core/hashmap.h"
 #include "core/thread_api.h"
@@ -60,6 +61,7 @@ struct GtGenomeNode
   unsigned int line_number,
                reference_count,
                userdata_nof_items;
+  bool arena_allocated; /* fits into the padding */
 };
 
 const GtGenomeNodeClass* gt_genome_node_class_new(size_t size,
@@ -71,5 +73,12 @@ const GtGenomeNodeClass* gt_genome_node_class_new(size_t size,
                                        GtGenomeNodeChangeSeqidFunc change_seqid,
                                        GtGenomeNodeAcceptFunc accept);
 GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass*);
+/* Like <gt_genome_node_create()>, but the node and its lock are allocated
+   from <arena>, if it is not NULL. The node holds a reference to <arena>,
+   which it drops when it is deleted. */
+GtGenomeNode* gt_genome_node_create_in_arena(const GtGenomeNodeClass*,
+                                             GtArena *arena);
+/* Return the arena <gn> has been allocated from, or NULL. */
+GtArena*      gt_genome_node_get_arena(const GtGenomeNode *gn);
 
 #endif
@@ -33,5 +33,8 @@ int                      gt_gff3_in_stream_set_offsetfile(GtNodeStream*, GtStr*,
 void                     gt_gff3_in_stream_disable_add_ids(GtNodeStream*);
 void                     gt_gff3_in_stream_fix_region_boundaries(
                                                                GtGFF3InStream*);
+/* Allocate the feature nodes read by <gff3_in_stream> from an arena, which is
+   replaced for each input file (see <gt_gff3_parser_enable_arena()>). */
+void                     gt_gff3_in_stream_enable_arena(GtGFF3InStream*);
 
 #endif
@@ -305,6 +305,13 @@ void gt_gff3_in_stream_plain_enable_strict_mode(GtNodeStream *ns)
   gt_gff3_parser_enable_strict_mode(is->gff3_parser);
 }
 
+void gt_gff3_in_stream_plain_enable_arena(GtNodeStream *ns)
+{
+  GtGFF3InStreamPlain *is = gff3_in_stream_plain_cast(ns);
+  gt_assert(is);
+  gt_gff3_parser_enable_arena(is->gff3_parser);
+}
+
 void gt_gff3_in_stream_plain_enable_tidy_mode(GtNodeStream *ns)
 {
   GtGFF3InStreamPlain *is = gff3_in_stream_plain_cast(ns);
@@ -19,17 +19,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "core/arena.h"
 #include "core/array.h"
 #include "core/assert_api.h"
 #include "core/compat.h"
 #include "core/cstr_api.h"
+#include "core/dynalloc.h"
 #include "core/hashmap.h"
 #include "core/ma.h"
 #include "core/md5_seqid.h"
+#include "core/minmax.h"
+#include "core/multithread_api.h"
 #include "core/parseutils.h"
 #include "core/queue.h"
 #include "core/splitter.h"
 #include "core/symbol_api.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/warning_api.h"
@@ -48,6 +53,47 @@
 #include "extended/region_node.h"
 #include "extended/xrf_checker_api.h"
 
+/* With more than one job, the lines are read in chunks and the feature lines
+   of each chunk are split into their fields and checked by worker threads,
+   as far as this does not depend on the state of the parser. Lines which
+   would lead to a warning or an error are left to the sequential parser, which
+   reports them in input order as before. Resolving the ID and Parent
+   attributes and everything else involving the parser state is done
+   sequentially. */
+#define GT_GFF3_PARSER_CHUNK_LINES  16384
+#define GT_GFF3_PARSER_BLOCK_LINES  256
+
+typedef struct {
+  GtUword offset, /* of the line in the chunk */
+          length,
+          attrstart, /* of the tag/value pairs in <attributes> */
+          nofattrs;
+  GtArray *attributes;
+  char *seqid,
+       *source,
+       *type;
+  GtRange range;
+  float score;
+  GtStrand strand;
+  GtPhase phase;
+  bool tokenized,
+       score_is_defined;
+} GtGFF3ParserLine;
+
+typedef struct {
+  GtStr *lines;   /* the lines of the chunk, each terminated by '\0' */
+  char *tokens;   /* a copy of <lines> split into fields by the workers */
+  size_t tokens_size;
+  GtArray *line_info,
+          **attributes; /* the attributes of each block of lines */
+  GtUword nofblocks,
+          maxnofblocks,
+          nextblock,
+          nextline;
+  GtMutex *mutex;
+  GtGFF3Parser *parser;
+} GtGFF3ParserChunk;
+
 struct GtGFF3Parser {
   GtFeatureInfo *feature_info;
   GtHashmap *seqid_to_ssr_mapping, /* maps seqids to simple sequence regions */
@@ -66,6 +112,11 @@ struct GtGFF3Parser {
   GtOrphanage *orphanage;
   GtTypeChecker *type_checker;
   GtXRFChecker *xrf_checker;
+  GtGFF3ParserChunk *chunk; /* created on demand */
+  GtArena *arena; /* feature nodes are allocated from it, if enabled */
+  GtSplitter *line_splitter, /* reused for every feature line */
+             *attribute_splitter,
+             *value_splitter;
   unsigned int last_terminator; /* line number of the last terminator */
 };
 
@@ -110,6 +161,9 @@ GtGFF3Parser* gt_gff3_parser_new(GtTypeChecker *type_checker)
   parser->type_checker = type_checker ? gt_type_checker_ref(type_checker)
                                       : NULL;
   parser->xrf_checker = NULL;
+  parser->line_splitter = gt_splitter_new();
+  parser->attribute_splitter = gt_splitter_new();
+  parser->value_splitter = gt_splitter_new();
   return parser;
 }
 
@@ -179,6 +233,13 @@ void gt_gff3_parser_enable_tidy_mode(GtGFF3Parser *parser)
   parser->tidy = true;
 }
 
+void gt_gff3_parser_enable_arena(GtGFF3Parser *parser)
+{
+  gt_assert(parser);
+  if (!parser->arena)
+    parser->arena = gt_arena_new();
+}
+
 static int offset_possible(const GtRange *range, GtWord offset,
                            const char *filename, unsigned int line_number,
                            GtError *err)
@@ -1187,13 +1248,159 @@ static bool invalid_uppercase_gvf_attribute(const char *attr_tag)
           strcmp(attr_tag, GT_GVF_ZYGOSITY));
 }
 
+/* Handles the attributes which require special care. The values of ID and
+   Parent attributes are stored in <id_value> and <parent_value> to be
+   processed later. If <target_checked> is <true>, the syntax of Target
+   attributes has been checked already. */
+static int parse_special_attribute(const char *attr_tag, char *attr_value,
+                                   GtGenomeNode *feature_node,
+                                   char **id_value, char **parent_value,
+                                   bool target_checked, GtGFF3Parser *parser,
+                                   const char *seqid, const char *filename,
+                                   unsigned int line_number, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  if (!strcmp(attr_tag, GT_GFF_ID))
+    *id_value = attr_value; /* process later */
+  else if (!strcmp(attr_tag, GT_GFF_PARENT))
+    *parent_value = attr_value; /* process later */
+  else if (!strcmp(attr_tag, GT_GFF_IS_CIRCULAR)) {
+    SimpleSequenceRegion *ssr;
+    if (strcmp(attr_value, "true")) {
+      gt_error_set(err, "value \"%s\" of %s attribute on line %u in file "
+                   "\"%s\" does not equal \"true\"", attr_value,
+                   GT_GFF_IS_CIRCULAR, line_number, filename);
+      had_err = -1;
+    }
+    ssr = gt_hashmap_get(parser->seqid_to_ssr_mapping, seqid);
+    gt_assert(ssr); /* XXX */
+    gt_assert(!ssr->is_circular); /* XXX */
+    ssr->is_circular = true;
+  }
+  else if (!strcmp(attr_tag, GT_GFF_TARGET) && !target_checked) {
+    /* the value of ``Target'' attributes have a special syntax which is
+       checked here */
+    had_err = gt_gff3_parser_parse_target_attributes(attr_value, NULL, NULL,
+                                                     NULL, NULL, filename,
+                                                     line_number, err);
+    if (had_err && parser->tidy) {
+      GtStrArray *target_ids;
+      GtArray *target_ranges, *target_strands;
+      /* try to tidy up the ``Target'' attributes */
+      gt_error_unset(err);
+      target_ids = gt_str_array_new();
+      target_ranges = gt_array_new(sizeof (GtRange));
+      target_strands = gt_array_new(sizeof (GtStrand));
+      had_err = gt_gff3_parser_parse_all_target_attributes(attr_value, true,
+                                                           target_ids,
+                                                           target_ranges,
+                                                           target_strands,
+                                                           filename,
+                                                           line_number,
+                                                           err);
+      if (!had_err) {
+        GtStr *new_target = gt_str_new();
+        gt_gff3_parser_build_target_str(new_target, target_ids,
+                                        target_ranges, target_strands);
+        gt_feature_node_set_attribute((GtFeatureNode*) feature_node,
+                                      GT_GFF_TARGET,
+                                      gt_str_get(new_target));
+        gt_str_delete(new_target);
+      }
+      gt_array_delete(target_strands);
+      gt_array_delete(target_ranges);
+      gt_str_array_delete(target_ids);
+    }
+  }
+  else if (!strcmp(attr_tag, GT_GFF_DBXREF)
+             || !strcmp(attr_tag, GT_GFF_ONTOLOGY_TERM)) {
+    if (parser->xrf_checker) {
+      if (!gt_xrf_checker_is_valid(parser->xrf_checker, attr_value, err)) {
+        had_err = -1;
+      }
+    }
+  }
+  else if (parser->type_checker && !strcmp(attr_tag, GT_GFF_GAP)) {
+    GtGapStr *gs = NULL;
+    GtRange rng = gt_genome_node_get_range(feature_node);
+    if (gt_type_checker_is_a(parser->type_checker,
+                             gt_symbol("protein_match"),
+                             gt_feature_node_get_type((GtFeatureNode*)
+                                                      feature_node))) {
+      gs = gt_gap_str_new_protein(attr_value, err);
+    } else {
+      gs = gt_gap_str_new_nucleotide(attr_value, err);
+    }
+    if (!gs) {
+      gt_assert(gt_error_is_set(err));
+      had_err = -1;
+    }
+    if (!had_err) {
+      if (gt_range_length(&rng) != gt_gap_str_length_reference(gs)) {
+        gt_error_set(err, "length of aligned reference in %s attribute on "
+                          "line %u in file \"%s\" (" GT_WU ") does not "
+                          "match the length of its %s feature (" GT_WU ")",
+                     GT_GFF_GAP, line_number, filename,
+                     gt_gap_str_length_reference(gs),
+                     gt_feature_node_get_type((GtFeatureNode*)
+                                              feature_node),
+                     gt_range_length(&rng));
+        had_err = -1;
+      }
+    }
+    gt_gap_str_delete(gs);
+  }
+  return had_err;
+}
+
+static int process_id_and_parent_attr(char *id_value, char *parent_value,
+                                      GtGenomeNode *feature_node,
+                                      bool *is_child, GtGFF3Parser *parser,
+                                      GtQueue *genome_nodes,
+                                      const char *filename,
+                                      unsigned int line_number, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+
+  /* process ID attribute */
+  if (!had_err && id_value) {
+    had_err = process_id_attr(id_value, (GtFeatureNode*) feature_node, is_child,
+                              parser, genome_nodes, filename, line_number, err);
+  }
+
+  /* we check multi-feature contrains before we process the Parent attribute,
+     because that prevents problems with multi-features with different parents
+     and allows to process multi-features with orphaned parents at the same
+     time. */
+  if (!had_err && gt_feature_node_is_multi((GtFeatureNode*) feature_node)) {
+    had_err =
+      check_multi_feature_constrains(feature_node, (GtGenomeNode*)
+                    gt_feature_node_get_multi_representative((GtFeatureNode*)
+                                                             feature_node),
+                    gt_feature_node_get_attribute((GtFeatureNode*) feature_node,
+                                                  GT_GFF_ID),
+                                     parser, filename, line_number, err);
+  }
+
+  /* finally, process Parent attribute */
+  if (!had_err && parent_value) {
+    had_err = process_parent_attr(parent_value, feature_node, id_value,
+                                  is_child, parser, genome_nodes, filename,
+                                  line_number, err);
+  }
+
+  return had_err;
+}
+
 static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
                             bool *is_child, GtGFF3Parser *parser,
                             const char *seqid, GtQueue *genome_nodes,
                             const char *filename, unsigned int line_number,
                             GtError *err)
 {
-  GtSplitter *attribute_splitter, *tmp_splitter, *parent_splitter;
+  GtSplitter *attribute_splitter, *tmp_splitter;
   char *id_value = NULL, *parent_value = NULL;
   GtUword i;
   int had_err = 0;
@@ -1201,9 +1408,9 @@ static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
   gt_error_check(err);
   gt_assert(attributes);
 
-  attribute_splitter = gt_splitter_new();
-  tmp_splitter = gt_splitter_new();
-  parent_splitter = gt_splitter_new();
+  attribute_splitter = parser->attribute_splitter;
+  tmp_splitter = parser->value_splitter;
+  gt_splitter_reset(attribute_splitter);
   gt_splitter_split(attribute_splitter, attributes, strlen(attributes), ';');
 
   for (i = 0; !had_err && i < gt_splitter_size(attribute_splitter); i++) {
@@ -1333,130 +1540,49 @@ static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
     }
     /* some attributes require special care */
     if (!had_err && attr_valid) {
-      if (!strcmp(attr_tag, GT_GFF_ID))
-        id_value = attr_value; /* process later */
-      else if (!strcmp(attr_tag, GT_GFF_PARENT))
-        parent_value = attr_value; /* process later */
-      else if (!strcmp(attr_tag, GT_GFF_IS_CIRCULAR)) {
-        SimpleSequenceRegion *ssr;
-        if (strcmp(attr_value, "true")) {
-          gt_error_set(err, "value \"%s\" of %s attribute on line %u in file "
-                       "\"%s\" does not equal \"true\"", attr_value,
-                       GT_GFF_IS_CIRCULAR, line_number, filename);
-          had_err = -1;
-        }
-        ssr = gt_hashmap_get(parser->seqid_to_ssr_mapping, seqid);
-        gt_assert(ssr); /* XXX */
-        gt_assert(!ssr->is_circular); /* XXX */
-        ssr->is_circular = true;
-      }
-      else if (!strcmp(attr_tag, GT_GFF_TARGET)) {
-        /* the value of ``Target'' attributes have a special syntax which is
-           checked here */
-        had_err = gt_gff3_parser_parse_target_attributes(attr_value, NULL, NULL,
-                                                         NULL, NULL, filename,
-                                                         line_number, err);
-        if (had_err && parser->tidy) {
-          GtStrArray *target_ids;
-          GtArray *target_ranges, *target_strands;
-          /* try to tidy up the ``Target'' attributes */
-          gt_error_unset(err);
-          target_ids = gt_str_array_new();
-          target_ranges = gt_array_new(sizeof (GtRange));
-          target_strands = gt_array_new(sizeof (GtStrand));
-          had_err = gt_gff3_parser_parse_all_target_attributes(attr_value, true,
-                                                               target_ids,
-                                                               target_ranges,
-                                                               target_strands,
-                                                               filename,
-                                                               line_number,
-                                                               err);
-          if (!had_err) {
-            GtStr *new_target = gt_str_new();
-            gt_gff3_parser_build_target_str(new_target, target_ids,
-                                            target_ranges, target_strands);
-            gt_feature_node_set_attribute((GtFeatureNode*) feature_node,
-                                          GT_GFF_TARGET,
-                                          gt_str_get(new_target));
-            gt_str_delete(new_target);
-          }
-          gt_array_delete(target_strands);
-          gt_array_delete(target_ranges);
-          gt_str_array_delete(target_ids);
-        }
-      }
-      else if (!strcmp(attr_tag, GT_GFF_DBXREF)
-                 || !strcmp(attr_tag, GT_GFF_ONTOLOGY_TERM)) {
-        if (parser->xrf_checker) {
-          if (!gt_xrf_checker_is_valid(parser->xrf_checker, attr_value, err)) {
-            had_err = -1;
-          }
-        }
-      }
-      else if (parser->type_checker && !strcmp(attr_tag, GT_GFF_GAP)) {
-        GtGapStr *gs = NULL;
-        GtRange rng = gt_genome_node_get_range(feature_node);
-        if (gt_type_checker_is_a(parser->type_checker,
-                                 gt_symbol("protein_match"),
-                                 gt_feature_node_get_type((GtFeatureNode*)
-                                                          feature_node))) {
-          gs = gt_gap_str_new_protein(attr_value, err);
-        } else {
-          gs = gt_gap_str_new_nucleotide(attr_value, err);
-        }
-        if (!gs) {
-          gt_assert(gt_error_is_set(err));
-          had_err = -1;
-        }
-        if (!had_err) {
-          if (gt_range_length(&rng) != gt_gap_str_length_reference(gs)) {
-            gt_error_set(err, "length of aligned reference in %s attribute on "
-                              "line %u in file \"%s\" (" GT_WU ") does not "
-                              "match the length of its %s feature (" GT_WU ")",
-                         GT_GFF_GAP, line_number, filename,
-                         gt_gap_str_length_reference(gs),
-                         gt_feature_node_get_type((GtFeatureNode*)
-                                                  feature_node),
-                         gt_range_length(&rng));
-            had_err = -1;
-          }
-        }
-        gt_gap_str_delete(gs);
-      }
+      had_err = parse_special_attribute(attr_tag, attr_value, feature_node,
+                                        &id_value, &parent_value, false, parser,
+                                        seqid, filename, line_number, err);
     }
   }
 
-  /* process ID attribute */
-  if (!had_err && id_value) {
-    had_err = process_id_attr(id_value, (GtFeatureNode*) feature_node, is_child,
-                              parser, genome_nodes, filename, line_number, err);
+  if (!had_err) {
+    had_err = process_id_and_parent_attr(id_value, parent_value, feature_node,
+                                         is_child, parser, genome_nodes,
+                                         filename, line_number, err);
   }
 
-  /* we check multi-feature contrains before we process the Parent attribute,
-     because that prevents problems with multi-features with different parents
-     and allows to process multi-features with orphaned parents at the same
-     time. */
-  if (!had_err && gt_feature_node_is_multi((GtFeatureNode*) feature_node)) {
-    had_err =
-      check_multi_feature_constrains(feature_node, (GtGenomeNode*)
-                    gt_feature_node_get_multi_representative((GtFeatureNode*)
-                                                             feature_node),
-                    gt_feature_node_get_attribute((GtFeatureNode*) feature_node,
-                                                  GT_GFF_ID),
-                                     parser, filename, line_number, err);
-  }
+  return had_err;
+}
 
-  /* finally, process Parent attribute */
-  if (!had_err && parent_value) {
-    had_err = process_parent_attr(parent_value, feature_node, id_value,
-                                  is_child, parser, genome_nodes, filename,
-                                  line_number, err);
+/* Adds the attributes of a line tokenized by tokenize_gff3_feature_line(),
+   which have been checked for all errors and warnings not depending on the
+   state of the parser already. */
+static int parse_tokenized_attributes(char **attributes, GtUword nofattrs,
+                                      GtGenomeNode *feature_node,
+                                      bool *is_child, GtGFF3Parser *parser,
+                                      const char *seqid,
+                                      GtQueue *genome_nodes,
+                                      const char *filename,
+                                      unsigned int line_number, GtError *err)
+{
+  char *id_value = NULL, *parent_value = NULL;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+  for (i = 0; !had_err && i < nofattrs; i++) {
+    gt_feature_node_add_attribute((GtFeatureNode*) feature_node,
+                                  attributes[2*i], attributes[2*i+1]);
+    had_err = parse_special_attribute(attributes[2*i], attributes[2*i+1],
+                                      feature_node, &id_value, &parent_value,
+                                      true, parser, seqid, filename,
+                                      line_number, err);
+  }
+  if (!had_err) {
+    had_err = process_id_and_parent_attr(id_value, parent_value, feature_node,
+                                         is_child, parser, genome_nodes,
+                                         filename, line_number, err);
   }
-
-  gt_splitter_delete(parent_splitter);
-  gt_splitter_delete(tmp_splitter);
-  gt_splitter_delete(attribute_splitter);
-
   return had_err;
 }
 
@@ -1488,14 +1614,85 @@ void chomp_seqid(char *seqid, const char *filename, unsigned int line_number)
   }
 }
 
+static int parse_tokenized_gff3_feature_line(GtGFF3Parser *parser,
+                                             GtQueue *genome_nodes,
+                                             GtCstrTable *used_types,
+                                             const GtGFF3ParserLine *tokenized,
+                                             GtStr *filenamestr,
+                                             unsigned int line_number,
+                                             GtError *err)
+{
+  GtGenomeNode *gn = NULL, *feature_node = NULL;
+  GtStr *seqid_str = NULL;
+  GtRange range = tokenized->range;
+  const char *filename;
+  bool is_child = false;
+  int had_err = 0;
+
+  gt_error_check(err);
+
+  filename = gt_str_get(filenamestr);
+
+  if (!gt_cstr_table_get(used_types, tokenized->type))
+    gt_cstr_table_add(used_types, tokenized->type);
+
+  had_err = add_offset_if_necessary(&range, parser, tokenized->seqid, filename,
+                                    line_number, err);
+  if (!had_err) {
+    had_err = get_seqid_str(&seqid_str, tokenized->seqid, range, parser,
+                            filename, line_number, err);
+  }
+  if (!had_err)
+    had_err = verify_seqid(seqid_str, filename, line_number, err);
+
+  if (!had_err) {
+    feature_node = gt_feature_node_new_in_arena(seqid_str, tokenized->type,
+                                                range.start, range.end,
+                                                tokenized->strand,
+                                                parser->arena);
+    gt_genome_node_set_origin(feature_node, filenamestr, line_number);
+    set_source((GtFeatureNode*) feature_node, tokenized->source,
+               parser->source_to_str_mapping);
+    had_err = parse_tokenized_attributes(tokenized->nofattrs
+                                         ? gt_array_get(tokenized->attributes,
+                                                        tokenized->attrstart)
+                                         : NULL,
+                                         tokenized->nofattrs, feature_node,
+                                         &is_child, parser, tokenized->seqid,
+                                         genome_nodes, filename, line_number,
+                                         err);
+  }
+
+  if (!had_err && tokenized->score_is_defined) {
+    gt_feature_node_set_score((GtFeatureNode*) feature_node,
+                              tokenized->score);
+  }
+  if (!had_err && tokenized->phase != GT_PHASE_UNDEFINED)
+    gt_feature_node_set_phase((GtFeatureNode*) feature_node, tokenized->phase);
+
+  if (!had_err)
+    gn = is_child ? NULL : feature_node;
+  else if (!is_child)
+    gt_genome_node_delete(feature_node);
+
+  if (!had_err && gn)
+    gt_queue_add(genome_nodes, gn);
+
+  gt_str_delete(seqid_str);
+
+  return had_err;
+}
+
 static int parse_gff3_feature_line(GtGFF3Parser *parser,
                                    GtQueue *genome_nodes,
                                    GtCstrTable *used_types, char *line,
-                                   size_t line_length, GtStr *filenamestr,
+                                   size_t line_length,
+                                   const GtGFF3ParserLine *tokenized,
+                                   GtStr *filenamestr,
                                    unsigned int line_number, GtError *err)
 {
   GtGenomeNode *gn = NULL, *feature_node = NULL;
-  GtSplitter *splitter;
+  GtSplitter *splitter = NULL;
   GtStr *seqid_str = NULL;
   GtStrand gt_strand_value;
   float score_value;
@@ -1512,8 +1709,15 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   filename = gt_str_get(filenamestr);
 
-  /* create splitter */
-  splitter = gt_splitter_new();
+  if (tokenized) {
+    /* the line has been split and checked on a worker thread already */
+    return parse_tokenized_gff3_feature_line(parser, genome_nodes, used_types,
+                                             tokenized, filenamestr,
+                                             line_number, err);
+  }
+
+  splitter = parser->line_splitter;
+  gt_splitter_reset(splitter);
 
   /* parse */
   gt_splitter_split(splitter, line, line_length, '\t');
@@ -1545,7 +1749,6 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
   if (!had_err && parser->tidy && (start[0] == '.' || end[0] == '.')) {
     gt_warning("feature \"%s\" on line %u in file \"%s\" has undefined "
                "range, discarding feature", type, line_number, filename);
-    gt_splitter_delete(splitter);
     return 0;
   }
 
@@ -1614,8 +1817,9 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   /* create the feature */
   if (!had_err) {
-    feature_node = gt_feature_node_new(seqid_str, type, range.start, range.end,
-                                       gt_strand_value);
+    feature_node = gt_feature_node_new_in_arena(seqid_str, type, range.start,
+                                                range.end, gt_strand_value,
+                                                parser->arena);
     gt_genome_node_set_origin(feature_node, filenamestr, line_number);
   }
 
@@ -1646,7 +1850,6 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   /* free */
   gt_str_delete(seqid_str);
-  gt_splitter_delete(splitter);
 
   return had_err;
 }
@@ -2102,6 +2305,276 @@ static int parse_meta_gff3_line(GtGFF3Parser *parser, GtQueue *genome_nodes,
   return had_err;
 }
 
+static bool tokenize_position(GtUword *position, const char *field)
+{
+  const char *ptr;
+  GtUword value = 0;
+  /* only plain positive numbers, everything else is left to parse_range() */
+  for (ptr = field; *ptr >= '0' && *ptr <= '9'; ptr++) {
+    if (ptr - field == 18)
+      return false;
+    value = value * 10 + (*ptr - '0');
+  }
+  if (*ptr != '\0' || value == 0)
+    return false;
+  *position = value;
+  return true;
+}
+
+/* Split the feature line <line> into its fields and check them, as far as this
+   does not depend on the state of the parser. Sets <tokenized> only if the
+   sequential parser would not report any warning or error for the checked
+   parts. */
+static void tokenize_gff3_feature_line(const GtGFF3Parser *parser,
+                                       GtGFF3ParserLine *pl, char *line,
+                                       GtArray *attributes)
+{
+  char *fields[9], *ptr, *token, *tag, *value, *ep;
+  GtUword i, j, nofields = 1, noftokens;
+  pl->tokenized = false;
+  if (pl->length == 0 || line[0] == '#' || line[0] == '>')
+    return;
+  /* split the line into exactly 9 fields */
+  fields[0] = line;
+  for (ptr = line; *ptr != '\0'; ptr++) {
+    if (*ptr == '\t') {
+      if (nofields == 9)
+        return;
+      *ptr = '\0';
+      fields[nofields++] = ptr + 1;
+    }
+  }
+  if (nofields != 9)
+    return;
+  pl->seqid = fields[0];
+  pl->source = fields[1];
+  pl->type = fields[2];
+  if (pl->seqid[0] != '\0' && pl->seqid[strlen(pl->seqid) - 1] == ' ')
+    return;
+  if (parser->type_checker &&
+      !gt_type_checker_is_valid(parser->type_checker, pl->type)) {
+    return;
+  }
+  if (!tokenize_position(&pl->range.start, fields[3]) ||
+      !tokenize_position(&pl->range.end, fields[4]) ||
+      pl->range.start > pl->range.end) {
+    return;
+  }
+  if (strcmp(fields[5], ".") == 0)
+    pl->score_is_defined = false;
+  else {
+    if (fields[5][0] == '\0' || isspace(fields[5][0]))
+      return;
+    pl->score = strtof(fields[5], &ep);
+    if (*ep != '\0')
+      return;
+    pl->score_is_defined = true;
+  }
+  if (strlen(fields[6]) != 1 || !strchr(GT_STRAND_CHARS, fields[6][0]))
+    return;
+  pl->strand = gt_strand_get(fields[6][0]);
+  if (strlen(fields[7]) != 1 || !strchr(GT_PHASE_CHARS, fields[7][0]))
+    return;
+  pl->phase = gt_phase_get(fields[7][0]);
+  /* split the attributes into tag/value pairs */
+  pl->attributes = attributes;
+  pl->attrstart = gt_array_size(attributes);
+  pl->nofattrs = 0;
+  noftokens = 1;
+  for (ptr = fields[8]; *ptr != '\0'; ptr++) {
+    if (*ptr == ';')
+      noftokens++;
+  }
+  if (noftokens == 1 && fields[8][0] == '.') {
+    pl->tokenized = true; /* no attributes */
+    return;
+  }
+  token = fields[8];
+  for (i = 0; i < noftokens; i++) {
+    ptr = strchr(token, ';');
+    if (ptr)
+      *ptr = '\0';
+    if (token[0] == '.')
+      break;
+    if (!is_blank_attribute(token)) {
+      if (!(value = strchr(token, '=')) || strchr(value + 1, '='))
+        break;
+      *value++ = '\0';
+      for (tag = token; *tag == ' '; tag++)
+        /* Nothing */ ;
+      if (tag[0] == '\0' || value[0] == '\0')
+        break;
+      if (isupper(tag[0]) && invalid_uppercase_gff3_attribute(tag))
+        break;
+      for (j = 0; j < pl->nofattrs; j++) {
+        if (!strcmp(*(char**) gt_array_get(attributes, pl->attrstart + 2*j),
+                    tag)) {
+          break;
+        }
+      }
+      if (j < pl->nofattrs)
+        break;
+      if (!strcmp(tag, GT_GFF_TARGET)) {
+        GtError *err = gt_error_new();
+        int had_err;
+        had_err = gt_gff3_parser_parse_target_attributes(value, NULL, NULL,
+                                                         NULL, NULL, "", 0,
+                                                         err);
+        gt_error_delete(err);
+        if (had_err)
+          break;
+      }
+      gt_array_add(attributes, tag);
+      gt_array_add(attributes, value);
+      pl->nofattrs++;
+    }
+    if (ptr)
+      token = ptr + 1;
+  }
+  if (i < noftokens) {
+    /* leave the line to the sequential parser */
+    gt_array_set_size(attributes, pl->attrstart);
+    return;
+  }
+  pl->tokenized = true;
+}
+
+static void* gff3_parser_tokenize_thread(void *data)
+{
+  GtGFF3ParserChunk *chunk = data;
+  GtGFF3ParserLine *pl;
+  GtUword block, i, lastline;
+  for (;;) {
+    gt_mutex_lock(chunk->mutex);
+    block = chunk->nextblock++;
+    gt_mutex_unlock(chunk->mutex);
+    if (block >= chunk->nofblocks)
+      break;
+    gt_array_reset(chunk->attributes[block]);
+    lastline = MIN((block + 1) * GT_GFF3_PARSER_BLOCK_LINES,
+                   gt_array_size(chunk->line_info));
+    for (i = block * GT_GFF3_PARSER_BLOCK_LINES; i < lastline; i++) {
+      pl = gt_array_get(chunk->line_info, i);
+      tokenize_gff3_feature_line(chunk->parser, pl, chunk->tokens + pl->offset,
+                                 chunk->attributes[block]);
+    }
+  }
+  return NULL;
+}
+
+/* read the next chunk of lines from <fpin> and tokenize its feature lines in
+   parallel. The chunk ends before the FASTA section, which is read directly
+   from <fpin>. */
+static int gff3_parser_read_chunk(GtGFF3Parser *parser, GtFile *fpin,
+                                  GtError *err)
+{
+  GtGFF3ParserChunk *chunk = parser->chunk;
+  GtGFF3ParserLine pl;
+  const char *line;
+  GtUword i;
+  gt_error_check(err);
+  gt_str_reset(chunk->lines);
+  gt_array_reset(chunk->line_info);
+  chunk->nextline = 0;
+  memset(&pl, 0, sizeof pl);
+  while (gt_array_size(chunk->line_info) < GT_GFF3_PARSER_CHUNK_LINES) {
+    pl.offset = gt_str_length(chunk->lines);
+    if (gt_str_read_next_line_generic(chunk->lines, fpin) == EOF) {
+      gt_str_set_length(chunk->lines, pl.offset);
+      break;
+    }
+    pl.length = gt_str_length(chunk->lines) - pl.offset;
+    gt_str_append_char(chunk->lines, '\0');
+    gt_array_add(chunk->line_info, pl);
+    line = gt_str_get(chunk->lines) + pl.offset;
+    if (line[0] == '>' || strcmp(line, GT_GFF_FASTA_DIRECTIVE) == 0)
+      break;
+  }
+  if (!gt_array_size(chunk->line_info))
+    return 0;
+  chunk->tokens = gt_dynalloc(chunk->tokens, &chunk->tokens_size,
+                              gt_str_length(chunk->lines));
+  memcpy(chunk->tokens, gt_str_get(chunk->lines), gt_str_length(chunk->lines));
+  chunk->nofblocks = (gt_array_size(chunk->line_info)
+                      + GT_GFF3_PARSER_BLOCK_LINES - 1)
+                     / GT_GFF3_PARSER_BLOCK_LINES;
+  if (chunk->nofblocks > chunk->maxnofblocks) {
+    chunk->attributes = gt_realloc(chunk->attributes,
+                                   sizeof (GtArray*) * chunk->nofblocks);
+    for (i = chunk->maxnofblocks; i < chunk->nofblocks; i++)
+      chunk->attributes[i] = gt_array_new(sizeof (char*));
+    chunk->maxnofblocks = chunk->nofblocks;
+  }
+  chunk->nextblock = 0;
+  return gt_multithread(gff3_parser_tokenize_thread, chunk, err);
+}
+
+/* Read the next line from <fpin> into <line_buffer> and store it in <line>
+   and <line_length>. With more than one job, the line is taken from the
+   current chunk instead and <tokenized> is set if it has been tokenized. */
+static int gff3_parser_next_line(GtGFF3Parser *parser, GtStr *line_buffer,
+                                 GtFile *fpin, char **line,
+                                 size_t *line_length,
+                                 const GtGFF3ParserLine **tokenized,
+                                 GtError *err)
+{
+  GtGFF3ParserChunk *chunk = parser->chunk;
+  GtGFF3ParserLine *pl;
+  int rval;
+  *tokenized = NULL;
+  if (!chunk || parser->fasta_parsing) {
+    if ((rval = gt_str_read_next_line_generic(line_buffer, fpin)) != EOF) {
+      *line = gt_str_get(line_buffer);
+      *line_length = gt_str_length(line_buffer);
+    }
+    return rval;
+  }
+  if (chunk->nextline == gt_array_size(chunk->line_info)) {
+    if (gff3_parser_read_chunk(parser, fpin, err))
+      return -1;
+    if (!gt_array_size(chunk->line_info))
+      return EOF;
+  }
+  pl = gt_array_get(chunk->line_info, chunk->nextline++);
+  *line = gt_str_get(chunk->lines) + pl->offset;
+  *line_length = pl->length;
+  if (pl->tokenized)
+    *tokenized = pl;
+  return 0;
+}
+
+static GtGFF3ParserChunk* gff3_parser_chunk_new(GtGFF3Parser *parser)
+{
+  GtGFF3ParserChunk *chunk = gt_calloc(1, sizeof *chunk);
+  chunk->lines = gt_str_new();
+  chunk->line_info = gt_array_new(sizeof (GtGFF3ParserLine));
+  chunk->mutex = gt_mutex_new();
+  chunk->parser = parser;
+  return chunk;
+}
+
+static void gff3_parser_chunk_reset(GtGFF3ParserChunk *chunk)
+{
+  if (!chunk) return;
+  gt_str_reset(chunk->lines);
+  gt_array_reset(chunk->line_info);
+  chunk->nextline = 0;
+}
+
+static void gff3_parser_chunk_delete(GtGFF3ParserChunk *chunk)
+{
+  GtUword i;
+  if (!chunk) return;
+  for (i = 0; i < chunk->maxnofblocks; i++)
+    gt_array_delete(chunk->attributes[i]);
+  gt_free(chunk->attributes);
+  gt_free(chunk->tokens);
+  gt_array_delete(chunk->line_info);
+  gt_str_delete(chunk->lines);
+  gt_mutex_delete(chunk->mutex);
+  gt_free(chunk);
+}
+
 int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
                                       GtQueue *genome_nodes,
                                       GtCstrTable *used_types,
@@ -2113,6 +2586,7 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
   GtStr *line_buffer;
   char *line;
   const char *filename;
+  const GtGFF3ParserLine *tokenized;
   int rval, had_err = 0;
 
   gt_error_check(err);
@@ -2123,9 +2597,16 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
   /* init */
   line_buffer = gt_str_new();
 
-  while ((rval = gt_str_read_next_line_generic(line_buffer, fpin)) != EOF) {
-    line = gt_str_get(line_buffer);
-    line_length = gt_str_length(line_buffer);
+  if (!parser->chunk && gt_jobs > 1)
+    parser->chunk = gff3_parser_chunk_new(parser);
+
+  while ((rval = gff3_parser_next_line(parser, line_buffer, fpin, &line,
+                                       &line_length, &tokenized, err))
+         != EOF) {
+    if (rval) {
+      had_err = -1;
+      break;
+    }
     (*line_number)++;
 
     if (*line_number == 1) {
@@ -2161,8 +2642,8 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
     }
     else {
       had_err = parse_gff3_feature_line(parser, genome_nodes, used_types, line,
-                                        line_length, filenamestr, *line_number,
-                                        err);
+                                        line_length, tokenized, filenamestr,
+                                        *line_number, err);
       if (had_err || (!parser->incomplete_node && gt_queue_size(genome_nodes)))
         break;
     }
@@ -2212,7 +2693,14 @@ void gt_gff3_parser_reset(GtGFF3Parser *parser)
   gt_hashmap_reset(parser->seqid_to_ssr_mapping);
   gt_hashmap_reset(parser->source_to_str_mapping);
   gt_orphanage_reset(parser->orphanage);
+  gff3_parser_chunk_reset(parser->chunk);
   parser->last_terminator = 0;
+  if (parser->arena) {
+    /* the nodes of the previous file keep their arena alive, its slabs are
+       released at once when the last of them has been deleted */
+    gt_arena_delete(parser->arena);
+    parser->arena = gt_arena_new();
+  }
 }
 
 void gt_gff3_parser_delete(GtGFF3Parser *parser)
@@ -2225,5 +2713,10 @@ void gt_gff3_parser_delete(GtGFF3Parser *parser)
   gt_orphanage_delete(parser->orphanage);
   gt_type_checker_delete(parser->type_checker);
   gt_xrf_checker_delete(parser->xrf_checker);
+  gff3_parser_chunk_delete(parser->chunk);
+  gt_arena_delete(parser->arena);
+  gt_splitter_delete(parser->line_splitter);
+  gt_splitter_delete(parser->attribute_splitter);
+  gt_splitter_delete(parser->value_splitter);
   gt_free(parser);
 }
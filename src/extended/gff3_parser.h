@@ -21,6 +21,9 @@
 #include "extended/gff3_parser_api.h"
 
 void gt_gff3_parser_enable_strict_mode(GtGFF3Parser*);
+/* Allocate the feature nodes from a <GtArena> of the parser, which is
+   replaced whenever the parser is reset. */
+void gt_gff3_parser_enable_arena(GtGFF3Parser*);
 int  gt_gff3_parser_set_offsetfile(GtGFF3Parser*, GtStr*, GtError*);
 int  gt_gff3_parser_parse_target_attributes(const char *values,
                                             GtUword *num_of_targets,
@@ -18,7 +18,19 @@
 #ifndef NODE_VISITOR_API_H
 #define NODE_VISITOR_API_H
 
-/* The <GtNodeVisitor> interface, a visitor for <GtGenomeNode> objects. */
+/* The <GtNodeVisitor> interface, a visitor for <GtGenomeNode> objects.
+
+   Thread-safety contract: a <GtNodeVisitor> object is never used by more than
+   one thread at a time, but several visitors may visit different nodes
+   concurrently (see <gt_parallel_visitor_stream_new()>). A visitor
+   implementation may only be used this way if
+   - it visits each top-level node independently, that is, the result of
+     visiting a node does not depend on the nodes visited before,
+   - it only changes the visited node and its own members, and
+   - the objects it shares with other visitors (e.g., strings or type
+     checkers passed to all of them) are only read, or are thread-safe
+     themselves. In particular, <GtRegionMapping> objects must not be shared.
+   Warnings issued by visitors running in parallel may appear in any order. */
 typedef struct GtNodeVisitor GtNodeVisitor;
 
 #include "extended/comment_node_api.h"
@@ -0,0 +1,194 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/array_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/ma.h"
+#include "core/multithread_api.h"
+#include "core/undef_api.h"
+#include "extended/genome_node_api.h"
+#include "extended/parallel_visitor_stream.h"
+
+struct GtParallelVisitorStream {
+  const GtNodeStream parent_instance;
+  GtNodeStream *in_stream;
+  GtNodeVisitor **visitors;
+  GtUword nofvisitors,
+          nextvisitor, /* the next visitor taken by a worker */
+          nextnode,    /* the next node of the batch to be visited */
+          nextout,     /* the next node of the batch to be passed on */
+          firsterr;    /* the first node of the batch a visitor failed on */
+  GtArray *nodes;      /* the current batch */
+  GtMutex *mutex;
+  GtError *visitor_err, /* the error of the visitor at <firsterr> */
+          *in_err;      /* the error of <in_stream> after the batch */
+  bool in_finished,
+       in_had_err;
+};
+
+#define parallel_visitor_stream_cast(NS)\
+        gt_node_stream_cast(gt_parallel_visitor_stream_class(), NS)
+
+static void* parallel_visitor_stream_worker(void *data)
+{
+  GtParallelVisitorStream *pvs = data;
+  GtNodeVisitor *visitor;
+  GtGenomeNode *gn;
+  GtError *err;
+  GtUword v, i;
+  bool done;
+  gt_mutex_lock(pvs->mutex);
+  v = pvs->nextvisitor++;
+  gt_mutex_unlock(pvs->mutex);
+  if (v >= pvs->nofvisitors)
+    return NULL; /* more threads than visitors */
+  visitor = pvs->visitors[v];
+  err = gt_error_new();
+  for (;;) {
+    gt_mutex_lock(pvs->mutex);
+    i = pvs->nextnode++;
+    /* nodes after a failed one are not visited, as in a <GtVisitorStream> */
+    done = i >= gt_array_size(pvs->nodes) || i > pvs->firsterr;
+    gt_mutex_unlock(pvs->mutex);
+    if (done)
+      break;
+    gn = *(GtGenomeNode**) gt_array_get(pvs->nodes, i);
+    if (gt_genome_node_accept(gn, visitor, err)) {
+      gt_mutex_lock(pvs->mutex);
+      if (i < pvs->firsterr) {
+        pvs->firsterr = i;
+        gt_error_set(pvs->visitor_err, "%s", gt_error_get(err));
+      }
+      gt_mutex_unlock(pvs->mutex);
+      gt_error_unset(err);
+    }
+  }
+  gt_error_delete(err);
+  return NULL;
+}
+
+static int parallel_visitor_stream_fill(GtParallelVisitorStream *pvs,
+                                        GtError *err)
+{
+  GtGenomeNode *gn;
+  GtUword batch_size = pvs->nofvisitors * GT_PARALLEL_VISITOR_STREAM_BATCH_SIZE;
+  int had_err;
+  gt_error_check(err);
+  gt_array_reset(pvs->nodes);
+  pvs->nextout = pvs->nextnode = pvs->nextvisitor = 0;
+  pvs->firsterr = GT_UNDEF_UWORD;
+  while (gt_array_size(pvs->nodes) < batch_size) {
+    if ((had_err = gt_node_stream_next(pvs->in_stream, &gn, pvs->in_err))) {
+      pvs->in_had_err = true;
+      break;
+    }
+    if (!gn)
+      break;
+    gt_array_add(pvs->nodes, gn);
+  }
+  if (gt_array_size(pvs->nodes) < batch_size)
+    pvs->in_finished = true;
+  return gt_multithread(parallel_visitor_stream_worker, pvs, err);
+}
+
+static int parallel_visitor_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                                        GtError *err)
+{
+  GtParallelVisitorStream *pvs;
+  GtUword i;
+  gt_error_check(err);
+  pvs = parallel_visitor_stream_cast(ns);
+  *gn = NULL;
+  if (pvs->nextout == gt_array_size(pvs->nodes) && !pvs->in_finished) {
+    if (parallel_visitor_stream_fill(pvs, err))
+      return -1;
+  }
+  if (pvs->nextout < gt_array_size(pvs->nodes)) {
+    if (pvs->nextout < pvs->firsterr) {
+      *gn = *(GtGenomeNode**) gt_array_get(pvs->nodes, pvs->nextout++);
+      return 0;
+    }
+    /* a visitor failed on this node -> delete it and all following ones */
+    for (i = pvs->nextout; i < gt_array_size(pvs->nodes); i++)
+      gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(pvs->nodes, i));
+    gt_array_reset(pvs->nodes);
+    pvs->nextout = 0;
+    pvs->in_finished = true;
+    pvs->in_had_err = false;
+    gt_error_set(err, "%s", gt_error_get(pvs->visitor_err));
+    return -1;
+  }
+  if (pvs->in_had_err) {
+    pvs->in_had_err = false;
+    gt_error_set(err, "%s", gt_error_get(pvs->in_err));
+    return -1;
+  }
+  return 0;
+}
+
+static void parallel_visitor_stream_free(GtNodeStream *ns)
+{
+  GtParallelVisitorStream *pvs = parallel_visitor_stream_cast(ns);
+  GtUword i;
+  for (i = pvs->nextout; i < gt_array_size(pvs->nodes); i++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(pvs->nodes, i));
+  gt_array_delete(pvs->nodes);
+  for (i = 0; i < pvs->nofvisitors; i++)
+    gt_node_visitor_delete(pvs->visitors[i]);
+  gt_free(pvs->visitors);
+  gt_mutex_delete(pvs->mutex);
+  gt_error_delete(pvs->visitor_err);
+  gt_error_delete(pvs->in_err);
+  gt_node_stream_delete(pvs->in_stream);
+}
+
+const GtNodeStreamClass* gt_parallel_visitor_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtParallelVisitorStream),
+                                   parallel_visitor_stream_free,
+                                   parallel_visitor_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+GtNodeStream* gt_parallel_visitor_stream_new(GtNodeStream *in_stream,
+                                             GtNodeVisitor **visitors,
+                                             GtUword nofvisitors)
+{
+  GtParallelVisitorStream *pvs;
+  GtNodeStream *ns;
+  gt_assert(in_stream && visitors && nofvisitors);
+  ns = gt_node_stream_create(gt_parallel_visitor_stream_class(),
+                             gt_node_stream_is_sorted(in_stream));
+  pvs = parallel_visitor_stream_cast(ns);
+  pvs->in_stream = gt_node_stream_ref(in_stream);
+  pvs->visitors = gt_malloc(sizeof (GtNodeVisitor*) * nofvisitors);
+  memcpy(pvs->visitors, visitors, sizeof (GtNodeVisitor*) * nofvisitors);
+  pvs->nofvisitors = nofvisitors;
+  pvs->nextvisitor = pvs->nextnode = pvs->nextout = 0;
+  pvs->firsterr = GT_UNDEF_UWORD;
+  pvs->nodes = gt_array_new(sizeof (GtGenomeNode*));
+  pvs->mutex = gt_mutex_new();
+  pvs->visitor_err = gt_error_new();
+  pvs->in_err = gt_error_new();
+  pvs->in_finished = pvs->in_had_err = false;
+  return ns;
+}
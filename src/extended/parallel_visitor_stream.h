@@ -0,0 +1,46 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef PARALLEL_VISITOR_STREAM_H
+#define PARALLEL_VISITOR_STREAM_H
+
+#include "extended/node_stream_api.h"
+#include "extended/node_visitor_api.h"
+
+/* The number of nodes read from the input stream per visitor, before the
+   nodes are visited in parallel. */
+#define GT_PARALLEL_VISITOR_STREAM_BATCH_SIZE  256
+
+/* Implements the <GtNodeStream> interface. */
+typedef struct GtParallelVisitorStream GtParallelVisitorStream;
+
+const GtNodeStreamClass* gt_parallel_visitor_stream_class(void);
+/* Create a new <GtParallelVisitorStream*> which applies one of the
+   <nofvisitors> visitors in <visitors> to each node passing through it, like a
+   <GtVisitorStream>. Takes ownership of the visitors, the array itself is
+   copied. The nodes are read in batches and visited by up to <gt_jobs>
+   threads, each using a visitor of its own. The nodes are passed on in their
+   original order. An error of a visitor is reported for the first node it
+   occurs at, after all nodes before it have been passed on; the nodes after it
+   are deleted. All visitors must be configured identically and fulfill the
+   thread-safety contract described in <node_visitor_api.h>. */
+GtNodeStream*            gt_parallel_visitor_stream_new(GtNodeStream
+                                                        *in_stream,
+                                                        GtNodeVisitor
+                                                        **visitors,
+                                                        GtUword nofvisitors);
+
+#endif
@@ -15,25 +15,446 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <stdlib.h>
 #include "core/array.h"
 #include "core/assert_api.h"
 #include "core/class_alloc_lock.h"
+#include "core/dynalloc.h"
+#include "core/fa.h"
+#include "core/ma.h"
+#include "core/md5_seqid.h"
+#include "core/minmax.h"
+#include "core/msort.h"
+#include "core/unused_api.h"
+#include "core/warning_api.h"
+#include "core/xansi_api.h"
 #include "extended/eof_node_api.h"
+#include "extended/feature_node.h"
 #include "extended/genome_node.h"
 #include "extended/node_stream_api.h"
 #include "extended/sort_stream.h"
 
+/* In external memory mode (i.e., with a memory limit) top-level feature nodes
+   are serialized as soon as they arrive and collected in a run. Whenever the
+   serialized run exceeds the memory limit it is sorted and written to a
+   temporary file. All other nodes (regions, comments, sequences, and feature
+   graphs which cannot be serialized on their own) are kept in memory. The
+   output is produced by merging the runs with the nodes kept in memory. Ties
+   are broken by the input order, which gives the same result as the stable
+   sort done in memory. The heads of the runs are kept in a heap.
+   A temporary file is only open while its run is written or merged, and at
+   most GT_SORT_STREAM_MAX_FANIN runs are merged at once. Whenever that many
+   runs of the same level have been written, they are merged into a single
+   run of the next level, so each node is merged a logarithmic number of
+   times. Before the final merge, the last runs are merged until at most
+   GT_SORT_STREAM_MAX_FANIN runs are left. */
+
+#define GT_SORT_STREAM_MAX_FANIN  64
+
+typedef struct {
+  GtGenomeNode *gn;
+  GtUword seqnum;
+} GtSortStreamItem;
+
+typedef struct {
+  GtStr *seqid;
+  GtRange range;
+  GtUword seqnum,
+          offset,
+          length;
+} GtSortStreamKey;
+
+typedef struct {
+  GtStr *path; /* NULL for the last run, which is kept in memory */
+  FILE *fp; /* open while the run is merged */
+  GtUword nofkeys,
+          nextkey;
+  unsigned int level; /* the number of merges the run resulted from */
+  GtSortStreamItem head; /* <head.gn> is NULL if the run is exhausted */
+} GtSortStreamRun;
+
 struct GtSortStream {
   const GtNodeStream parent_instance;
   GtNodeStream *in_stream;
   GtUword idx;
   GtArray *nodes;
   bool sorted;
+  /* external memory mode */
+  GtUword memlimit,
+          seqnum;
+  GtStr *runbuffer;
+  GtArray *runkeys,
+          *runs;
+  GtUword *heap, /* indices of the runs ordered by their heads */
+          heapsize;
+  char *readbuffer;
+  size_t readbuffer_size;
+  GtFeatureNodeStrings strings;
 };
 
 #define gt_sort_stream_cast(GS)\
         gt_node_stream_cast(gt_sort_stream_class(), GS);
 
+static int sort_stream_compare_keys(const void *a, const void *b)
+{
+  const GtSortStreamKey *key_a = a, *key_b = b;
+  int rval;
+  if ((rval = gt_md5_seqid_cmp_seqids(gt_str_get(key_a->seqid),
+                                      gt_str_get(key_b->seqid)))) {
+    return rval;
+  }
+  if ((rval = gt_range_compare(&key_a->range, &key_b->range)))
+    return rval;
+  return key_a->seqnum < key_b->seqnum ? -1 : 1;
+}
+
+static int sort_stream_compare_items(const GtSortStreamItem *item_a,
+                                     const GtSortStreamItem *item_b)
+{
+  int rval;
+  if ((rval = gt_genome_node_cmp(item_a->gn, item_b->gn)))
+    return rval;
+  if (item_a->seqnum == item_b->seqnum)
+    return 0;
+  return item_a->seqnum < item_b->seqnum ? -1 : 1;
+}
+
+static void sort_stream_reset_run(GtSortStream *sort_stream)
+{
+  GtUword i;
+  for (i = 0; i < gt_array_size(sort_stream->runkeys); i++) {
+    gt_str_delete(((GtSortStreamKey*)
+                   gt_array_get(sort_stream->runkeys, i))->seqid);
+  }
+  gt_array_reset(sort_stream->runkeys);
+  gt_str_reset(sort_stream->runbuffer);
+}
+
+/* load the next node of <run> into its head */
+static void sort_stream_run_next(GtSortStream *sort_stream,
+                                 GtSortStreamRun *run)
+{
+  const char *data;
+  run->head.gn = NULL;
+  if (run->nextkey == run->nofkeys)
+    return;
+  if (run->path) {
+    GtUword length;
+    GT_UNUSED size_t rval;
+    rval = gt_xfread(&run->head.seqnum, sizeof run->head.seqnum, 1, run->fp);
+    gt_assert(rval == 1);
+    rval = gt_xfread(&length, sizeof length, 1, run->fp);
+    gt_assert(rval == 1);
+    sort_stream->readbuffer = gt_dynalloc(sort_stream->readbuffer,
+                                          &sort_stream->readbuffer_size,
+                                          length);
+    rval = gt_xfread(sort_stream->readbuffer, sizeof (char), length, run->fp);
+    gt_assert(rval == length);
+    data = sort_stream->readbuffer;
+  }
+  else {
+    GtSortStreamKey *key = gt_array_get(sort_stream->runkeys, run->nextkey);
+    run->head.seqnum = key->seqnum;
+    data = gt_str_get(sort_stream->runbuffer) + key->offset;
+  }
+  run->head.gn = (GtGenomeNode*)
+                 gt_feature_node_deserialize(&data, &sort_stream->strings);
+  run->nextkey++;
+}
+
+/* restore the heap property of the runs below position <i> */
+static void sort_stream_heap_sift_down(GtSortStream *sort_stream, GtUword i)
+{
+  GtSortStreamRun *runs = gt_array_get_space(sort_stream->runs);
+  GtUword *heap = sort_stream->heap, child, tmp;
+  while ((child = 2 * i + 1) < sort_stream->heapsize) {
+    if (child + 1 < sort_stream->heapsize &&
+        sort_stream_compare_items(&runs[heap[child + 1]].head,
+                                  &runs[heap[child]].head) < 0) {
+      child++;
+    }
+    if (sort_stream_compare_items(&runs[heap[child]].head,
+                                  &runs[heap[i]].head) >= 0) {
+      break;
+    }
+    tmp = heap[i];
+    heap[i] = heap[child];
+    heap[child] = tmp;
+    i = child;
+  }
+}
+
+static void sort_stream_heap_build(GtSortStream *sort_stream)
+{
+  GtSortStreamRun *runs = gt_array_get_space(sort_stream->runs);
+  GtUword i;
+  sort_stream->heap = gt_malloc(sizeof (GtUword) *
+                                gt_array_size(sort_stream->runs));
+  sort_stream->heapsize = 0;
+  for (i = 0; i < gt_array_size(sort_stream->runs); i++) {
+    if (runs[i].head.gn)
+      sort_stream->heap[sort_stream->heapsize++] = i;
+  }
+  for (i = sort_stream->heapsize / 2; i > 0; i--)
+    sort_stream_heap_sift_down(sort_stream, i - 1);
+}
+
+/* write <length> bytes of the serialized node with input number <seqnum> to
+   the temporary file of a run */
+static void sort_stream_run_write(FILE *fp, GtUword seqnum, GtUword length,
+                                  const char *data)
+{
+  gt_xfwrite(&seqnum, sizeof seqnum, 1, fp);
+  gt_xfwrite(&length, sizeof length, 1, fp);
+  gt_xfwrite(data, sizeof (char), length, fp);
+}
+
+static void sort_stream_run_open(GtSortStreamRun *run)
+{
+  gt_assert(run->path && !run->fp);
+  run->fp = gt_fa_xfopen(gt_str_get(run->path), "rb");
+}
+
+static void sort_stream_run_remove(GtSortStreamRun *run)
+{
+  gt_genome_node_delete(run->head.gn);
+  run->head.gn = NULL;
+  gt_fa_xfclose(run->fp);
+  run->fp = NULL;
+  if (run->path) {
+    gt_xremove(gt_str_get(run->path));
+    gt_str_delete(run->path);
+    run->path = NULL;
+  }
+}
+
+/* merge the last <nofruns> runs, which have all been written to temporary
+   files, into a single run */
+static void sort_stream_merge_runs(GtSortStream *sort_stream, GtUword nofruns)
+{
+  GtSortStreamRun merged, *runs = gt_array_get_space(sort_stream->runs);
+  GtStr *buffer = gt_str_new();
+  GtUword i, first = gt_array_size(sort_stream->runs) - nofruns;
+  gt_assert(nofruns > 1 && nofruns <= gt_array_size(sort_stream->runs));
+  merged.path = gt_str_new();
+  merged.fp = gt_xtmpfp_generic(merged.path, TMPFP_OPENBINARY);
+  merged.nofkeys = 0;
+  merged.nextkey = 0;
+  merged.level = 0;
+  merged.head.gn = NULL;
+  for (i = first; i < gt_array_size(sort_stream->runs); i++) {
+    merged.nofkeys += runs[i].nofkeys;
+    merged.level = MAX(merged.level, runs[i].level + 1);
+    sort_stream_run_open(runs + i);
+    sort_stream_run_next(sort_stream, runs + i);
+  }
+  /* only the heads of the runs to be merged are loaded */
+  sort_stream_heap_build(sort_stream);
+  while (sort_stream->heapsize) {
+    GtSortStreamRun *run = runs + sort_stream->heap[0];
+    GT_UNUSED bool serialized;
+    gt_str_reset(buffer);
+    serialized = gt_feature_node_serialize((GtFeatureNode*) run->head.gn,
+                                           buffer);
+    gt_assert(serialized);
+    sort_stream_run_write(merged.fp, run->head.seqnum, gt_str_length(buffer),
+                          gt_str_get(buffer));
+    gt_genome_node_delete(run->head.gn);
+    sort_stream_run_next(sort_stream, run);
+    if (!run->head.gn)
+      sort_stream->heap[0] = sort_stream->heap[--sort_stream->heapsize];
+    sort_stream_heap_sift_down(sort_stream, 0);
+  }
+  gt_free(sort_stream->heap);
+  sort_stream->heap = NULL;
+  for (i = first; i < gt_array_size(sort_stream->runs); i++)
+    sort_stream_run_remove(runs + i);
+  gt_fa_xfclose(merged.fp);
+  merged.fp = NULL;
+  gt_array_set_size(sort_stream->runs, first);
+  gt_array_add(sort_stream->runs, merged);
+  gt_str_delete(buffer);
+}
+
+/* merge the last GT_SORT_STREAM_MAX_FANIN runs as long as they have the same
+   level. The levels of the runs never increase from first to last. */
+static void sort_stream_merge_full_levels(GtSortStream *sort_stream)
+{
+  GtSortStreamRun *runs;
+  GtUword nofruns;
+  while ((nofruns = gt_array_size(sort_stream->runs))
+         >= GT_SORT_STREAM_MAX_FANIN) {
+    runs = gt_array_get_space(sort_stream->runs);
+    if (runs[nofruns - GT_SORT_STREAM_MAX_FANIN].level != runs[nofruns-1].level)
+      break;
+    sort_stream_merge_runs(sort_stream, GT_SORT_STREAM_MAX_FANIN);
+  }
+}
+
+/* sort the current run and write it to a temporary file */
+static void sort_stream_spill_run(GtSortStream *sort_stream)
+{
+  GtSortStreamRun run;
+  GtSortStreamKey *key;
+  GtUword i;
+  gt_assert(gt_array_size(sort_stream->runkeys));
+  gt_msort(gt_array_get_space(sort_stream->runkeys),
+           gt_array_size(sort_stream->runkeys), sizeof (GtSortStreamKey),
+           sort_stream_compare_keys);
+  run.path = gt_str_new();
+  run.fp = gt_xtmpfp_generic(run.path, TMPFP_OPENBINARY);
+  run.nofkeys = gt_array_size(sort_stream->runkeys);
+  run.nextkey = 0;
+  run.level = 0;
+  run.head.gn = NULL;
+  for (i = 0; i < run.nofkeys; i++) {
+    key = gt_array_get(sort_stream->runkeys, i);
+    sort_stream_run_write(run.fp, key->seqnum, key->length,
+                          gt_str_get(sort_stream->runbuffer) + key->offset);
+  }
+  gt_fa_xfclose(run.fp);
+  run.fp = NULL;
+  gt_array_add(sort_stream->runs, run);
+  sort_stream_reset_run(sort_stream);
+  sort_stream_merge_full_levels(sort_stream);
+}
+
+static bool sort_stream_add_to_run(GtSortStream *sort_stream, GtFeatureNode *fn)
+{
+  GtSortStreamKey key;
+  key.offset = gt_str_length(sort_stream->runbuffer);
+  if (!gt_feature_node_serialize(fn, sort_stream->runbuffer))
+    return false;
+  key.length = gt_str_length(sort_stream->runbuffer) - key.offset;
+  key.seqid = gt_str_ref(gt_genome_node_get_seqid((GtGenomeNode*) fn));
+  key.range = gt_genome_node_get_range((GtGenomeNode*) fn);
+  key.seqnum = sort_stream->seqnum;
+  gt_array_add(sort_stream->runkeys, key);
+  if (gt_str_length(sort_stream->runbuffer) +
+      gt_array_size(sort_stream->runkeys) * sizeof (GtSortStreamKey)
+      > sort_stream->memlimit) {
+    sort_stream_spill_run(sort_stream);
+  }
+  return true;
+}
+
+static int sort_stream_fill_runs(GtSortStream *sort_stream, GtError *err)
+{
+  GtSortStreamItem item;
+  GtSortStreamRun run, *runs;
+  GtFeatureNode *fn;
+  GtGenomeNode *node;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+  while (!(had_err = gt_node_stream_next(sort_stream->in_stream, &node,
+                                         err)) && node) {
+    if (gt_eof_node_try_cast(node)) {
+      gt_genome_node_delete(node); /* get rid of EOF nodes */
+      continue;
+    }
+    if ((fn = gt_feature_node_try_cast(node)) &&
+        sort_stream_add_to_run(sort_stream, fn)) {
+      gt_genome_node_delete(node);
+    }
+    else {
+      item.gn = node;
+      item.seqnum = sort_stream->seqnum;
+      gt_array_add(sort_stream->nodes, item);
+    }
+    sort_stream->seqnum++;
+  }
+  if (!had_err) {
+    gt_msort(gt_array_get_space(sort_stream->nodes),
+             gt_array_size(sort_stream->nodes), sizeof (GtSortStreamItem),
+             (GtCompare) sort_stream_compare_items);
+    while (gt_array_size(sort_stream->runs) > GT_SORT_STREAM_MAX_FANIN)
+      sort_stream_merge_runs(sort_stream, GT_SORT_STREAM_MAX_FANIN);
+    /* the last run stays in memory */
+    gt_msort(gt_array_get_space(sort_stream->runkeys),
+             gt_array_size(sort_stream->runkeys), sizeof (GtSortStreamKey),
+             sort_stream_compare_keys);
+    run.path = NULL;
+    run.fp = NULL;
+    run.nofkeys = gt_array_size(sort_stream->runkeys);
+    run.nextkey = 0;
+    run.level = 0;
+    run.head.gn = NULL;
+    gt_array_add(sort_stream->runs, run);
+    runs = gt_array_get_space(sort_stream->runs);
+    for (i = 0; i < gt_array_size(sort_stream->runs); i++) {
+      if (runs[i].path)
+        sort_stream_run_open(runs + i);
+      sort_stream_run_next(sort_stream, runs + i);
+    }
+    sort_stream_heap_build(sort_stream);
+  }
+  return had_err;
+}
+
+/* return the smallest node of the runs and the nodes kept in memory, or NULL
+   if all nodes have been delivered. Unless <peek> is set, the node is removed
+   from its source. */
+static GtGenomeNode* sort_stream_take_min(GtSortStream *sort_stream,
+                                          bool peek)
+{
+  GtSortStreamItem *min = NULL;
+  GtSortStreamRun *run = NULL;
+  GtGenomeNode *gn;
+  if (sort_stream->idx < gt_array_size(sort_stream->nodes))
+    min = gt_array_get(sort_stream->nodes, sort_stream->idx);
+  if (sort_stream->heapsize) {
+    run = gt_array_get(sort_stream->runs, sort_stream->heap[0]);
+    if (!min || sort_stream_compare_items(&run->head, min) < 0)
+      min = &run->head;
+    else
+      run = NULL;
+  }
+  if (!min)
+    return NULL;
+  gn = min->gn;
+  if (!peek) {
+    if (run) {
+      sort_stream_run_next(sort_stream, run);
+      if (!run->head.gn) {
+        sort_stream_run_remove(run);
+        sort_stream->heap[0] = sort_stream->heap[--sort_stream->heapsize];
+      }
+      sort_stream_heap_sift_down(sort_stream, 0);
+    }
+    else
+      sort_stream->idx++;
+  }
+  return gn;
+}
+
+static int gt_sort_stream_next_merged(GtSortStream *sort_stream,
+                                      GtGenomeNode **gn)
+{
+  GtGenomeNode *node;
+  *gn = sort_stream_take_min(sort_stream, false);
+  /* join region nodes with the same sequence ID, they are never serialized
+     and thus come in order from the nodes kept in memory */
+  if (*gn && gt_region_node_try_cast(*gn)) {
+    GtRange range_a, range_b;
+    while ((node = sort_stream_take_min(sort_stream, true))) {
+      if (!gt_region_node_try_cast(node) ||
+          gt_str_cmp(gt_genome_node_get_seqid(*gn),
+                     gt_genome_node_get_seqid(node))) {
+        /* the next node is not a region node with the same ID */
+        break;
+      }
+      range_a = gt_genome_node_get_range(*gn);
+      range_b = gt_genome_node_get_range(node);
+      range_a = gt_range_join(&range_a, &range_b);
+      gt_genome_node_set_range(*gn, &range_a);
+      (void) sort_stream_take_min(sort_stream, false);
+      gt_genome_node_delete(node);
+    }
+  }
+  return 0;
+}
+
 static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
                                GtError *err)
 {
@@ -44,6 +465,15 @@ static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
   gt_error_check(err);
   sort_stream = gt_sort_stream_cast(ns);
 
+  if (sort_stream->memlimit) {
+    if (!sort_stream->sorted) {
+      if ((had_err = sort_stream_fill_runs(sort_stream, err)))
+        return had_err;
+      sort_stream->sorted = true;
+    }
+    return gt_sort_stream_next_merged(sort_stream, gn);
+  }
+
   if (!sort_stream->sorted) {
     while (!(had_err = gt_node_stream_next(sort_stream->in_stream, &node,
                                            err)) && node) {
@@ -100,9 +530,26 @@ static void gt_sort_stream_free(GtNodeStream *ns)
 {
   GtUword i;
   GtSortStream *sort_stream = gt_sort_stream_cast(ns);
-  for (i = sort_stream->idx; i < gt_array_size(sort_stream->nodes); i++) {
-    gt_genome_node_delete(*(GtGenomeNode**)
-                          gt_array_get(sort_stream->nodes, i));
+  if (sort_stream->memlimit) {
+    for (i = sort_stream->idx; i < gt_array_size(sort_stream->nodes); i++) {
+      gt_genome_node_delete(((GtSortStreamItem*)
+                             gt_array_get(sort_stream->nodes, i))->gn);
+    }
+    for (i = 0; i < gt_array_size(sort_stream->runs); i++)
+      sort_stream_run_remove(gt_array_get(sort_stream->runs, i));
+    sort_stream_reset_run(sort_stream);
+    gt_array_delete(sort_stream->runkeys);
+    gt_array_delete(sort_stream->runs);
+    gt_str_delete(sort_stream->runbuffer);
+    gt_free(sort_stream->heap);
+    gt_free(sort_stream->readbuffer);
+    gt_feature_node_strings_reset(&sort_stream->strings);
+  }
+  else {
+    for (i = sort_stream->idx; i < gt_array_size(sort_stream->nodes); i++) {
+      gt_genome_node_delete(*(GtGenomeNode**)
+                            gt_array_get(sort_stream->nodes, i));
+    }
   }
   gt_array_delete(sort_stream->nodes);
   gt_node_stream_delete(sort_stream->in_stream);
@@ -121,7 +568,8 @@ const GtNodeStreamClass* gt_sort_stream_class(void)
   return nsc;
 }
 
-GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream)
+GtNodeStream* gt_sort_stream_new_with_memlimit(GtNodeStream *in_stream,
+                                               GtUword memlimit)
 {
   GtNodeStream *ns = gt_node_stream_create(gt_sort_stream_class(), true);
   GtSortStream *sort_stream = gt_sort_stream_cast(ns);
@@ -129,6 +577,55 @@ GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream)
   sort_stream->in_stream = gt_node_stream_ref(in_stream);
   sort_stream->sorted = false;
   sort_stream->idx = 0;
-  sort_stream->nodes = gt_array_new(sizeof (GtGenomeNode*));
+  sort_stream->memlimit = memlimit;
+  sort_stream->seqnum = 0;
+  sort_stream->heap = NULL;
+  sort_stream->heapsize = 0;
+  sort_stream->readbuffer = NULL;
+  sort_stream->readbuffer_size = 0;
+  sort_stream->strings.seqid = NULL;
+  sort_stream->strings.source = NULL;
+  sort_stream->strings.filename = NULL;
+  if (memlimit) {
+    sort_stream->nodes = gt_array_new(sizeof (GtSortStreamItem));
+    sort_stream->runbuffer = gt_str_new();
+    sort_stream->runkeys = gt_array_new(sizeof (GtSortStreamKey));
+    sort_stream->runs = gt_array_new(sizeof (GtSortStreamRun));
+  }
+  else {
+    sort_stream->nodes = gt_array_new(sizeof (GtGenomeNode*));
+    sort_stream->runbuffer = NULL;
+    sort_stream->runkeys = sort_stream->runs = NULL;
+  }
   return ns;
 }
+
+/* parse the environment variable GT_SORT_MEMLIMIT, a number of bytes
+   optionally followed by 'k', 'M', or 'G' */
+static GtUword sort_stream_memlimit_from_env(void)
+{
+  const char *env = getenv("GT_SORT_MEMLIMIT");
+  GtUword memlimit;
+  char *endptr;
+  if (!env || !*env)
+    return 0;
+  memlimit = (GtUword) strtoul(env, &endptr, 10);
+  switch (*endptr) {
+    case 'G': memlimit <<= 10; /*@fallthrough@*/
+    case 'M': memlimit <<= 10; /*@fallthrough@*/
+    case 'k': memlimit <<= 10;
+              endptr++;
+              break;
+  }
+  if (*endptr != '\0') {
+    gt_warning("ignoring invalid value \"%s\" of GT_SORT_MEMLIMIT", env);
+    return 0;
+  }
+  return memlimit;
+}
+
+GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream)
+{
+  return gt_sort_stream_new_with_memlimit(in_stream,
+                                          sort_stream_memlimit_from_env());
+}
@@ -25,7 +25,17 @@
 typedef struct GtSortStream GtSortStream;
 
 /* Create a <GtSortStream*> which sorts the genome nodes it retrieves from
-   <in_stream> and returns them unmodified, but in sorted order. */
+   <in_stream> and returns them unmodified, but in sorted order. If the
+   environment variable GT_SORT_MEMLIMIT is set, this is equivalent to
+   <gt_sort_stream_new_with_memlimit()> with its value as the limit. */
 GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream);
 
+/* Create a <GtSortStream*> like <gt_sort_stream_new()> which sorts in external
+   memory. Top-level features are collected in a compact serialized form, and
+   whenever they exceed <memlimit> bytes they are written to a temporary file as
+   a sorted run. The runs are merged on output. Other nodes, like regions, stay
+   in memory. A <memlimit> of 0 sorts everything in memory. */
+GtNodeStream* gt_sort_stream_new_with_memlimit(GtNodeStream *in_stream,
+                                               GtUword memlimit);
+
 #endif
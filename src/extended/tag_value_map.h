@@ -18,8 +18,24 @@
 #ifndef TAG_VALUE_MAP_H
 #define TAG_VALUE_MAP_H
 
+#include "core/arena.h"
 #include "extended/tag_value_map_api.h"
 
+/* Like <gt_tag_value_map_new()>, <gt_tag_value_map_add()>,
+   <gt_tag_value_map_set()> and <gt_tag_value_map_remove()>, but the map is
+   allocated from <arena>, if it is not NULL. A map from an arena must not be
+   deleted, it is reclaimed with the arena. */
+GtTagValueMap gt_tag_value_map_new_in_arena(const char *tag, const char *value,
+                                            GtArena *arena);
+void          gt_tag_value_map_add_in_arena(GtTagValueMap *tag_value_map,
+                                            const char *tag, const char *value,
+                                            GtArena *arena);
+void          gt_tag_value_map_set_in_arena(GtTagValueMap *tag_value_map,
+                                            const char *tag, const char *value,
+                                            GtArena *arena);
+void          gt_tag_value_map_remove_in_arena(GtTagValueMap *tag_value_map,
+                                               const char *tag,
+                                               GtArena *arena);
 void          gt_tag_value_map_show(const GtTagValueMap);
 int           gt_tag_value_map_unit_test(GtError*);
 
@@ -0,0 +1,207 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/class_alloc_lock.h"
+#include "core/ma.h"
+#include "core/thread_api.h"
+#include "extended/node_stream_api.h"
+#include "extended/thread_stream.h"
+
+struct GtThreadStream {
+  const GtNodeStream parent_instance;
+  GtNodeStream *in_stream;
+  GtGenomeNode **buffer; /* ring buffer of the nodes pulled from <in_stream> */
+  GtUword buffer_size,
+          first,
+          nofnodes;
+  GtMutex *mutex;
+  GtCondition *not_empty, /* signaled by the input thread */
+              *not_full;  /* signaled by the reading thread */
+  GtThread *thread;
+  GtError *err; /* the error of <in_stream> */
+  bool started,
+       finished, /* <in_stream> is exhausted or had an error */
+       had_err,
+       node_returned, /* the last call of the next function returned a node */
+       stop;     /* the stream is deleted before <in_stream> is exhausted */
+};
+
+#define thread_stream_cast(NS)\
+        gt_node_stream_cast(gt_thread_stream_class(), NS)
+
+#ifdef GT_THREADS_ENABLED
+
+static void* thread_stream_input_thread(void *data)
+{
+  GtThreadStream *ts = data;
+  GtGenomeNode *gn;
+  int had_err;
+  for (;;) {
+    gn = NULL;
+    had_err = gt_node_stream_next(ts->in_stream, &gn, ts->err);
+    gt_mutex_lock(ts->mutex);
+    while (!ts->stop && ts->nofnodes == ts->buffer_size)
+      gt_condition_wait(ts->not_full, ts->mutex);
+    if (ts->stop || had_err || !gn) {
+      ts->had_err = had_err ? true : false;
+      ts->finished = true;
+      gt_condition_broadcast(ts->not_empty);
+      gt_mutex_unlock(ts->mutex);
+      if (!had_err)
+        gt_genome_node_delete(gn);
+      break;
+    }
+    ts->buffer[(ts->first + ts->nofnodes) % ts->buffer_size] = gn;
+    ts->nofnodes++;
+    gt_condition_broadcast(ts->not_empty);
+    gt_mutex_unlock(ts->mutex);
+  }
+  return NULL;
+}
+
+static int thread_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                              GtError *err)
+{
+  GtThreadStream *ts;
+  int had_err = 0;
+  gt_error_check(err);
+  ts = thread_stream_cast(ns);
+  if (!ts->started) {
+    ts->started = true;
+    if (!(ts->thread = gt_thread_new(thread_stream_input_thread, ts, err)))
+      return -1;
+  }
+  *gn = NULL;
+  if (!ts->thread)
+    return 0;
+  gt_mutex_lock(ts->mutex);
+  while (!ts->nofnodes && !ts->finished)
+    gt_condition_wait(ts->not_empty, ts->mutex);
+  if (ts->nofnodes) {
+    *gn = ts->buffer[ts->first];
+    ts->first = (ts->first + 1) % ts->buffer_size;
+    ts->nofnodes--;
+    gt_condition_broadcast(ts->not_full);
+    gt_mutex_unlock(ts->mutex);
+    ts->node_returned = true;
+    return 0;
+  }
+  gt_mutex_unlock(ts->mutex);
+  /* the input thread has finished, pass on its error. If the last node is
+     still held back by <gt_node_stream_next()>, signal the end of the stream
+     first, so that the node is served before the error as without this
+     stream. */
+  if (ts->had_err && ts->node_returned) {
+    ts->node_returned = false;
+    return 0;
+  }
+  gt_thread_join(ts->thread);
+  gt_thread_delete(ts->thread);
+  ts->thread = NULL;
+  if (ts->had_err) {
+    gt_error_set(err, "%s", gt_error_get(ts->err));
+    had_err = -1;
+  }
+  return had_err;
+}
+
+#else
+
+static int thread_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                              GtError *err)
+{
+  GtThreadStream *ts;
+  gt_error_check(err);
+  ts = thread_stream_cast(ns);
+  *gn = NULL;
+  if (!ts->had_err && gt_node_stream_next(ts->in_stream, gn, ts->err) != 0)
+    ts->had_err = true;
+  if (ts->had_err) {
+    /* as in the threaded version, serve the node held back by
+       <gt_node_stream_next()> before the error */
+    if (ts->node_returned) {
+      ts->node_returned = false;
+      return 0;
+    }
+    gt_error_set(err, "%s", gt_error_get(ts->err));
+    return -1;
+  }
+  ts->node_returned = *gn != NULL;
+  return 0;
+}
+
+#endif
+
+static void thread_stream_free(GtNodeStream *ns)
+{
+  GtThreadStream *ts = thread_stream_cast(ns);
+#ifdef GT_THREADS_ENABLED
+  if (ts->thread) {
+    gt_mutex_lock(ts->mutex);
+    ts->stop = true;
+    gt_condition_broadcast(ts->not_full);
+    gt_mutex_unlock(ts->mutex);
+    gt_thread_join(ts->thread);
+    gt_thread_delete(ts->thread);
+  }
+#endif
+  for (; ts->nofnodes; ts->nofnodes--) {
+    gt_genome_node_delete(ts->buffer[ts->first]);
+    ts->first = (ts->first + 1) % ts->buffer_size;
+  }
+  gt_free(ts->buffer);
+  gt_condition_delete(ts->not_full);
+  gt_condition_delete(ts->not_empty);
+  gt_mutex_delete(ts->mutex);
+  gt_error_delete(ts->err);
+  gt_node_stream_delete(ts->in_stream);
+}
+
+const GtNodeStreamClass* gt_thread_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtThreadStream),
+                                   thread_stream_free,
+                                   thread_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+GtNodeStream* gt_thread_stream_new(GtNodeStream *in_stream,
+                                   GtUword buffer_size)
+{
+  GtThreadStream *ts;
+  GtNodeStream *ns;
+  gt_assert(in_stream && buffer_size);
+  ns = gt_node_stream_create(gt_thread_stream_class(),
+                             gt_node_stream_is_sorted(in_stream));
+  ts = thread_stream_cast(ns);
+  ts->in_stream = gt_node_stream_ref(in_stream);
+  ts->buffer = gt_malloc(sizeof (GtGenomeNode*) * buffer_size);
+  ts->buffer_size = buffer_size;
+  ts->first = ts->nofnodes = 0;
+  ts->mutex = gt_mutex_new();
+  ts->not_empty = gt_condition_new();
+  ts->not_full = gt_condition_new();
+  ts->thread = NULL;
+  ts->err = gt_error_new();
+  ts->started = ts->finished = ts->had_err = ts->node_returned =
+    ts->stop = false;
+  return ns;
+}
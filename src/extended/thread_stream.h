@@ -0,0 +1,40 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef THREAD_STREAM_H
+#define THREAD_STREAM_H
+
+#include "extended/node_stream_api.h"
+
+/* The default number of nodes buffered by a <GtThreadStream>. */
+#define GT_THREAD_STREAM_BUFFER_SIZE  256
+
+/* Implements the <GtNodeStream> interface. */
+typedef struct GtThreadStream GtThreadStream;
+
+const GtNodeStreamClass* gt_thread_stream_class(void);
+/* Create a new <GtThreadStream*> which pulls the nodes from <in_stream> in a
+   separate thread, starting with the first call of <gt_node_stream_next()>.
+   At most <buffer_size> nodes are buffered between the two threads. The nodes
+   and a possible error of <in_stream> are passed on in the original order.
+   Inserting thread streams into a chain of streams runs the stages between
+   them concurrently, as a pipeline. This requires that the stages do not share
+   any state besides the nodes passed on. Without thread support, the nodes
+   are pulled from <in_stream> directly. */
+GtNodeStream*            gt_thread_stream_new(GtNodeStream *in_stream,
+                                              GtUword buffer_size);
+
+#endif
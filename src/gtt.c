@@ -17,6 +17,7 @@
 
 #include "gtt.h"
 #include "core/alphabet.h"
+#include "core/arena.h"
 #include "core/array.h"
 #include "core/array2dim_api.h"
 #include "core/array2dim_sparse.h"
@@ -142,6 +143,7 @@
 #include "tools/gt_script_filter.h"
 #include "tools/gt_seed_extend.h"
 #include "tools/gt_select.h"
+#include "tools/gt_serve.h"
 #include "tools/gt_seq.h"
 #include "tools/gt_seqfilter.h"
 #include "tools/gt_seqids.h"
@@ -239,6 +241,7 @@ GtToolbox* gtt_tools(void)
   gt_toolbox_add_tool(tools, "scriptfilter", gt_script_filter());
   gt_toolbox_add_tool(tools, "seed_extend", gt_seed_extend());
   gt_toolbox_add_tool(tools, "select", gt_select());
+  gt_toolbox_add_tool(tools, "serve", gt_serve());
   gt_toolbox_add_tool(tools, "seq", gt_seq());
   gt_toolbox_add_tool(tools, "seqfilter", gt_seqfilter());
   gt_toolbox_add_tool(tools, "seqids", gt_seqids());
@@ -282,6 +285,7 @@ GtHashmap* gtt_unit_tests(void)
 
   gt_hashmap_add(unit_tests, "alphabet class", gt_alphabet_unit_test);
   gt_hashmap_add(unit_tests, "alignment class", gt_alignment_unit_test);
+  gt_hashmap_add(unit_tests, "arena class", gt_arena_unit_test);
   gt_hashmap_add(unit_tests, "array class", gt_array_unit_test);
   gt_hashmap_add(unit_tests, "array example", gt_array_example);
   gt_hashmap_add(unit_tests, "array2dim example", gt_array2dim_example);
@@ -594,6 +594,10 @@ static int fillbcktabmapspecstartptr(GtBcktab *bcktab,
                       err) != 0)
   {
     haserr = true;
+  } else
+  {
+    gt_fa_mmap_apply_policy_for_suffix(bcktab->mappedptr,GT_BCKTABSUFFIX,
+                                       GT_FA_MAP_NORMAL);
   }
   gt_str_delete(tmpfilename);
   return haserr ? -1 : 0;
@@ -4521,16 +4521,50 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
 }
 
 #ifdef GT_THREADS_ENABLED
+/* number of combinations of sequence parts per thread whose output may wait
+   for being written */
+#define GT_DIAGBANDSEED_OUTPUT_WINDOW 4U
+
+/* A combination of sequence parts to be processed by the next idle thread.
+   If the output of all previous combinations has been written when it is
+   started, its output goes directly to stdout. Otherwise it is spooled to a
+   temporary file, which is copied to stdout in its turn. */
+typedef struct
+{
+  GtUwordPair comb;
+  FILE *spool;
+  bool direct,
+       finished;
+} GtDiagbandseedTask;
+
+/* The combinations are processed in the order of <tasks>, a combination being
+   started only if at most <window> combinations before it have not been
+   written yet. This bounds the number of temporary files holding output
+   waiting to be written in order. */
+typedef struct
+{
+  GtArray *tasks;
+  GtUword nexttask,
+          nextoutput,
+          window;
+  bool aborted;
+  GtMutex *mutex;
+  GtCondition *task_finished,
+              *output_written;
+} GtDiagbandseedTaskQueue;
+
 typedef struct
 {
   const GtDiagbandseedInfo *arg;
   const GtKmerPosList *alist;
-  FILE *stream;
   const GtEncseq *aencseq, *bencseq;
   const GtSequencePartsInfo *aseqranges,
                             *bseqranges;
   GtSegmentRejectFunc segment_reject_func;
-  GtArray *combinations;
+  GtDiagbandseedTaskQueue *queue;
+  unsigned int threadnum;
+  GtUword processed_tasks,
+          busy_usec;
   int had_err;
   GtError *err;
   const GtKarlinAltschulStat *karlin_altschul_stat;
@@ -4538,59 +4572,302 @@ typedef struct
 
 static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
                                      const GtDiagbandseedInfo *arg,
-                                     const GtKmerPosList *alist,
-                                     FILE *stream,
                                      const GtEncseq *aencseq,
                                      const GtSequencePartsInfo *aseqranges,
                                      const GtEncseq *bencseq,
                                      const GtSequencePartsInfo *bseqranges,
                                      const GtKarlinAltschulStat
                                        *karlin_altschul_stat,
-                                     GtArray *combinations,
+                                     GtDiagbandseedTaskQueue *queue,
+                                     unsigned int threadnum,
                                      GtError *err)
 {
   gt_assert(ti != NULL);
   ti->arg = arg;
-  ti->alist = alist;
-  ti->stream = stream;
+  ti->alist = NULL;
   ti->aencseq = aencseq;
   ti->aseqranges = aseqranges;
   ti->bencseq = bencseq;
   ti->bseqranges = bseqranges;
   ti->karlin_altschul_stat = karlin_altschul_stat;
-  ti->combinations = gt_array_clone(combinations);
+  ti->queue = queue;
+  ti->threadnum = threadnum;
+  ti->processed_tasks = 0;
+  ti->busy_usec = 0;
   ti->had_err = 0;
   ti->err = err;
 }
 
+static GtDiagbandseedTask *gt_diagbandseed_task_next(
+                                         GtDiagbandseedTaskQueue *queue)
+{
+  GtDiagbandseedTask *task = NULL;
+
+  gt_mutex_lock(queue->mutex);
+  while (!queue->aborted &&
+         queue->nexttask < gt_array_size(queue->tasks) &&
+         queue->nexttask >= queue->nextoutput + queue->window)
+  {
+    gt_condition_wait(queue->output_written, queue->mutex);
+  }
+  if (!queue->aborted && queue->nexttask < gt_array_size(queue->tasks))
+  {
+    task = (GtDiagbandseedTask *) gt_array_get(queue->tasks,
+                                               queue->nexttask);
+    /* the output thread has nothing more to write, and only writes again
+       after <task> is finished */
+    task->direct = queue->nexttask == queue->nextoutput;
+    queue->nexttask++;
+  }
+  gt_mutex_unlock(queue->mutex);
+  return task;
+}
+
+/* Return the stream the output of <task> is written to. */
+static FILE *gt_diagbandseed_task_stream(GtDiagbandseedTask *task)
+{
+  if (task->direct)
+  {
+    return stdout;
+  }
+  task->spool = gt_xtmpfp_generic(NULL, TMPFP_OPENBINARY | TMPFP_AUTOREMOVE);
+  return task->spool;
+}
+
+/* Copy the spooled output of <task> to stdout and close the spool. */
+static void gt_diagbandseed_task_write_spool(GtDiagbandseedTask *task)
+{
+  char buf[BUFSIZ];
+  size_t len;
+
+  rewind(task->spool);
+  while ((len = fread(buf, sizeof *buf, sizeof buf, task->spool)) > 0)
+  {
+    gt_xfwrite(buf, sizeof *buf, len, stdout);
+  }
+  gt_fa_xfclose(task->spool);
+  task->spool = NULL;
+}
+
+/* Process combinations from the queue until it is empty, so that threads
+   finishing early take over the combinations not yet started. */
 static void *gt_diagbandseed_thread_algorithm(void *thread_info)
 {
   GtDiagbandseedThreadInfo *info = (GtDiagbandseedThreadInfo *)thread_info;
-  if (gt_array_size(info->combinations) > 0) {
-    const GtUwordPair *last = gt_array_get_last(info->combinations),
-                      *comb;
+  GtDiagbandseedTaskQueue *queue = info->queue;
+  GtDiagbandseedTask *task;
+
+  while ((task = gt_diagbandseed_task_next(queue)) != NULL)
+  {
+    FILE *stream;
+#ifndef _WIN32
+    struct timeval tvalBefore, tvalAfter;
 
-    for (comb = gt_array_get_first(info->combinations); comb <= last; comb++) {
-      info->had_err = gt_diagbandseed_algorithm(
+    gettimeofday(&tvalBefore, NULL);
+#endif
+    stream = gt_diagbandseed_task_stream(task);
+    info->had_err = gt_diagbandseed_algorithm(
                            info->arg,
                            info->alist,
-                           info->stream,
+                           stream,
                            info->aencseq,
                            info->aseqranges,
-                           comb->a,
+                           task->comb.a,
                            info->bencseq,
                            info->bseqranges,
-                           comb->b,
+                           task->comb.b,
                            info->karlin_altschul_stat,
                            NULL,
                            NULL,
                            info->err);
-      if (info->had_err) break;
+    info->processed_tasks++;
+#ifndef _WIN32
+    gettimeofday(&tvalAfter, NULL);
+    info->busy_usec += (tvalAfter.tv_sec - tvalBefore.tv_sec) * 1000000L
+                       + tvalAfter.tv_usec - tvalBefore.tv_usec;
+#endif
+    gt_mutex_lock(queue->mutex);
+    if (info->had_err)
+    {
+      /* let the other threads stop after their current combination */
+      queue->aborted = true;
+    } else
+    {
+      task->finished = true;
+    }
+    gt_condition_broadcast(queue->task_finished);
+    gt_condition_broadcast(queue->output_written);
+    gt_mutex_unlock(queue->mutex);
+    if (info->had_err)
+    {
+      break;
+    }
+  }
+  return NULL;
+}
+
+/* Write the output of the combinations in the order of the queue as soon as
+   it is available. */
+static void *gt_diagbandseed_thread_output(void *data)
+{
+  GtDiagbandseedTaskQueue *queue = (GtDiagbandseedTaskQueue *) data;
+
+  while (true)
+  {
+    GtDiagbandseedTask *task = NULL;
+
+    gt_mutex_lock(queue->mutex);
+    while (!queue->aborted &&
+           queue->nextoutput < gt_array_size(queue->tasks) &&
+           !((GtDiagbandseedTask *)
+             gt_array_get(queue->tasks, queue->nextoutput))->finished)
+    {
+      gt_condition_wait(queue->task_finished, queue->mutex);
+    }
+    if (!queue->aborted && queue->nextoutput < gt_array_size(queue->tasks))
+    {
+      task = (GtDiagbandseedTask *) gt_array_get(queue->tasks,
+                                                 queue->nextoutput);
+    }
+    gt_mutex_unlock(queue->mutex);
+    if (task == NULL)
+    {
+      break;
+    }
+    if (task->spool != NULL)
+    {
+      gt_diagbandseed_task_write_spool(task);
     }
+    gt_mutex_lock(queue->mutex);
+    queue->nextoutput++;
+    gt_condition_broadcast(queue->output_written);
+    gt_mutex_unlock(queue->mutex);
   }
-  gt_array_delete(info->combinations);
   return NULL;
 }
+
+/* Process all combinations of <queue> by <gt_jobs> threads, the calling
+   thread being one of them, while an additional thread writes their output
+   to stdout. */
+static int gt_diagbandseed_run_task_queue(GtDiagbandseedThreadInfo *tinfo,
+                                          GtDiagbandseedTaskQueue *queue,
+                                          const GtKmerPosList *alist,
+                                          GtUword *wall_usec,
+                                          GtError *err)
+{
+  GtArray *threads = gt_array_new(sizeof (GtThread *));
+  GtThread *output_thread;
+  GtUword idx;
+  unsigned int tidx;
+  int had_err = 0;
+#ifndef _WIN32
+  struct timeval tvalBefore, tvalAfter;
+
+  gettimeofday(&tvalBefore, NULL);
+#endif
+  queue->nexttask = queue->nextoutput = 0;
+  queue->aborted = false;
+  for (tidx = 0; tidx < gt_jobs; tidx++)
+  {
+    tinfo[tidx].alist = alist;
+    tinfo[tidx].had_err = 0;
+  }
+  /* the output of the previous steps must precede that of the
+     combinations */
+  (void) fflush(stdout);
+  output_thread = gt_thread_new(gt_diagbandseed_thread_output, queue, err);
+  if (output_thread == NULL)
+  {
+    had_err = -1;
+  }
+  for (tidx = 1; !had_err && tidx < gt_jobs; tidx++)
+  {
+    GtThread *thread;
+
+    if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
+                                tinfo + tidx, err)) != NULL)
+    {
+      gt_array_add(threads, thread);
+    } else
+    {
+      had_err = -1;
+    }
+  }
+  if (!had_err)
+  {
+    (void) gt_diagbandseed_thread_algorithm(tinfo);
+  } else
+  {
+    gt_mutex_lock(queue->mutex);
+    queue->aborted = true;
+    gt_condition_broadcast(queue->task_finished);
+    gt_condition_broadcast(queue->output_written);
+    gt_mutex_unlock(queue->mutex);
+  }
+  for (tidx = 0; tidx < gt_array_size(threads); tidx++)
+  {
+    GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
+    gt_thread_join(thread);
+    gt_thread_delete(thread);
+  }
+  if (output_thread != NULL)
+  {
+    gt_thread_join(output_thread);
+    gt_thread_delete(output_thread);
+  }
+  for (tidx = 0; !had_err && tidx <= gt_array_size(threads); tidx++)
+  {
+    had_err = tinfo[tidx].had_err;
+  }
+  gt_array_delete(threads);
+  /* the output of combinations not written due to an error */
+  for (idx = 0; idx < gt_array_size(queue->tasks); idx++)
+  {
+    GtDiagbandseedTask *task = gt_array_get(queue->tasks, idx);
+    if (task->spool != NULL)
+    {
+      gt_fa_xfclose(task->spool);
+      task->spool = NULL;
+    }
+  }
+#ifndef _WIN32
+  gettimeofday(&tvalAfter, NULL);
+  *wall_usec += (tvalAfter.tv_sec - tvalBefore.tv_sec) * 1000000L
+                + tvalAfter.tv_usec - tvalBefore.tv_usec;
+#else
+  (void) wall_usec;
+#endif
+  return had_err;
+}
+
+static void gt_diagbandseed_thread_load_out(
+                                      const GtDiagbandseedThreadInfo *tinfo,
+                                      GtUword wall_usec)
+{
+#ifndef _WIN32
+  GtUword busy_usec = 0;
+  unsigned int tidx;
+
+  for (tidx = 0; tidx < gt_jobs; tidx++)
+  {
+    printf("# thread %u processed " GT_WU " combinations of sequence parts "
+           "in " GT_WD ".%06ld seconds\n", tidx, tinfo[tidx].processed_tasks,
+           GT_USEC2SEC(tinfo[tidx].busy_usec),
+           GT_USECREMAIN(tinfo[tidx].busy_usec));
+    busy_usec += tinfo[tidx].busy_usec;
+  }
+  if (wall_usec > 0)
+  {
+    printf("# threads were idle for %.2f%% of " GT_WD ".%06ld seconds\n",
+           100.0 * (1.0 - MIN(1.0, (double) busy_usec /
+                                   ((double) wall_usec * gt_jobs))),
+           GT_USEC2SEC(wall_usec), GT_USECREMAIN(wall_usec));
+  }
+#else
+  (void) tinfo;
+  (void) wall_usec;
+#endif
+}
 #endif
 
 static int gt_diagbandseed_write_kmers(const GtKmerPosList *kmerpos_list,
@@ -4697,16 +4974,22 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
   GtKarlinAltschulStat *karlin_altschul_stat = NULL;
   GtDiagbandseedState *dbs_state = NULL;
 #ifdef GT_THREADS_ENABLED
-  GtDiagbandseedThreadInfo *tinfo = gt_malloc(gt_jobs * sizeof *tinfo);
-  FILE **stream_tab;
+  GtDiagbandseedThreadInfo *tinfo = NULL;
+  GtDiagbandseedTaskQueue queue;
+  GtUword wall_usec = 0;
   unsigned int tidx;
 
-  /* create output streams */
-  stream_tab = gt_malloc(gt_jobs * sizeof *stream_tab);
-  stream_tab[0] = stdout;
-  for (tidx = 1; !had_err && tidx < gt_jobs; tidx++) {
-    stream_tab[tidx]
-      = gt_xtmpfp_generic(NULL, TMPFP_OPENBINARY | TMPFP_AUTOREMOVE);
+  if (gt_jobs > 1) {
+    /* the output of each combination of sequence parts is written to stdout
+       in the order of the combinations */
+    tinfo = gt_malloc(gt_jobs * sizeof *tinfo);
+    queue.tasks = gt_array_new(sizeof (GtDiagbandseedTask));
+    queue.nexttask = queue.nextoutput = 0;
+    queue.window = GT_DIAGBANDSEED_OUTPUT_WINDOW * gt_jobs;
+    queue.aborted = false;
+    queue.mutex = gt_mutex_new();
+    queue.task_finished = gt_condition_new();
+    queue.output_written = gt_condition_new();
   }
 #endif
   if (arg->verbose || gt_querymatch_gfa2_display(arg->extp->out_display_flag))
@@ -4813,6 +5096,20 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       gt_timer_delete(timer);
     }
   }
+#ifdef GT_THREADS_ENABLED
+  for (tidx = 0; gt_jobs > 1 && tidx < gt_jobs; tidx++) {
+    gt_diagbandseed_thread_info_set(tinfo + tidx,
+                                    arg,
+                                    arg->aencseq,
+                                    aseqranges,
+                                    arg->bencseq,
+                                    bseqranges,
+                                    karlin_altschul_stat,
+                                    &queue,
+                                    tidx,
+                                    err);
+  }
+#endif
   for (aidx = 0; !had_err && aidx < anumseqranges; aidx++) {
     /* create alist here to prevent redundant calculations */
     char *path = NULL;
@@ -4888,86 +5185,16 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       }
 #ifdef GT_THREADS_ENABLED
     } else if (!arg->use_kmerfile) {
-      const GtUword num_runs = bpick ? 1 : bnumseqranges - bidx;
-      const GtUword num_runs_per_thread = (num_runs - 1) / gt_jobs + 1;
-      const GtUword num_threads = (num_runs - 1) / num_runs_per_thread + 1;
-      GtArray *combinations = gt_array_new(sizeof (GtUwordPair));
-      GtArray *threads = gt_array_new(sizeof (GtThread *));
-
-      gt_assert(bidx < bnumseqranges);
-      gt_assert(num_threads <= gt_jobs);
-      gt_assert(!bpick || num_threads == 1);
-
-      /* start additional threads */
-      for (tidx = 1; !had_err && tidx < num_threads; tidx++) {
-        GtThread *thread;
-        GtUword idx;
-        bidx += num_runs_per_thread;
-        const GtUword end = MIN(bidx + num_runs_per_thread, bnumseqranges);
-
-        for (idx = bidx; idx < end; idx++) {
-          GtUwordPair comb = {aidx, idx};
-          gt_array_add(combinations, comb);
-        }
-        gt_diagbandseed_thread_info_set(tinfo + tidx,
-                                        arg,
-                                        use_alist ? alist : NULL,
-                                        stream_tab[tidx],
-                                        arg->aencseq,
-                                        aseqranges,
-                                        arg->bencseq,
-                                        bseqranges,
-                                        karlin_altschul_stat,
-                                        combinations,
-                                        err);
-        gt_array_reset(combinations);
-        if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
-                                    tinfo + tidx, err)) != NULL) {
-          gt_array_add(threads, thread);
-        } else {
-          had_err = -1;
-        }
-      }
-
-      /* start main thread */
-      if (!had_err) {
-        GtUword idx;
-        bidx = self ? aidx : 0;
-        for (idx = bidx;
-             idx < MIN(bidx + num_runs_per_thread, bnumseqranges);
-             ++idx) {
-          if (!bpick || pick->b == idx) {
-            GtUwordPair comb = {aidx, idx};
-            gt_array_add(combinations, comb);
-          }
-        }
-        gt_diagbandseed_thread_info_set(tinfo,
-                                        arg,
-                                        use_alist ? alist : NULL,
-                                        stream_tab[0],
-                                        arg->aencseq,
-                                        aseqranges,
-                                        arg->bencseq,
-                                        bseqranges,
-                                        karlin_altschul_stat,
-                                        combinations,
-                                        err);
-        gt_diagbandseed_thread_algorithm(tinfo);
-      }
-
-      /* clean up */
-      for (tidx = 0; tidx < gt_array_size(threads); tidx++) {
-        GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
-        if (!had_err) {
-          gt_thread_join(thread);
+      gt_array_reset(queue.tasks);
+      for (/* Nothing */; bidx < bnumseqranges; bidx++) {
+        if (!bpick || pick->b == bidx) {
+          GtDiagbandseedTask task = {{aidx, bidx}, NULL, false, false};
+          gt_array_add(queue.tasks, task);
         }
-        gt_thread_delete(thread);
       }
-      gt_array_delete(threads);
-      for (tidx = 0; tidx < num_threads && !had_err; tidx++) {
-        had_err = tinfo[tidx].had_err;
-      }
-      gt_array_delete(combinations);
+      had_err = gt_diagbandseed_run_task_queue(tinfo, &queue,
+                                               use_alist ? alist : NULL,
+                                               &wall_usec, err);
     }
 #endif
     if (use_alist) {
@@ -4976,13 +5203,8 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     gt_kmerpos_encode_info_delete(aencode_info);
   }
 #ifdef GT_THREADS_ENABLED
-  if (gt_jobs > 1 && arg->use_kmerfile) {
-    GtArray *combinations[gt_jobs];
-    GtArray *threads = gt_array_new(sizeof (GtThread *));
-    GtUword counter = 0;
-    for (tidx = 0; tidx < gt_jobs; tidx++) {
-      combinations[tidx] = gt_array_new(sizeof (GtUwordPair));
-    }
+  if (!had_err && gt_jobs > 1 && arg->use_kmerfile) {
+    gt_array_reset(queue.tasks);
     for (aidx = 0; aidx < anumseqranges; aidx++) {
       if (apick && pick->a != aidx)
       {
@@ -4990,77 +5212,24 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       }
       for (bidx = self ? aidx : 0; bidx < bnumseqranges; bidx++) {
         if (!bpick || pick->b == bidx) {
-          GtUwordPair comb = {aidx, bidx};
-          gt_array_add(combinations[counter++ % gt_jobs], comb);
+          GtDiagbandseedTask task = {{aidx, bidx}, NULL, false, false};
+          gt_array_add(queue.tasks, task);
         }
       }
     }
-
-    for (tidx = 1; !had_err && tidx < gt_jobs; tidx++) {
-      GtThread *thread;
-      gt_diagbandseed_thread_info_set(tinfo + tidx,
-                                      arg,
-                                      NULL,
-                                      stream_tab[tidx],
-                                      arg->aencseq,
-                                      aseqranges,
-                                      arg->bencseq,
-                                      bseqranges,
-                                      karlin_altschul_stat,
-                                      combinations[tidx],
-                                      err);
-      if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
-                                  tinfo + tidx, err)) != NULL) {
-        gt_array_add(threads, thread);
-      } else {
-        had_err = -1;
-      }
-    }
-    /* start main thread */
-    if (!had_err) {
-      gt_diagbandseed_thread_info_set(tinfo,
-                                      arg,
-                                      NULL,
-                                      stream_tab[0],
-                                      arg->aencseq,
-                                      aseqranges,
-                                      arg->bencseq,
-                                      bseqranges,
-                                      karlin_altschul_stat,
-                                      combinations[0],
-                                      err);
-      gt_diagbandseed_thread_algorithm(tinfo);
-    }
-
-    /* clean up */
-    for (tidx = 0; tidx < gt_array_size(threads); tidx++) {
-      GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
-      if (!had_err) {
-        gt_thread_join(thread);
-      }
-      gt_thread_delete(thread);
-    }
-    for (tidx = 0; tidx < gt_array_size(threads) && !had_err; tidx++) {
-      had_err = tinfo[tidx].had_err;
-    }
-    gt_array_delete(threads);
-    for (tidx = 0; tidx < gt_jobs; tidx++) {
-      gt_array_delete(combinations[tidx]);
-    }
+    had_err = gt_diagbandseed_run_task_queue(tinfo, &queue, NULL,
+                                             &wall_usec, err);
   }
-  gt_free(tinfo);
-
-  /* print the threads' output to stdout */
-  for (tidx = 1; tidx < gt_jobs; tidx++) {
-    int cc;
-    rewind(stream_tab[tidx]);
-    while ((cc = fgetc(stream_tab[tidx])) != EOF) {
-      putchar(cc);
+  if (gt_jobs > 1) {
+    if (arg->verbose) {
+      gt_diagbandseed_thread_load_out(tinfo, wall_usec);
     }
-    gt_fa_xfclose(stream_tab[tidx]);
+    gt_free(tinfo);
+    gt_array_delete(queue.tasks);
+    gt_mutex_delete(queue.mutex);
+    gt_condition_delete(queue.task_finished);
+    gt_condition_delete(queue.output_written);
   }
-  gt_free(stream_tab);
-
 #endif
   if (arg->verbose)
   {
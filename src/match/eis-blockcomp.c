@@ -40,6 +40,9 @@
 #include "core/str.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#endif
 #include "eis-blockcomp-construct.h"
 #include "match/eis-bitpackseqpos.h"
 #include "match/eis-encidxseq.h"
@@ -96,6 +99,9 @@ struct blockCompositionSeq
   Symbol blockEncFallback, rangeEncFallback;
   int numModes;
   unsigned *partialSymSumBits, *partialSymSumBitsSums, symSumBits;
+  bool unpackBlocksForRank; /* count symbols of partial blocks after
+                             * unpacking instead of in the packed
+                             * permutation (for benchmarking) */
 };
 
 static inline size_t
@@ -266,6 +272,106 @@ addBlock2OutputBuffer(
                    significantPermIdxBits);
 }
 
+/* Full blocks are processed in batches: the symbols of a batch are read
+ * sequentially, the composition/permutation index pairs of the blocks
+ * are computed by up to gt_jobs threads, each on a disjoint range of
+ * blocks, and the results are then appended to the output in block
+ * order. Thus the index written is the same for any number of threads. */
+enum {
+  BLOCK_ENCODE_BATCH_BUCKETS = 64,
+};
+
+struct blockEncodeJob
+{
+  const struct compList *compositionTable;
+  const MRAEnc *alphabet, *blockMapAlphabet;
+  AlphabetRangeSize blockMapAlphabetSize;
+  unsigned blockSize;
+  Symbol *batch, *block;
+  PermCompIndex *permCompIdx;
+  unsigned *permIdxBits, *compositionPreAlloc;
+  BitString permCompBSPreAlloc;
+  GtUword firstBlock, endBlock;
+#ifdef GT_THREADS_ENABLED
+  GtThread *thread;
+#endif
+};
+
+static void *
+encodeBlockRange(void *data)
+{
+  struct blockEncodeJob *job = data;
+  GtUword blockIdx;
+  for (blockIdx = job->firstBlock; blockIdx < job->endBlock; ++blockIdx)
+  {
+    Symbol *batchBlock = job->batch + blockIdx * job->blockSize;
+    gt_MRAEncSymbolsTransform(job->alphabet, batchBlock, job->blockSize);
+    /* the block stored in the batch must remain in the source alphabet
+     * for the symbol sums and range encodings */
+    memcpy(job->block, batchBlock, sizeof (Symbol) * job->blockSize);
+    gt_MRAEncSymbolsTransform(job->blockMapAlphabet, job->block,
+                              job->blockSize);
+    gt_block2IndexPair(job->compositionTable, job->blockSize,
+                       job->blockMapAlphabetSize, job->block,
+                       job->permCompIdx + 2 * blockIdx,
+                       job->permIdxBits + blockIdx,
+                       job->permCompBSPreAlloc, job->compositionPreAlloc);
+  }
+  return NULL;
+}
+
+static void
+encodeBatch(struct blockEncodeJob *jobs, unsigned numJobs,
+            GtUword numBlocks)
+{
+  unsigned jobNum;
+  GtUword blocksPerJob = numBlocks / numJobs;
+  for (jobNum = 0; jobNum < numJobs; ++jobNum)
+  {
+    jobs[jobNum].firstBlock = jobNum * blocksPerJob;
+    jobs[jobNum].endBlock = (jobNum == numJobs - 1)
+      ? numBlocks : (jobNum + 1) * blocksPerJob;
+  }
+#ifdef GT_THREADS_ENABLED
+  if (numJobs > 1 && blocksPerJob > 0)
+  {
+    for (jobNum = 0; jobNum < numJobs; ++jobNum)
+    {
+      jobs[jobNum].thread = gt_thread_new(encodeBlockRange, jobs + jobNum,
+                                          NULL);
+      gt_assert(jobs[jobNum].thread != NULL);
+    }
+    for (jobNum = 0; jobNum < numJobs; ++jobNum)
+    {
+      gt_thread_join(jobs[jobNum].thread);
+      gt_thread_delete(jobs[jobNum].thread);
+    }
+    return;
+  }
+#endif
+  for (jobNum = 0; jobNum < numJobs; ++jobNum)
+  {
+    encodeBlockRange(jobs + jobNum);
+  }
+}
+
+static void
+appendEncodedBlock2OutputBuffer(
+  struct blockCompositionSeq *newSeqIdx,
+  partialSymSum *buck, GtUword blockNum,
+  const Symbol *block, unsigned blockSize,
+  const MRAEnc *alphabet, const int *modes,
+  PermCompIndex permCompIdx[2], unsigned significantPermIdxBits,
+  unsigned compositionIdxBits, struct appendState *aState)
+{
+  addBlock2PartialSymSums(buck, block, blockSize);
+  addRangeEncodedSyms(newSeqIdx->rangeEncs, block, blockSize,
+                      blockNum, alphabet, REGIONS_LIST,
+                      modes);
+  append2IdxOutput(aState, permCompIdx, compositionIdxBits,
+                   significantPermIdxBits);
+}
+
 static int
 writeOutputBuffer(struct blockCompositionSeq *newSeqIdx,
                   struct appendState *aState, bitInsertFunc biFunc,
@@ -529,45 +635,110 @@ gt_newGenBlockEncIdxSeq(GtUword totalLen, const char *projectName,
         /* 2. read block sized chunks from bwttab and suffix array */
         {
           GtUword numFullBlocks = totalLen / blockSize, blockNum,
-            lastUpdatePos = 0;
+            lastUpdatePos = 0, batchBlocks;
           /* pos == totalLen - symbolsLeft */
           struct appendState aState;
-          initAppendState(&aState, newSeqIdx);
-          blockNum = 0;
-          while (blockNum < numFullBlocks)
+          struct blockEncodeJob *jobs;
+          Symbol *batch;
+          PermCompIndex *batchPermCompIdx;
+          unsigned *batchPermIdxBits, jobNum, numJobs = 1;
+#ifdef GT_THREADS_ENABLED
+          numJobs = gt_jobs;
+#endif
+          batchBlocks = (GtUword)bucketBlocks * BLOCK_ENCODE_BATCH_BUCKETS
+            * numJobs;
+          batch = gt_malloc(sizeof (Symbol) * batchBlocks * blockSize);
+          batchPermCompIdx = gt_malloc(sizeof (batchPermCompIdx[0])
+                                       * 2 * batchBlocks);
+          batchPermIdxBits = gt_malloc(sizeof (batchPermIdxBits[0])
+                                       * batchBlocks);
+          jobs = gt_malloc(sizeof (jobs[0]) * numJobs);
+          for (jobNum = 0; jobNum < numJobs; ++jobNum)
           {
-            size_t readResult;
-            /* 3. for each chunk: */
-            readResult = SDRRead(BWTGenerator, block, blockSize);
-            if (readResult != blockSize)
+            jobs[jobNum].compositionTable = &newSeqIdx->compositionTable;
+            jobs[jobNum].alphabet = alphabet;
+            jobs[jobNum].blockMapAlphabet = blockMapAlphabet;
+            jobs[jobNum].blockMapAlphabetSize = blockMapAlphabetSize;
+            jobs[jobNum].blockSize = blockSize;
+            jobs[jobNum].batch = batch;
+            jobs[jobNum].permCompIdx = batchPermCompIdx;
+            jobs[jobNum].permIdxBits = batchPermIdxBits;
+            if (jobNum == 0)
             {
-              hadGtError = 1;
-              perror("error condition while reading index data");
-              break;
+              jobs[jobNum].block = block;
+              jobs[jobNum].compositionPreAlloc = compositionPreAlloc;
+              jobs[jobNum].permCompBSPreAlloc = permCompBSPreAlloc;
             }
-            gt_MRAEncSymbolsTransform(alphabet, block, blockSize);
-            addBlock2OutputBuffer(newSeqIdx, buck, blockNum,
-                                  block, blockSize,
-                                  alphabet, modesCopy,
-                                  blockMapAlphabet, blockMapAlphabetSize,
-                                  permCompBSPreAlloc, compositionPreAlloc,
-                                  compositionIdxBits, &aState);
-            /* update on-disk structure */
-            if (!((++blockNum) % bucketBlocks))
+            else
             {
-              GtUword pos = blockNum * blockSize;
-              if (writeOutputBuffer(newSeqIdx, &aState, biFunc, lastUpdatePos,
-                                    bucketLen, callBackDataOffsetBits, cbState,
-                                    buckLast) < 0)
+              jobs[jobNum].block = gt_malloc(sizeof (Symbol) * blockSize);
+              jobs[jobNum].compositionPreAlloc
+                = gt_malloc(sizeof (compositionPreAlloc[0])
+                            * blockMapAlphabetSize);
+              jobs[jobNum].permCompBSPreAlloc
+                = gt_malloc(bitElemsAllocSize(bitsPerComposition
+                                              + bitsPerPermutation)
+                            * sizeof (BitElem));
+            }
+          }
+          initAppendState(&aState, newSeqIdx);
+          blockNum = 0;
+          while (!hadGtError && blockNum < numFullBlocks)
+          {
+            GtUword batchIdx, numBatchBlocks
+              = MIN(batchBlocks, numFullBlocks - blockNum);
+            for (batchIdx = 0; batchIdx < numBatchBlocks; ++batchIdx)
+            {
+              size_t readResult;
+              /* 3. for each chunk: */
+              readResult = SDRRead(BWTGenerator, batch + batchIdx * blockSize,
+                                   blockSize);
+              if (readResult != blockSize)
               {
                 hadGtError = 1;
+                perror("error condition while reading index data");
                 break;
               }
-              /* update retained data */
-              copyPartialSymSums(totalAlphabetSize, buckLast, buck);
-              lastUpdatePos = pos;
             }
+            if (hadGtError)
+              break;
+            encodeBatch(jobs, numJobs, numBatchBlocks);
+            for (batchIdx = 0; batchIdx < numBatchBlocks; ++batchIdx)
+            {
+              appendEncodedBlock2OutputBuffer(newSeqIdx, buck, blockNum,
+                                              batch + batchIdx * blockSize,
+                                              blockSize, alphabet, modesCopy,
+                                              batchPermCompIdx + 2 * batchIdx,
+                                              batchPermIdxBits[batchIdx],
+                                              compositionIdxBits, &aState);
+              /* update on-disk structure */
+              if (!((++blockNum) % bucketBlocks))
+              {
+                GtUword pos = blockNum * blockSize;
+                if (writeOutputBuffer(newSeqIdx, &aState, biFunc,
+                                      lastUpdatePos, bucketLen,
+                                      callBackDataOffsetBits, cbState,
+                                      buckLast) < 0)
+                {
+                  hadGtError = 1;
+                  break;
+                }
+                /* update retained data */
+                copyPartialSymSums(totalAlphabetSize, buckLast, buck);
+                lastUpdatePos = pos;
+              }
+            }
+          }
+          for (jobNum = 1; jobNum < numJobs; ++jobNum)
+          {
+            gt_free(jobs[jobNum].block);
+            gt_free(jobs[jobNum].compositionPreAlloc);
+            gt_free(jobs[jobNum].permCompBSPreAlloc);
           }
+          gt_free(jobs);
+          gt_free(batchPermIdxBits);
+          gt_free(batchPermCompIdx);
+          gt_free(batch);
           /* handle last chunk */
           if (!hadGtError)
           {
@@ -654,6 +825,13 @@ gt_newGenBlockEncIdxSeq(GtUword totalLen, const char *projectName,
   return &(newSeqIdx->baseClass);
 }
 
+void
+gt_blockEncIdxSeqUnpackBlocksForRank(EISeq *seqIdx, bool unpack)
+{
+  gt_assert(seqIdx && seqIdx->classInfo == &blockCompositionSeqClass);
+  encIdxSeq2blockCompositionSeq(seqIdx)->unpackBlocksForRank = unpack;
+}
+
 static void
 deleteBlockEncIdxSeq(struct encIdxSeq *seq)
 {
@@ -952,6 +1130,35 @@ fetchSuperBlock(const struct blockCompositionSeq *seqIdx,
   return retval;
 }
 
+void
+gt_blockEncIdxSeqPrefetch(const EISeq *seq, GtUword pos)
+{
+  const struct blockCompositionSeq *seqIdx;
+  gt_assert(seq && seq->classInfo == &blockCompositionSeqClass);
+  seqIdx = constEncIdxSeq2blockCompositionSeq(seq);
+#ifdef __GNUC__
+  /* only the memory mapped representation can be touched without
+   * copying, for the file based one there is nothing to gain */
+  if (seqIdxUsesMMap(seqIdx) && pos <= seqIdx->baseClass.seqLen)
+  {
+    BitOffset bucketOffset
+      = bucketNumFromPos(seqIdx, pos) * superBlockCWBits(seqIdx),
+      compIdxOffset = bucketOffset + cwPreCompIdxBits(seqIdx)
+      + (blockNumFromPos(seqIdx, pos) % seqIdx->bucketBlocks)
+      * seqIdx->compositionTable.compositionIdxBits;
+    /* partial symbol sums at the start of the superblock and the
+     * composition index of the block containing pos */
+    __builtin_prefetch(seqIdx->externalData.idxMMap
+                       + bucketOffset / bitElemBits * sizeof (BitElem), 0, 1);
+    __builtin_prefetch(seqIdx->externalData.idxMMap
+                       + compIdxOffset / bitElemBits * sizeof (BitElem), 0, 1);
+  }
+#else
+  (void) seqIdx;
+  (void) pos;
+#endif
+}
+
 static GtUword
 blockCompSeqSelect(GT_UNUSED struct encIdxSeq *seq, GT_UNUSED Symbol sym,
                    GT_UNUSED GtUword count, GT_UNUSED union EISHint *hint)
@@ -1064,19 +1271,28 @@ cacheFetchSuperBlock(const struct blockCompositionSeq *seqIdx,
                     codeForCompIndex, varOffset);                       \
   } while (0)
 
+static inline void
+getIndexPair(const struct blockCompositionSeq *seqIdx,
+             const struct superBlock *sBlock,
+             BitOffset cwOffset, BitOffset varOffset,
+             PermCompIndex *compIndex, PermCompIndex *permIndex)
+{
+  unsigned varIdxBits;
+  *compIndex = gt_bsGetPermCompIndex(sBlock->cwData, cwOffset,
+                                     seqIdx->compositionTable
+                                     .compositionIdxBits);
+  varIdxBits = seqIdx->compositionTable.permutations[*compIndex].permIdxBits;
+  *permIndex = gt_bsGetPermCompIndex(sBlock->varData, varOffset, varIdxBits);
+}
+
 static inline void
 unpackBlock(const struct blockCompositionSeq *seqIdx,
             const struct superBlock *sBlock,
             BitOffset cwOffset, BitOffset varOffset, Symbol *block,
             unsigned sublen)
 {
-  unsigned varIdxBits, bitsPerCompositionIdx;
   PermCompIndex compIndex, permIndex;
-  bitsPerCompositionIdx = seqIdx->compositionTable.compositionIdxBits;
-  compIndex = gt_bsGetPermCompIndex(sBlock->cwData, cwOffset,
-                                 bitsPerCompositionIdx);
-  varIdxBits = seqIdx->compositionTable.permutations[compIndex].permIdxBits;
-  permIndex = gt_bsGetPermCompIndex(sBlock->varData, varOffset, varIdxBits);
+  getIndexPair(seqIdx, sBlock, cwOffset, varOffset, &compIndex, &permIndex);
   indexPair2block(&seqIdx->compositionTable, seqIdx->blockSize,
                   compIndex, permIndex, block, sublen);
 }
@@ -1146,14 +1362,26 @@ adjustPosRankForBlock(struct blockCompositionSeq *seqIdx,
         gt_bsGetPermCompIndex(sBlock->cwData, cwIdxMemOffset,
                            bitsPerCompositionIdx), bSym))
   {
-    Symbol block[blockSize];
-    unsigned i;
-    unpackBlock(seqIdx, sBlock, cwIdxMemOffset, varDataMemOffset, block,
-                inBlockPos);
-    for (i = 0; i < inBlockPos; ++i)
+    if (seqIdx->unpackBlocksForRank)
+    {
+      Symbol block[blockSize];
+      unsigned i;
+      unpackBlock(seqIdx, sBlock, cwIdxMemOffset, varDataMemOffset, block,
+                  inBlockPos);
+      for (i = 0; i < inBlockPos; ++i)
+      {
+        if (block[i] == bSym)
+          ++rankCount;
+      }
+    }
+    else
     {
-      if (block[i] == bSym)
-        ++rankCount;
+      PermCompIndex compIndex, permIndex;
+      getIndexPair(seqIdx, sBlock, cwIdxMemOffset, varDataMemOffset,
+                   &compIndex, &permIndex);
+      rankCount += symCountFromIndexPairPrefix(&seqIdx->compositionTable,
+                                               blockSize, compIndex,
+                                               permIndex, bSym, inBlockPos);
     }
   }
   return rankCount;
@@ -1389,7 +1617,7 @@ adjustRanksForBlock(struct blockCompositionSeq *seqIdx,
                     BitOffset cwIdxMemOffset, BitOffset varDataMemOffset)
 {
   unsigned inBlockPos = pos % blockSize;
-  if (inBlockPos)
+  if (inBlockPos && seqIdx->unpackBlocksForRank)
   {
     Symbol block[blockSize];
     unsigned i;
@@ -1398,6 +1626,31 @@ adjustRanksForBlock(struct blockCompositionSeq *seqIdx,
     for (i = 0; i < inBlockPos; ++i)
       ++(rankCounts[block[i]]);
   }
+  else if (inBlockPos)
+  {
+    PermCompIndex compIndex, permIndex;
+    AlphabetRangeSize lastSym = seqIdx->blockMapAlphabetSize - 1;
+    unsigned remaining = inBlockPos;
+    Symbol bSym;
+    getIndexPair(seqIdx, sBlock, cwIdxMemOffset, varDataMemOffset,
+                 &compIndex, &permIndex);
+    /* the occurrences of the last symbol are the ones not counted
+     * for any other symbol */
+    for (bSym = 0; bSym < lastSym && remaining > 0; ++bSym)
+    {
+      unsigned symCount;
+      if (!symCountFromComposition(&seqIdx->compositionTable,
+                                   seqIdx->blockMapAlphabetSize, compIndex,
+                                   bSym))
+        continue;
+      symCount = symCountFromIndexPairPrefix(&seqIdx->compositionTable,
+                                             blockSize, compIndex, permIndex,
+                                             bSym, inBlockPos);
+      rankCounts[bSym] += symCount;
+      remaining -= symCount;
+    }
+    rankCounts[lastSym] += remaining;
+  }
 }
 
 static void
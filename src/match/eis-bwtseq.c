@@ -145,6 +145,25 @@ gt_deleteBWTSeq(BWTSeq *bwtSeq)
   gt_free(bwtSeq);
 }
 
+BWTSeq *
+gt_newBWTSeqView(const BWTSeq *bwtSeq)
+{
+  BWTSeq *view;
+  gt_assert(bwtSeq);
+  view = gt_malloc(sizeof (*view));
+  *view = *bwtSeq;
+  view->hint = newEISHint(bwtSeq->seqIdx);
+  return view;
+}
+
+void
+gt_deleteBWTSeqView(BWTSeq *view)
+{
+  if (!view) return;
+  deleteEISHint(view->seqIdx, view->hint);
+  gt_free(view);
+}
+
 typedef struct
 {
   const Mbtab **mbtab;
@@ -159,25 +178,18 @@ static const Mbtab *gt_prebwt_next(GtPrebwtstate *prebwt,unsigned int cc)
   return prebwt->mbtab[prebwt->depth] + prebwt->code;
 }
 
-static inline void
-getMatchBound(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
-              struct matchBound *match, bool forward)
+/* match the first symbols of a query, using the table of precomputed
+   bounds for short prefixes if the index provides one. Returns a pointer
+   to the first symbol which still has to be matched by rank queries. */
+static inline const Symbol *
+getMatchBoundPrefix(const BWTSeq *bwtSeq, const Symbol *qptr,
+                    const Symbol *qend, struct matchBound *match,
+                    bool forward)
 {
-  const Symbol *qptr, *qend;
   unsigned int cc;
   const Mbtab *mbptr;
   GtPrebwtstate prebwt;
 
-  gt_assert(bwtSeq && query);
-  if (forward)
-  {
-    qptr = query;
-    qend = query + queryLen;
-  } else
-  {
-    qptr = query + queryLen - 1;
-    qend = query - 1;
-  }
   gt_assert(ISNOTSPECIAL(*qptr));
   cc = (unsigned int) *qptr;
   prebwt.mbtab = gt_bwtseq2mbtab((const FMindex *) bwtSeq);
@@ -192,34 +204,138 @@ getMatchBound(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
     match->end = mbptr->upperbound;
   } else
   {
-    prebwt.numofchars = GT_UNDEF_UINT;
-    prebwt.maxdepth = GT_UNDEF_UINT;
-    prebwt.code = 0;
-    prebwt.depth = GT_UNDEF_UINT;
     match->start = bwtSeq->count[cc];
     match->end   = bwtSeq->count[cc + 1];
   }
   qptr = forward ? (qptr+1) : (qptr-1);
+  if (prebwt.mbtab != NULL)
+  {
+    while (match->start < match->end && qptr != qend &&
+           prebwt.depth < prebwt.maxdepth)
+    {
+      gt_assert(ISNOTSPECIAL(*qptr));
+      mbptr = gt_prebwt_next(&prebwt,(unsigned int) *qptr);
+      match->start = mbptr->lowerbound;
+      match->end = mbptr->upperbound;
+      qptr = forward ? (qptr+1) : (qptr-1);
+    }
+  }
+  return qptr;
+}
+
+static inline void
+getMatchBound(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
+              struct matchBound *match, bool forward)
+{
+  const Symbol *qptr, *qend;
+  unsigned int cc;
+
+  gt_assert(bwtSeq && query);
+  if (forward)
+  {
+    qptr = query;
+    qend = query + queryLen;
+  } else
+  {
+    qptr = query + queryLen - 1;
+    qend = query - 1;
+  }
+  qptr = getMatchBoundPrefix(bwtSeq, qptr, qend, match, forward);
   while (match->start < match->end && qptr != qend)
   {
     GtUwordPair occPair;
 
     gt_assert(ISNOTSPECIAL(*qptr));
     cc = (unsigned int) *qptr;
-    if (prebwt.mbtab != NULL && prebwt.depth < prebwt.maxdepth)
+    occPair = BWTSeqTransformedPosPairOcc(bwtSeq, (Symbol) cc, match->start,
+                                          match->end);
+    match->start = bwtSeq->count[cc] + occPair.a;
+    match->end   = bwtSeq->count[cc] + occPair.b;
+    qptr = forward ? (qptr+1) : (qptr-1);
+  }
+}
+
+/* The batch versions of the searches below keep the state of each
+   unfinished query in a table and advance all of them by one symbol per
+   round. After each step, the rank data for the next step of the same
+   query is prefetched, so the memory accesses of the remaining queries
+   of the round overlap with the resulting cache misses. */
+
+typedef struct
+{
+  const Symbol *qptr;
+  struct matchBound bound;
+  GtUword prevlbound,
+          idx;
+} BWTSeqBatchState;
+
+static inline void
+prefetchMatchBound(const BWTSeq *bwtSeq, const struct matchBound *bound)
+{
+  gt_blockEncIdxSeqPrefetch(bwtSeq->seqIdx, bound->start);
+  gt_blockEncIdxSeqPrefetch(bwtSeq->seqIdx, bound->end);
+}
+
+void
+gt_BWTSeqMatchBoundBatch(const BWTSeq *bwtSeq, GtUword numofqueries,
+                         const Symbol * const *querytab,
+                         const GtUword *querylentab,
+                         struct matchBound *boundtab)
+{
+  BWTSeqBatchState *statetab;
+  GtUword idx, numofactive = 0;
+
+  gt_assert(bwtSeq && querytab && querylentab && boundtab);
+  statetab = gt_malloc(sizeof (*statetab) * numofqueries);
+  for (idx = 0; idx < numofqueries; idx++)
+  {
+    BWTSeqBatchState *state = statetab + numofactive;
+    const Symbol *qend = querytab[idx] + querylentab[idx];
+
+    gt_assert(querylentab[idx] > 0);
+    state->qptr = getMatchBoundPrefix(bwtSeq, querytab[idx], qend,
+                                      &state->bound, true);
+    if (state->bound.start < state->bound.end && state->qptr != qend)
     {
-      mbptr = gt_prebwt_next(&prebwt,cc);
-      match->start = mbptr->lowerbound;
-      match->end = mbptr->upperbound;
+      state->idx = idx;
+      prefetchMatchBound(bwtSeq, &state->bound);
+      numofactive++;
     } else
     {
-      occPair = BWTSeqTransformedPosPairOcc(bwtSeq, (Symbol) cc, match->start,
-                                            match->end);
-      match->start = bwtSeq->count[cc] + occPair.a;
-      match->end   = bwtSeq->count[cc] + occPair.b;
+      boundtab[idx] = state->bound;
     }
-    qptr = forward ? (qptr+1) : (qptr-1);
   }
+  while (numofactive > 0)
+  {
+    GtUword nextactive = 0;
+
+    for (idx = 0; idx < numofactive; idx++)
+    {
+      BWTSeqBatchState *state = statetab + idx;
+      GtUwordPair occPair;
+      unsigned int cc;
+
+      gt_assert(ISNOTSPECIAL(*state->qptr));
+      cc = (unsigned int) *state->qptr;
+      occPair = BWTSeqTransformedPosPairOcc(bwtSeq, (Symbol) cc,
+                                            state->bound.start,
+                                            state->bound.end);
+      state->bound.start = bwtSeq->count[cc] + occPair.a;
+      state->bound.end   = bwtSeq->count[cc] + occPair.b;
+      state->qptr++;
+      if (state->bound.start < state->bound.end &&
+          state->qptr != querytab[state->idx] + querylentab[state->idx])
+      {
+        prefetchMatchBound(bwtSeq, &state->bound);
+        statetab[nextactive++] = *state;
+      } else
+      {
+        boundtab[state->idx] = state->bound;
+      }
+    }
+    numofactive = nextactive;
+  }
+  gt_free(statetab);
 }
 
 GtUword gt_packedindexuniqueforward(const BWTSeq *bwtSeq,
@@ -363,6 +479,92 @@ GtUword gt_packedindexmstatsforward(const BWTSeq *bwtSeq,
   return matchlength;
 }
 
+void gt_packedindexmstatsforward_batch(const BWTSeq *bwtSeq,
+                                       GtUword numofqueries,
+                                       const GtUchar * const *qstarttab,
+                                       const GtUchar *qend,
+                                       GtUword *matchlengthtab,
+                                       GtUword *witnessleftboundtab)
+{
+  BWTSeqBatchState *statetab;
+  const MRAEnc *alphabet;
+  GtUword idx, numofactive = 0;
+
+  gt_assert(bwtSeq && qstarttab && matchlengthtab);
+  alphabet = BWTSeqGetAlphabet(bwtSeq);
+  statetab = gt_malloc(sizeof (*statetab) * numofqueries);
+  for (idx = 0; idx < numofqueries; idx++)
+  {
+    BWTSeqBatchState *state = statetab + numofactive;
+    Symbol curSym;
+
+    gt_assert(qstarttab[idx] < qend);
+    matchlengthtab[idx] = 0;
+    if (ISSPECIAL(*qstarttab[idx]))
+    {
+      continue;
+    }
+    curSym = MRAEncMapSymbol(alphabet, *qstarttab[idx]);
+    state->bound.start = bwtSeq->count[curSym];
+    state->bound.end = bwtSeq->count[curSym+1];
+    if (state->bound.start >= state->bound.end)
+    {
+      continue;
+    }
+    state->prevlbound = state->bound.start;
+    state->qptr = qstarttab[idx] + 1;
+    if (state->qptr < qend && ISNOTSPECIAL(*state->qptr))
+    {
+      state->idx = idx;
+      prefetchMatchBound(bwtSeq, &state->bound);
+      numofactive++;
+    } else
+    {
+      matchlengthtab[idx] = 1UL;
+      if (witnessleftboundtab != NULL)
+      {
+        witnessleftboundtab[idx] = state->prevlbound;
+      }
+    }
+  }
+  while (numofactive > 0)
+  {
+    GtUword nextactive = 0;
+
+    for (idx = 0; idx < numofactive; idx++)
+    {
+      BWTSeqBatchState *state = statetab + idx;
+      GtUwordPair seqpospair;
+      Symbol curSym = MRAEncMapSymbol(alphabet, *state->qptr);
+
+      seqpospair = BWTSeqTransformedPosPairOcc(bwtSeq, curSym,
+                                               state->bound.start,
+                                               state->bound.end);
+      state->bound.start = bwtSeq->count[curSym] + seqpospair.a;
+      state->bound.end = bwtSeq->count[curSym] + seqpospair.b;
+      if (state->bound.start < state->bound.end)
+      {
+        state->prevlbound = state->bound.start;
+        state->qptr++;
+        if (state->qptr < qend && ISNOTSPECIAL(*state->qptr))
+        {
+          prefetchMatchBound(bwtSeq, &state->bound);
+          statetab[nextactive++] = *state;
+          continue;
+        }
+      }
+      matchlengthtab[state->idx]
+        = (GtUword) (state->qptr - qstarttab[state->idx]);
+      if (witnessleftboundtab != NULL)
+      {
+        witnessleftboundtab[state->idx] = state->prevlbound;
+      }
+    }
+    numofactive = nextactive;
+  }
+  gt_free(statetab);
+}
+
 GtUword
 gt_BWTSeqMatchCount(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
                  bool forward)
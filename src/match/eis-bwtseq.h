@@ -106,6 +106,25 @@ gt_loadBWTSeq(const char *projectName, int BWTOptFlags, GtLogger *verbosity,
 void
 gt_deleteBWTSeq(BWTSeq *bwtseq);
 
+/**
+ * \brief Create a second handle to a BWT sequence object for use in
+ * another thread. The handle shares the index data with bwtSeq but has
+ * its own query cache, so queries on different handles can run
+ * concurrently.
+ * Warning: the view becomes invalid once bwtSeq has been deleted.
+ * @param bwtSeq reference of object to create view of
+ * @return reference of the new view
+ */
+BWTSeq *
+gt_newBWTSeqView(const BWTSeq *bwtSeq);
+
+/**
+ * \brief Deallocate a view created by gt_newBWTSeqView.
+ * @param view reference of view to delete
+ */
+void
+gt_deleteBWTSeqView(BWTSeq *view);
+
 /**
  * \brief Query BWT sequence object for availability of added
  * information to locate matches.
@@ -301,6 +320,25 @@ GtUword
 gt_BWTSeqMatchCount(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
                  bool forward);
 
+/**
+ * \brief Compute the match bounds of a batch of query strings, processed
+ * in forward direction. The backward search steps of the queries are
+ * interleaved and the rank data needed by the next step of each query is
+ * prefetched, which hides much of the memory latency of the individual
+ * rank queries. The result for each query equals the bounds computed by
+ * gt_initEMIterator.
+ * @param bwtSeq reference of sequence index to query
+ * @param numofqueries number of query strings
+ * @param querytab table of numofqueries query strings
+ * @param querylentab table of the lengths of the query strings, each > 0
+ * @param boundtab the bounds of query i are stored in boundtab[i]
+ */
+void
+gt_BWTSeqMatchBoundBatch(const BWTSeq *bwtSeq, GtUword numofqueries,
+                         const Symbol * const *querytab,
+                         const GtUword *querylentab,
+                         struct matchBound *boundtab);
+
 /**
  * \brief Given a pair of limiting positions in the suffix array and a
  * symbol, compute the interval reached by matching one symbol further.
@@ -511,6 +549,27 @@ GtUword gt_packedindexmstatsforward(const BWTSeq *bwtseq,
                                        const GtUchar *qstart,
                                        const GtUchar *qend);
 
+/**
+ * @brief batch version of gt_packedindexmstatsforward for queries sharing
+ * the same end, typically all suffixes of one sequence. The search steps
+ * of the queries are interleaved as in gt_BWTSeqMatchBoundBatch.
+ * @param bwtseq packed index
+ * @param numofqueries number of queries
+ * @param qstarttab table of the start positions of the queries
+ * @param qend points to memory area immediately after the queries
+ * @param matchlengthtab the matching statistics of query i are stored
+ * in matchlengthtab[i]
+ * @param witnessleftboundtab if not NULL, the left bound of the interval
+ * of the match of query i is stored in witnessleftboundtab[i] for all i
+ * with matchlengthtab[i] > 0
+ */
+void gt_packedindexmstatsforward_batch(const BWTSeq *bwtseq,
+                                       GtUword numofqueries,
+                                       const GtUchar * const *qstarttab,
+                                       const GtUchar *qend,
+                                       GtUword *matchlengthtab,
+                                       GtUword *witnessleftboundtab);
+
 #include "match/eis-bwtseq-siop.h"
 
 #endif
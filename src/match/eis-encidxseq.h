@@ -419,6 +419,28 @@ gt_EISVerifyIntegrity(EISeq *seqIdx, const char *projectName,
                       GtUword tickPrint, FILE *fp, int chkFlags,
                       GtLogger *verbosity, GtError *err);
 
+/**
+ * @brief Select how rank queries of a block-composition index count
+ * the symbols in a partially covered block: directly in the packed
+ * representation (the default) or after unpacking the block symbol by
+ * symbol. Both give the same results, this is meant for benchmarking.
+ * @param seqIdx block-composition index
+ * @param unpack true to unpack blocks
+ */
+void
+gt_blockEncIdxSeqUnpackBlocksForRank(EISeq *seqIdx, bool unpack);
+
+/**
+ * @brief Hint the processor that a rank query for position pos of a
+ * block-composition index is about to follow, so the constant width
+ * data of the corresponding superblock can be loaded ahead of time.
+ * Has no effect unless the index is memory mapped.
+ * @param seqIdx block-composition index
+ * @param pos position of the upcoming rank query
+ */
+void
+gt_blockEncIdxSeqPrefetch(const EISeq *seqIdx, GtUword pos);
+
 /**
  * @brief Position file pointer at header written by upper layer.
  * @param seqIdx index to search header in
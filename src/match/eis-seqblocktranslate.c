@@ -233,6 +233,13 @@ gt_initCompositionList(struct compList *newList, unsigned blockSize,
     gt_assert(permSum == gt_power_for_small_exponents(alphabetSize, blockSize));
   }
   newList->maxPermIdxBits = gt_requiredUInt64Bits(maxNumPermutations - 1);
+  {
+    unsigned symNum;
+    newList->symsPerWord = 64 / newList->bitsPerSymbol;
+    newList->symLowBits = 0;
+    for (symNum = 0; symNum < newList->symsPerWord; ++symNum)
+      newList->symLowBits |= (uint64_t)1 << (symNum * newList->bitsPerSymbol);
+  }
   gt_free(composition);
   return 1;
 }
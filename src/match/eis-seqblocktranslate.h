@@ -67,8 +67,12 @@ struct compList
   unsigned bitsPerCount,        /**< bits required to hold one value 0..q */
     bitsPerSymbol,              /**< bits for each symbol */
     compositionIdxBits,         /**< gt_log_2 of numcompositions */
-    maxPermIdxBits;             /**< maximum bit length of permutation
+    maxPermIdxBits,             /**< maximum bit length of permutation
                                  *   indices */
+    symsPerWord;                /**< number of symbols packed into
+                                 *   64 bits */
+  uint64_t symLowBits;          /**< lowest bit of each of the
+                                 *   symsPerWord symbol fields set */
 };
 
 /**
@@ -162,6 +166,72 @@ indexPair2block(const struct compList *compositionTable, unsigned blockSize,
     compositionTable->bitsPerSymbol, subLen, block);
 }
 
+/* we use the buildin_popcount if a GNU compatible compiler is used
+   and the compiler option -mpopcnt is on. */
+#if defined (__GNUC__) && defined (__POPCNT__)
+static inline unsigned
+symFieldsCount(uint64_t v)
+{
+  return (unsigned) __builtin_popcountll(v);
+}
+#else
+static inline unsigned
+symFieldsCount(uint64_t v)
+{
+  return bitCountUInt32((uint32_t) (v & (uint64_t) UINT32_MAX)) +
+         bitCountUInt32((uint32_t) (v >> 32));
+}
+#endif
+
+/**
+ * @brief Find how often a symbol occurs in the first subLen symbols of
+ * the q-word given by pair of indices, without unpacking it.
+ *
+ * Up to symsPerWord symbols of the packed permutation are read as one
+ * 64 bit word and compared to the symbol in parallel: after xor-ing
+ * with the replicated symbol, a field is non-zero iff adding the
+ * field-wise maximum of its lower bits carries into its top bit. The
+ * non-zero fields are then counted with a population count.
+ * @param compositionTable
+ * @param blockSize q-word length (must be same as used on construction)
+ * @param compIdx composition index
+ * @param permIdx permutation index
+ * @param sym symbol to count
+ * @param subLen only count in this many symbols
+ * @return number of symbol occurrences
+ */
+static inline unsigned
+symCountFromIndexPairPrefix(const struct compList *compositionTable,
+                            unsigned blockSize, PermCompIndex compIdx,
+                            PermCompIndex permIdx, Symbol sym,
+                            unsigned subLen)
+{
+  unsigned bitsPerSymbol = compositionTable->bitsPerSymbol, count = 0;
+  BitOffset offset = compositionTable->permutations[compIdx].catPermsOffset
+    + (BitOffset)bitsPerSymbol * blockSize * permIdx;
+  uint64_t lowBits = compositionTable->symLowBits,
+    highBits = lowBits << (bitsPerSymbol - 1),
+    lowerMax = highBits - lowBits,
+    pattern = lowBits * sym;
+  gt_assert(subLen <= blockSize);
+  while (subLen > 0)
+  {
+    unsigned numSyms = subLen < compositionTable->symsPerWord
+      ? subLen : compositionTable->symsPerWord,
+      numBits = numSyms * bitsPerSymbol;
+    uint64_t mask = numBits < 64 ? ((uint64_t)1 << numBits) - 1
+      : ~(uint64_t)0,
+      diff = (gt_bsGetUInt64(compositionTable->catCompsPerms, offset, numBits)
+              ^ pattern) & mask;
+    count += numSyms
+      - symFieldsCount((((diff & lowerMax) + lowerMax) | diff) & highBits
+                       & mask);
+    offset += numBits;
+    subLen -= numSyms;
+  }
+  return count;
+}
+
 /**
  * @brief Find how often a symbol occurs in a composition given by index
  * @param compositionTable
@@ -413,6 +413,16 @@ void gt_deletevoidBWTSeq(FMindex *fmindex)
   gt_deleteBWTSeq(bwtseq);
 }
 
+FMindex *gt_newvoidBWTSeqView(const FMindex *fmindex)
+{
+  return (FMindex *) gt_newBWTSeqView((const BWTSeq *) fmindex);
+}
+
+void gt_deletevoidBWTSeqView(FMindex *view)
+{
+  gt_deleteBWTSeqView((BWTSeq *) view);
+}
+
 GtUword gt_voidpackedindexuniqueforward(const void *fmindex,
                                               GT_UNUSED GtUword offset,
                                               GT_UNUSED GtUword left,
@@ -458,21 +468,44 @@ GtUword gt_voidpackedindexmstatsforward(const void *fmindex,
   return matchlength;
 }
 
-bool gt_pck_exactpatternmatching(const FMindex *fmindex,
-                                 const GtUchar *pattern,
+void gt_voidpackedindexmstatsforward_batch(const void *fmindex,
+                                           GtUword numofqueries,
+                                           const GtUchar * const *qstarttab,
+                                           const GtUchar *qend,
+                                           GtUword *matchlengthtab,
+                                           GtUword *witnesspositiontab)
+{
+  GtUword idx;
+
+  gt_packedindexmstatsforward_batch((const BWTSeq *) fmindex,numofqueries,
+                                    qstarttab,qend,matchlengthtab,
+                                    witnesspositiontab);
+  if (witnesspositiontab != NULL)
+  {
+    for (idx = 0; idx < numofqueries; idx++)
+    {
+      if (matchlengthtab[idx] > 0)
+      {
+        witnesspositiontab[idx]
+          = gt_voidpackedfindfirstmatchconvert(fmindex,
+                                               witnesspositiontab[idx],
+                                               matchlengthtab[idx]);
+      }
+    }
+  }
+}
+
+static bool pck_enumeratematches(const FMindex *fmindex,
+                                 BWTSeqExactMatchesIterator *bsemi,
                                  GtUword patternlength,
                                  GtUword totallength,
                                  const GtUchar *dbsubstring,
                                  ProcessIdxMatch processmatch,
                                  void *processmatchinfo)
 {
-  BWTSeqExactMatchesIterator *bsemi;
   GtUword dbstartpos, numofmatches;
   GtIdxMatch match;
 
-  bsemi = gt_newEMIterator((const BWTSeq *) fmindex,
-                           pattern,(size_t) patternlength, true);
-  gt_assert(bsemi != NULL);
   numofmatches = gt_EMINumMatchesTotal(bsemi);
   match.dbabsolute = true;
   match.dblen = patternlength;
@@ -487,12 +520,69 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
     match.dbstartpos = totallength - (dbstartpos + patternlength);
     processmatch(processmatchinfo,&match);
   }
-  if (bsemi != NULL)
+  return numofmatches > 0 ? true : false;
+}
+
+bool gt_pck_exactpatternmatching(const FMindex *fmindex,
+                                 const GtUchar *pattern,
+                                 GtUword patternlength,
+                                 GtUword totallength,
+                                 const GtUchar *dbsubstring,
+                                 ProcessIdxMatch processmatch,
+                                 void *processmatchinfo)
+{
+  BWTSeqExactMatchesIterator *bsemi;
+  bool found;
+
+  bsemi = gt_newEMIterator((const BWTSeq *) fmindex,
+                           pattern,(size_t) patternlength, true);
+  gt_assert(bsemi != NULL);
+  found = pck_enumeratematches(fmindex,bsemi,patternlength,totallength,
+                               dbsubstring,processmatch,processmatchinfo);
+  gt_deleteEMIterator(bsemi);
+  return found;
+}
+
+void gt_pck_exactpatternmatching_batch(const FMindex *fmindex,
+                                       GtUword numofpatterns,
+                                       const GtUchar * const *patterntab,
+                                       const GtUword *patternlentab,
+                                       GtUwordPair *boundtab)
+{
+  struct matchBound *matchboundtab;
+  GtUword idx;
+
+  matchboundtab = gt_malloc(sizeof (*matchboundtab) * numofpatterns);
+  gt_BWTSeqMatchBoundBatch((const BWTSeq *) fmindex,numofpatterns,
+                           patterntab,patternlentab,matchboundtab);
+  for (idx = 0; idx < numofpatterns; idx++)
   {
-    gt_deleteEMIterator(bsemi);
-    bsemi = NULL;
+    boundtab[idx].a = matchboundtab[idx].start;
+    boundtab[idx].b = matchboundtab[idx].end;
   }
-  return numofmatches > 0 ? true : false;
+  gt_free(matchboundtab);
+}
+
+bool gt_pck_exactpatternmatching_bound(const FMindex *fmindex,
+                                       const GtUwordPair *bound,
+                                       GtUword patternlength,
+                                       GtUword totallength,
+                                       const GtUchar *dbsubstring,
+                                       ProcessIdxMatch processmatch,
+                                       void *processmatchinfo)
+{
+  BWTSeqExactMatchesIterator bsemi;
+  GT_UNUSED bool initialized;
+  bool found;
+
+  initialized = gt_initEmptyEMIterator(&bsemi,(const BWTSeq *) fmindex);
+  gt_assert(initialized);
+  bsemi.bounds.start = bsemi.nextMatchBWTPos = bound->a;
+  bsemi.bounds.end = bound->b;
+  found = pck_enumeratematches(fmindex,&bsemi,patternlength,totallength,
+                               dbsubstring,processmatch,processmatchinfo);
+  gt_destructEMIterator(&bsemi);
+  return found;
 }
 
 GtUword gt_voidpackedindex_totallength_get(const FMindex *fmindex)
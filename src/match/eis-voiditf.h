@@ -83,6 +83,13 @@ FMindex *gt_loadvoidBWTSeqForSA(const char *indexname,
 
 void gt_deletevoidBWTSeq(FMindex *packedindex);
 
+/* a view shares the index with the given packed index but can be
+   queried concurrently to it, e.g. in another thread */
+
+FMindex *gt_newvoidBWTSeqView(const FMindex *fmindex);
+
+void gt_deletevoidBWTSeqView(FMindex *view);
+
 /* the parameter is const void *, as this is required by the other
    indexed based methods */
 
@@ -114,6 +121,35 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
                                  ProcessIdxMatch processmatch,
                                  void *processmatchinfo);
 
+/* batch version of gt_voidpackedindexmstatsforward for queries ending at
+   qend. The backward search steps of the queries are interleaved, so the
+   memory latencies of the rank queries overlap. */
+
+void gt_voidpackedindexmstatsforward_batch(const void *fmindex,
+                                           GtUword numofqueries,
+                                           const GtUchar * const *qstarttab,
+                                           const GtUchar *qend,
+                                           GtUword *matchlengthtab,
+                                           GtUword *witnesspositiontab);
+
+/* compute the bwt-intervals (a,b) of a batch of patterns by interleaved
+   backward searches. The matches of each pattern are afterwards reported
+   by gt_pck_exactpatternmatching_bound. */
+
+void gt_pck_exactpatternmatching_batch(const FMindex *fmindex,
+                                       GtUword numofpatterns,
+                                       const GtUchar * const *patterntab,
+                                       const GtUword *patternlentab,
+                                       GtUwordPair *boundtab);
+
+bool gt_pck_exactpatternmatching_bound(const FMindex *fmindex,
+                                       const GtUwordPair *bound,
+                                       GtUword patternlength,
+                                       GtUword totallength,
+                                       const GtUchar *dbsubstring,
+                                       ProcessIdxMatch processmatch,
+                                       void *processmatchinfo);
+
 GtUword gt_voidpackedfindfirstmatchconvert(const FMindex *fmindex,
                                                  GtUword witnessbound,
                                                  GtUword matchlength);
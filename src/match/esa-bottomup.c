@@ -18,6 +18,10 @@
 
 #include <limits.h>
 #include "core/ma.h"
+#include "core/divmodmul.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#endif
 #include "esa-bottomup.h"
 #include "esa-seqread.h"
 #include "esa_visitor.h"
@@ -113,24 +117,30 @@ static GtBUItvinfo *allocateBUstack(GtBUItvinfo *ptr,
   return itvinfo;
 }
 
-int gt_esa_bottomup(Sequentialsuffixarrayreader *ssar,
-                    GtESAVisitor *ev,
-                    GtError *err)
+/* traverse the suffixes with index in the range <firstidx> to <endidx>-1.
+   For a proper subrange, <firstidx> must be the left boundary of a child
+   of the root and the next values delivered by <ssar> must be those
+   for this index. */
+
+static int gt_esa_bottomup_range(Sequentialsuffixarrayreader *ssar,
+                                 GtUword firstidx,
+                                 GtUword endidx,
+                                 bool firstedgefromroot,
+                                 GtESAVisitor *ev,
+                                 GtError *err)
 {
   const GtUword incrementstacksize = 32UL;
   GtUword lcpvalue,
                 previoussuffix = 0,
                 idx,
-                nonspecials,
                 lastsuftabvalue = 0;
   GtBUItvinfo *lastinterval = NULL;
-  bool haserr = false, firstedge, firstedgefromroot = true;
+  bool haserr = false, firstedge;
   GtArrayGtBUItvinfo *stack;
 
   stack = gt_GtArrayGtBUItvinfo_new();
   PUSH_ESA_BOTTOMUP(0,0);
-  nonspecials = gt_Sequentialsuffixarrayreader_nonspecials(ssar);
-  for (idx = 0; idx < nonspecials; idx++)
+  for (idx = firstidx; idx < endidx; idx++)
   {
     SSAR_NEXTSEQUENTIALLCPTABVALUEWITHLAST(lcpvalue,lastsuftabvalue,ssar);
     SSAR_NEXTSEQUENTIALSUFTABVALUE(previoussuffix,ssar);
@@ -272,6 +282,200 @@ int gt_esa_bottomup(Sequentialsuffixarrayreader *ssar,
   return haserr ? -1 : 0;
 }
 
+int gt_esa_bottomup(Sequentialsuffixarrayreader *ssar,
+                    GtESAVisitor *ev,
+                    GtError *err)
+{
+  return gt_esa_bottomup_range(ssar,
+                               0,
+                               gt_Sequentialsuffixarrayreader_nonspecials(ssar),
+                               true,
+                               ev,
+                               err);
+}
+
+typedef struct
+{
+  Sequentialsuffixarrayreader ssar;
+  GtUword firstidx, endidx;
+  GtESAVisitor *ev;
+  GtError *err;
+  int retval;
+#ifdef GT_THREADS_ENABLED
+  GtThread *thread;
+#endif
+} GtBUpartinfo;
+
+/* return the number of large lcp-values at positions smaller than <pos> */
+
+static GtUword gt_esa_bottomup_largelcpindex(const Suffixarray *suffixarray,
+                                             GtUword pos)
+{
+  GtUword left = 0, right, mid;
+
+  if (!suffixarray->numoflargelcpvalues.defined)
+  {
+    return 0;
+  }
+  right = suffixarray->numoflargelcpvalues.valueunsignedlong;
+  while (left < right)
+  {
+    mid = left + GT_DIV2(right - left);
+    if (suffixarray->llvtab[mid].position < pos)
+    {
+      left = mid + 1;
+    } else
+    {
+      right = mid;
+    }
+  }
+  return left;
+}
+
+static void *gt_esa_bottomup_part(void *data)
+{
+  GtBUpartinfo *part = (GtBUpartinfo *) data;
+
+  part->retval = gt_esa_bottomup_range(&part->ssar,
+                                       part->firstidx,
+                                       part->endidx,
+                                       part->firstidx == 0 ? true : false,
+                                       part->ev,
+                                       part->err);
+  return NULL;
+}
+
+/* The children of the root are independent subtrees of the lcp-interval
+   tree. So we split the suffix array at the positions with lcp-value 0
+   into at most <numofparts> parts of roughly the same size. */
+
+static GtUword gt_esa_bottomup_split(GtUword *boundaries,
+                                     const Suffixarray *suffixarray,
+                                     GtUword nonspecials,
+                                     unsigned int numofparts,
+                                     GtUword splitlcp)
+{
+  GtUword partnum, numofboundaries = 0, pos = 1UL;
+
+  boundaries[numofboundaries++] = 0;
+  for (partnum = 1UL; partnum < (GtUword) numofparts; partnum++)
+  {
+    GtUword target = partnum * (nonspecials/numofparts);
+
+    if (pos < target)
+    {
+      pos = target;
+    }
+    while (pos < nonspecials && lcptable_get(suffixarray,pos) >= splitlcp)
+    {
+      pos++;
+    }
+    if (pos >= nonspecials)
+    {
+      break;
+    }
+    boundaries[numofboundaries++] = pos++;
+  }
+  boundaries[numofboundaries] = nonspecials;
+  return numofboundaries;
+}
+
+unsigned int gt_esa_bottomup_split_reader(Sequentialsuffixarrayreader *ssartab,
+                                          const Sequentialsuffixarrayreader
+                                            *ssar,
+                                          unsigned int numofparts,
+                                          GtUword splitlcp)
+{
+  const Suffixarray *suffixarray = ssar->suffixarray;
+  GtUword idx, numofboundaries, *boundaries;
+
+  gt_assert(!ssar->scanfile && numofparts > 0);
+  boundaries = gt_malloc(sizeof (*boundaries) * (numofparts + 1));
+  numofboundaries
+    = gt_esa_bottomup_split(boundaries, suffixarray,
+                            gt_Sequentialsuffixarrayreader_nonspecials(ssar),
+                            numofparts,
+                            splitlcp);
+  for (idx = 0; idx < numofboundaries; idx++)
+  {
+    Sequentialsuffixarrayreader *partssar = ssartab + idx;
+
+    *partssar = *ssar;
+    partssar->nonspecials = boundaries[idx+1] - boundaries[idx];
+    partssar->nextsuftabindex = boundaries[idx];
+    partssar->nextlcptabindex = boundaries[idx] + 1;
+    partssar->largelcpindex
+      = gt_esa_bottomup_largelcpindex(suffixarray, boundaries[idx] + 1);
+  }
+  gt_free(boundaries);
+  return (unsigned int) numofboundaries;
+}
+
+int gt_esa_bottomup_parallel(const Sequentialsuffixarrayreader *ssar,
+                             GtESAVisitor **evtab,
+                             unsigned int numofparts,
+                             GtError *err)
+{
+  Sequentialsuffixarrayreader *ssartab;
+  GtUword idx, numofboundaries;
+  GtBUpartinfo *parttab;
+  bool haserr = false;
+
+  ssartab = gt_malloc(sizeof (*ssartab) * numofparts);
+  numofboundaries = (GtUword) gt_esa_bottomup_split_reader(ssartab, ssar,
+                                                           numofparts, 1UL);
+  parttab = gt_malloc(sizeof (*parttab) * numofboundaries);
+  for (idx = 0; idx < numofboundaries; idx++)
+  {
+    GtBUpartinfo *part = parttab + idx;
+
+    part->ssar = ssartab[idx];
+    part->firstidx = part->ssar.nextsuftabindex;
+    part->endidx = part->firstidx
+                   + gt_Sequentialsuffixarrayreader_nonspecials(&part->ssar);
+    part->ev = evtab[idx];
+    part->err = idx == 0 ? err : gt_error_new();
+    part->retval = 0;
+  }
+  gt_free(ssartab);
+#ifdef GT_THREADS_ENABLED
+  for (idx = 1UL; idx < numofboundaries; idx++)
+  {
+    parttab[idx].thread = gt_thread_new(gt_esa_bottomup_part, parttab + idx,
+                                        NULL);
+    gt_assert(parttab[idx].thread != NULL);
+  }
+  (void) gt_esa_bottomup_part(parttab);
+  for (idx = 1UL; idx < numofboundaries; idx++)
+  {
+    gt_thread_join(parttab[idx].thread);
+    gt_thread_delete(parttab[idx].thread);
+  }
+#else
+  for (idx = 0; idx < numofboundaries; idx++)
+  {
+    (void) gt_esa_bottomup_part(parttab + idx);
+  }
+#endif
+  for (idx = 0; idx < numofboundaries; idx++)
+  {
+    if (!haserr && parttab[idx].retval != 0)
+    {
+      haserr = true;
+      if (idx > 0)
+      {
+        gt_error_set(err, "%s", gt_error_get(parttab[idx].err));
+      }
+    }
+    if (idx > 0)
+    {
+      gt_error_delete(parttab[idx].err);
+    }
+  }
+  gt_free(parttab);
+  return haserr ? -1 : 0;
+}
+
 int gt_esa_bottomup_RAM(const GtUword *suftab,
                         const uint16_t *lcptab_bucket,
                         GtUword nonspecials,
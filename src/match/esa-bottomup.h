@@ -32,6 +32,37 @@ int gt_esa_bottomup(Sequentialsuffixarrayreader *ssar,
                     GtESAVisitor *ev,
                     GtError *err);
 
+/* Same as <gt_esa_bottomup>, but the suffix array of the mapped (not
+   streamed) index <ssar> is split at the boundaries of the children of the
+   root into at most <numofparts> parts, which are traversed in parallel.
+   Part <i> is reported to the visitor <evtab[i]>, so <evtab> must hold
+   <numofparts> distinct visitors of the same class. Each part sees the
+   events of the sequential traversal for its range in the same order, and
+   concatenating the results of <evtab[0]>, <evtab[1]>, ... in this order
+   gives the result of the sequential traversal. Only the edges from the
+   root refer to a root info local to the part. */
+int gt_esa_bottomup_parallel(const Sequentialsuffixarrayreader *ssar,
+                             GtESAVisitor **evtab,
+                             unsigned int numofparts,
+                             GtError *err);
+
+/* Split the suffixes of the mapped (not streamed) index <ssar> at positions
+   whose lcp-value is smaller than <splitlcp> into at most <numofparts> parts
+   of roughly the same size. With <splitlcp> = 1 these are the boundaries of
+   the children of the root, as used by <gt_esa_bottomup_parallel>. A larger
+   <splitlcp> splits the lcp-intervals of smaller lcp-values, but keeps all
+   lcp-intervals with an lcp-value of at least <splitlcp> intact. For each
+   part, a reader is stored in <ssartab>, which must have space for
+   <numofparts> readers. The reader of a part delivers the suffixes and
+   lcp-values of the part only, and the number of its nonspecial suffixes is
+   the width of the part. So a traversal for a single reader can be applied
+   to each part. Returns the number of parts. */
+unsigned int gt_esa_bottomup_split_reader(Sequentialsuffixarrayreader *ssartab,
+                                          const Sequentialsuffixarrayreader
+                                            *ssar,
+                                          unsigned int numofparts,
+                                          GtUword splitlcp);
+
 GtArrayGtBUItvinfo *gt_GtArrayGtBUItvinfo_new(void);
 
 void gt_GtArrayGtBUItvinfo_delete(GtArrayGtBUItvinfo *stack,
@@ -16,6 +16,10 @@
 */
 
 #include "core/logger.h"
+#include "core/ma.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#endif
 #include "core/unused_api.h"
 #include "lcpinterval.h"
 #include "esa-seqread.h"
@@ -177,29 +181,68 @@ int gt_runenumlcpvalues_bottomup(const char *inputindex,
                                  GtLogger *logger,
                                  GtError *err)
 {
-  bool haserr = false;
+  bool haserr = false, scanfile = true;
   Sequentialsuffixarrayreader *ssar;
 
   gt_error_check(err);
+#ifdef GT_THREADS_ENABLED
+  if (gt_jobs > 1U)
+  {
+    /* the parallel traversal needs random access to the tables */
+    scanfile = false;
+  }
+#endif
   ssar = gt_newSequentialsuffixarrayreaderfromfile(inputindex,
                                                    SARR_LCPTAB |
                                                    SARR_SUFTAB |
                                                    SARR_ESQTAB,
-                                                   true,
+                                                   scanfile,
                                                    logger,
                                                    err);
   if (ssar == NULL)
   {
     haserr = true;
   }
-  if (!haserr)
+#ifdef GT_THREADS_ENABLED
+  if (!haserr && gt_jobs > 1U)
   {
-    GtESAVisitor *elv = gt_esa_lcpitvs_visitor_new();
-    if (gt_esa_bottomup(ssar, elv, err) != 0)
+    GtESAVisitor **evtab = gt_malloc(sizeof (*evtab) * gt_jobs);
+    GtStr **outbuftab = gt_malloc(sizeof (*outbuftab) * gt_jobs);
+    unsigned int part;
+
+    for (part = 0; part < gt_jobs; part++)
+    {
+      outbuftab[part] = gt_str_new();
+      evtab[part] = gt_esa_lcpitvs_visitor_new_buffered(outbuftab[part]);
+    }
+    if (gt_esa_bottomup_parallel(ssar, evtab, gt_jobs, err) != 0)
     {
       haserr = true;
     }
-    gt_esa_visitor_delete(elv);
+    for (part = 0; part < gt_jobs; part++)
+    {
+      if (!haserr)
+      {
+        (void) fwrite(gt_str_get(outbuftab[part]), sizeof (char),
+                      (size_t) gt_str_length(outbuftab[part]), stdout);
+      }
+      gt_esa_visitor_delete(evtab[part]);
+      gt_str_delete(outbuftab[part]);
+    }
+    gt_free(evtab);
+    gt_free(outbuftab);
+  } else
+#endif
+  {
+    if (!haserr)
+    {
+      GtESAVisitor *elv = gt_esa_lcpitvs_visitor_new();
+      if (gt_esa_bottomup(ssar, elv, err) != 0)
+      {
+        haserr = true;
+      }
+      gt_esa_visitor_delete(elv);
+    }
   }
   if (ssar != NULL)
   {
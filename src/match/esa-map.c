@@ -355,6 +355,11 @@ static int inputsuffixarray(bool map,
         if (suffixarray->suftab == NULL)
         {
           haserr = true;
+        } else
+        {
+          gt_fa_mmap_apply_policy_for_suffix((void *) suffixarray->suftab,
+                                             GT_SUFTABSUFFIX,
+                                             GT_FA_MAP_NORMAL);
         }
       }
     } else
@@ -401,6 +406,11 @@ static int inputsuffixarray(bool map,
         if (suffixarray->lcptab == NULL)
         {
           haserr = true;
+        } else
+        {
+          gt_fa_mmap_apply_policy_for_suffix((void *) suffixarray->lcptab,
+                                             GT_LCPTABSUFFIX,
+                                             GT_FA_MAP_NORMAL);
         }
       }
     } else
@@ -435,6 +445,11 @@ static int inputsuffixarray(bool map,
         if (suffixarray->llvtab == NULL)
         {
           haserr = true;
+        } else
+        {
+          gt_fa_mmap_apply_policy_for_suffix((void *) suffixarray->llvtab,
+                                             GT_LARGELCPTABSUFFIX,
+                                             GT_FA_MAP_NORMAL);
         }
       } else
       {
@@ -456,6 +471,11 @@ static int inputsuffixarray(bool map,
       if (suffixarray->bwttab == NULL)
       {
         haserr = true;
+      } else
+      {
+        gt_fa_mmap_apply_policy_for_suffix((void *) suffixarray->bwttab,
+                                           GT_BWTTABSUFFIX,
+                                           GT_FA_MAP_NORMAL);
       }
     } else
     {
@@ -19,6 +19,10 @@
 #include "core/unused_api.h"
 #include "core/minmax.h"
 #include "core/arraydef.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#endif
+#include "esa-bottomup.h"
 #include "esa-seqread.h"
 #include "esa-lcpintervals.h"
 #include "esa-maxpairs.h"
@@ -77,7 +81,8 @@ typedef struct  /* global information */
   GtReadmode readmode;
   GtProcessmaxpairs processmaxpairs;
   const GtMaxfreqcollect *maxfreqcollect;
-  GtUword nextmaxfreq;
+  GtUword nextmaxfreq,
+          lboffset; /* added to the left boundaries of the traversed part */
   void *processmaxpairsinfo;
 } GtBUstate_maxpairs;
 
@@ -368,7 +373,7 @@ static int processbranchingedge_maxpairs(bool firstsucc,
   {
     if (binaryfindlcpinterval(state->maxfreqcollect->arr.spaceLcpinterval,
                               state->maxfreqcollect->arr.nextfreeLcpinterval,
-                              fatherdepth,fatherlb))
+                              fatherdepth,state->lboffset + fatherlb))
     {
       return 0;
     }
@@ -376,7 +381,7 @@ static int processbranchingedge_maxpairs(bool firstsucc,
     gt_assert(!linearfindlcpinterval(
                               state->maxfreqcollect->arr.spaceLcpinterval,
                               state->maxfreqcollect->arr.nextfreeLcpinterval,
-                              fatherdepth,fatherlb));
+                              fatherdepth,state->lboffset + fatherlb));
 #endif
   }
   state->initialized = false;
@@ -474,23 +479,23 @@ static GtUword gt_ssar_ssli_nonspecials(const Sequentialsuffixarrayreader *ssar,
 
 #include "esa-bottomup-maxpairs.inc"
 
-int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
-                                 GtSainSufLcpIterator *suflcpiterator,
-                                 unsigned int searchlength,
-                                 GtProcessmaxpairs processmaxpairs,
-                                 void *processmaxpairsinfo,
-                                 GtError *err)
+static GtBUstate_maxpairs *gt_BUstate_maxpairs_new(
+                                const Sequentialsuffixarrayreader *ssar,
+                                GtSainSufLcpIterator *suflcpiterator,
+                                unsigned int searchlength,
+                                GtProcessmaxpairs processmaxpairs,
+                                void *processmaxpairsinfo)
 {
   unsigned int base;
   GtArrayGtUword *ptr;
   GtBUstate_maxpairs *state;
-  bool haserr = false;
 
   state = gt_malloc(sizeof (*state));
   state->searchlength = searchlength;
   state->processmaxpairs = processmaxpairs;
   state->processmaxpairsinfo = processmaxpairsinfo;
   state->nextmaxfreq = 0;
+  state->lboffset = 0;
   state->initialized = false;
   if (ssar != NULL)
   {
@@ -522,10 +527,14 @@ int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
     ptr = &state->poslist[base];
     GT_INITARRAY(ptr,GtUword);
   }
-  if (gt_esa_bottomup_maxpairs(ssar, suflcpiterator,  state, err) != 0)
-  {
-    haserr = true;
-  }
+  return state;
+}
+
+static void gt_BUstate_maxpairs_delete(GtBUstate_maxpairs *state)
+{
+  unsigned int base;
+  GtArrayGtUword *ptr;
+
   GT_FREEARRAY(&state->uniquechar,GtUword);
   for (base = 0; base < state->alphabetsize; base++)
   {
@@ -534,6 +543,28 @@ int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
   }
   gt_free(state->poslist);
   gt_free(state);
+}
+
+int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
+                                 GtSainSufLcpIterator *suflcpiterator,
+                                 unsigned int searchlength,
+                                 GtProcessmaxpairs processmaxpairs,
+                                 void *processmaxpairsinfo,
+                                 GtError *err)
+{
+  GtBUstate_maxpairs *state;
+  bool haserr = false;
+
+  state = gt_BUstate_maxpairs_new(ssar,
+                                  suflcpiterator,
+                                  searchlength,
+                                  processmaxpairs,
+                                  processmaxpairsinfo);
+  if (gt_esa_bottomup_maxpairs(ssar, suflcpiterator,  state, err) != 0)
+  {
+    haserr = true;
+  }
+  gt_BUstate_maxpairs_delete(state);
   return haserr ? -1 : 0;
 }
 
@@ -567,6 +598,257 @@ int gt_enumeratemaxpairs_sain(GtSainSufLcpIterator *suflcpiterator,
                                       err);
 }
 
+#ifdef GT_THREADS_ENABLED
+/* the suffix array is split into this many parts per thread, so that threads
+   finishing early can take over another part */
+#define GT_MAXPAIRS_PARTS_PER_JOB  4U
+/* a part waits until it is the first part not yet output, when this many
+   of its maximal pairs are buffered */
+#define GT_MAXPAIRS_BUFFERED       (1UL << 16)
+
+typedef struct
+{
+  GtUword len,
+          pos1,
+          pos2;
+} GtMaxpair;
+
+GT_DECLAREARRAYSTRUCT(GtMaxpair);
+
+typedef struct GtMaxpairsshared GtMaxpairsshared;
+
+typedef struct
+{
+  Sequentialsuffixarrayreader ssar;
+  GtBUstate_maxpairs *state;
+  GtArrayGtMaxpair maxpairs;
+  GtMaxpairsshared *shared;
+  unsigned int partnum;
+  bool done;
+} GtMaxpairspart;
+
+struct GtMaxpairsshared
+{
+  GtMaxpairspart *parttab;
+  unsigned int numofparts,
+               nextpart,   /* the next part to be traversed */
+               nextoutput; /* the first part not yet output completely */
+  GtProcessmaxpairs processmaxpairs;
+  void *processmaxpairsinfo;
+  GtMutex *mutex;
+  GtCondition *outputdone;
+  GtError *err;
+  bool haserr;
+};
+
+/* applies <processmaxpairs> to the maximal pairs buffered for <part>. Only
+   the thread owning the first part not yet output calls this. */
+static int gt_maxpairs_output(GtMaxpairspart *part,GtError *err)
+{
+  const GtMaxpairsshared *shared = part->shared;
+  const GtMaxpair *maxpairptr;
+
+  for (maxpairptr = part->maxpairs.spaceGtMaxpair;
+       maxpairptr < part->maxpairs.spaceGtMaxpair +
+                    part->maxpairs.nextfreeGtMaxpair;
+       maxpairptr++)
+  {
+    if (shared->processmaxpairs(shared->processmaxpairsinfo,
+                                &part->state->genericencseq,
+                                maxpairptr->len,
+                                maxpairptr->pos1,
+                                maxpairptr->pos2,
+                                err) != 0)
+    {
+      return -1;
+    }
+  }
+  part->maxpairs.nextfreeGtMaxpair = 0;
+  return 0;
+}
+
+/* waits until <part> is the first part not yet output and outputs the
+   maximal pairs buffered for it */
+static int gt_maxpairs_wait_output(GtMaxpairspart *part,GtError *err)
+{
+  GtMaxpairsshared *shared = part->shared;
+  bool haserr;
+
+  gt_mutex_lock(shared->mutex);
+  while (!shared->haserr && shared->nextoutput != part->partnum)
+  {
+    gt_condition_wait(shared->outputdone,shared->mutex);
+  }
+  haserr = shared->haserr;
+  gt_mutex_unlock(shared->mutex);
+  /* another part failed, its error is reported */
+  return haserr ? -1 : gt_maxpairs_output(part,err);
+}
+
+static int gt_maxpairs_collect(void *processinfo,
+                               GT_UNUSED const GtGenericEncseq *genericencseq,
+                               GtUword len,
+                               GtUword pos1,
+                               GtUword pos2,
+                               GtError *err)
+{
+  GtMaxpairspart *part = (GtMaxpairspart *) processinfo;
+  GtMaxpair *maxpairptr;
+
+  if (part->maxpairs.nextfreeGtMaxpair == GT_MAXPAIRS_BUFFERED &&
+      gt_maxpairs_wait_output(part,err) != 0)
+  {
+    return -1;
+  }
+  GT_GETNEXTFREEINARRAY(maxpairptr,&part->maxpairs,GtMaxpair,
+                        part->maxpairs.allocatedGtMaxpair * 0.2 + 1024UL);
+  maxpairptr->len = len;
+  maxpairptr->pos1 = pos1;
+  maxpairptr->pos2 = pos2;
+  return 0;
+}
+
+/* marks <part> as traversed and, if it is the first part not yet output,
+   outputs it and all following traversed parts. The mutex must be locked. */
+static int gt_maxpairs_part_done(GtMaxpairspart *part,GtError *err)
+{
+  GtMaxpairsshared *shared = part->shared;
+
+  part->done = true;
+  if (shared->nextoutput != part->partnum)
+  {
+    return 0;
+  }
+  while (shared->nextoutput < shared->numofparts &&
+         shared->parttab[shared->nextoutput].done)
+  {
+    GtMaxpairspart *outpart = shared->parttab + shared->nextoutput;
+
+    if (gt_maxpairs_output(outpart,err) != 0)
+    {
+      return -1;
+    }
+    GT_FREEARRAY(&outpart->maxpairs,GtMaxpair);
+    shared->nextoutput++;
+  }
+  gt_condition_broadcast(shared->outputdone);
+  return 0;
+}
+
+static void *gt_enumeratemaxpairs_thread(void *data)
+{
+  GtMaxpairsshared *shared = (GtMaxpairsshared *) data;
+  GtError *err = gt_error_new();
+
+  while (true)
+  {
+    GtMaxpairspart *part;
+    int retval;
+
+    gt_mutex_lock(shared->mutex);
+    if (shared->haserr || shared->nextpart == shared->numofparts)
+    {
+      gt_mutex_unlock(shared->mutex);
+      break;
+    }
+    part = shared->parttab + shared->nextpart++;
+    gt_mutex_unlock(shared->mutex);
+    retval = gt_esa_bottomup_maxpairs(&part->ssar,NULL,part->state,err);
+    gt_mutex_lock(shared->mutex);
+    if (retval == 0)
+    {
+      retval = gt_maxpairs_part_done(part,err);
+    }
+    if (retval != 0 && !shared->haserr)
+    {
+      gt_error_set(shared->err,"%s",gt_error_get(err));
+      shared->haserr = true;
+      gt_condition_broadcast(shared->outputdone);
+    }
+    gt_mutex_unlock(shared->mutex);
+  }
+  gt_error_delete(err);
+  return NULL;
+}
+
+/* All maximal pairs of length at least <searchlength> > 0 are found in the
+   lcp-intervals with an lcp-value of at least <searchlength>, so the suffix
+   array is split between these intervals and the parts are traversed in
+   parallel. The maximal pairs of a part are buffered until all previous parts
+   are output. So the maximal pairs are processed in the same order as in
+   the sequential traversal and <processmaxpairs> need not be thread-safe.
+   A part waits when its buffer is full, which bounds the memory needed. */
+
+static int gt_enumeratemaxpairs_parallel(
+                                const Sequentialsuffixarrayreader *ssar,
+                                unsigned int searchlength,
+                                GtProcessmaxpairs processmaxpairs,
+                                void *processmaxpairsinfo,
+                                unsigned int numofthreads,
+                                GtError *err)
+{
+  Sequentialsuffixarrayreader *ssartab;
+  GtMaxpairsshared shared;
+  GtThread **threadtab;
+  unsigned int idx, numofparts;
+
+  gt_assert(searchlength > 0);
+  numofparts = numofthreads * GT_MAXPAIRS_PARTS_PER_JOB;
+  ssartab = gt_malloc(sizeof (*ssartab) * numofparts);
+  shared.numofparts = gt_esa_bottomup_split_reader(ssartab, ssar, numofparts,
+                                                   (GtUword) searchlength);
+  shared.parttab = gt_malloc(sizeof (*shared.parttab) * shared.numofparts);
+  for (idx = 0; idx < shared.numofparts; idx++)
+  {
+    GtMaxpairspart *part = shared.parttab + idx;
+
+    part->ssar = ssartab[idx];
+    GT_INITARRAY(&part->maxpairs,GtMaxpair);
+    part->state = gt_BUstate_maxpairs_new(&part->ssar,
+                                          NULL,
+                                          searchlength,
+                                          gt_maxpairs_collect,
+                                          part);
+    part->state->lboffset = part->ssar.nextsuftabindex;
+    part->shared = &shared;
+    part->partnum = idx;
+    part->done = false;
+  }
+  gt_free(ssartab);
+  shared.nextpart = shared.nextoutput = 0;
+  shared.processmaxpairs = processmaxpairs;
+  shared.processmaxpairsinfo = processmaxpairsinfo;
+  shared.mutex = gt_mutex_new();
+  shared.outputdone = gt_condition_new();
+  shared.err = err;
+  shared.haserr = false;
+  threadtab = gt_malloc(sizeof (*threadtab) * numofthreads);
+  for (idx = 1U; idx < numofthreads; idx++)
+  {
+    threadtab[idx] = gt_thread_new(gt_enumeratemaxpairs_thread, &shared,
+                                   NULL);
+    gt_assert(threadtab[idx] != NULL);
+  }
+  (void) gt_enumeratemaxpairs_thread(&shared);
+  for (idx = 1U; idx < numofthreads; idx++)
+  {
+    gt_thread_join(threadtab[idx]);
+    gt_thread_delete(threadtab[idx]);
+  }
+  gt_free(threadtab);
+  gt_assert(shared.haserr || shared.nextoutput == shared.numofparts);
+  for (idx = 0; idx < shared.numofparts; idx++)
+  {
+    GT_FREEARRAY(&shared.parttab[idx].maxpairs,GtMaxpair);
+    gt_BUstate_maxpairs_delete(shared.parttab[idx].state);
+  }
+  gt_free(shared.parttab);
+  gt_condition_delete(shared.outputdone);
+  gt_mutex_delete(shared.mutex);
+  return shared.haserr ? -1 : 0;
+}
+#endif
+
 static int collectmaxfreqintervals(void *data,const Lcpinterval *lcpitv)
 {
   GtMaxfreqcollect *maxfreqcollect = (GtMaxfreqcollect *) data;
@@ -682,13 +964,30 @@ int gt_callenummaxpairs(const char *indexname,
       gt_assert(ssar != NULL);
       ssar->extrainfo = &maxfreqcollect;
     }
-    if (gt_enumeratemaxpairs(ssar,
-                             userdefinedleastlength,
-                             processmaxpairs,
-                             processmaxpairsinfo,
-                             err) != 0)
+#ifdef GT_THREADS_ENABLED
+    /* the parallel traversal needs random access to the tables */
+    if (gt_jobs > 1U && !scanfile && userdefinedleastlength > 0)
     {
-      haserr = true;
+      if (gt_enumeratemaxpairs_parallel(ssar,
+                                        userdefinedleastlength,
+                                        processmaxpairs,
+                                        processmaxpairsinfo,
+                                        gt_jobs,
+                                        err) != 0)
+      {
+        haserr = true;
+      }
+    } else
+#endif
+    {
+      if (gt_enumeratemaxpairs(ssar,
+                               userdefinedleastlength,
+                               processmaxpairs,
+                               processmaxpairsinfo,
+                               err) != 0)
+      {
+        haserr = true;
+      }
     }
   }
   GT_FREEARRAY(&maxfreqcollect.arr,Lcpinterval);
@@ -16,18 +16,37 @@
 */
 
 #include "core/class_alloc_lock.h"
+#include "core/str_api.h"
 #include "core/unused_api.h"
 #include "esa_visitor_rep.h"
 #include "esa_lcpintervals_visitor.h"
 
 struct GtESALcpintervalsVisitor {
   const GtESAVisitor parent_instance;
+  GtStr *outbuf;
 };
 
+static const GtESAVisitorClass* gt_esa_lcpitvs_visitor_class(void);
+
 #define gt_esa_lcpitvs_visitor_cast(GV)\
         gt_esa_visitor_cast(gt_esa_lcpitvs_visitor_class(), GV)
 
-static int gt_esa_lcpitvs_visitor_processleafedge(GT_UNUSED GtESAVisitor *ev,
+static void gt_esa_lcpitvs_visitor_append_edge(GtStr *outbuf,
+                                               char edgetype,
+                                               bool firstsucc,
+                                               GtUword fd,
+                                               GtUword flb)
+{
+  gt_str_append_char(outbuf, edgetype);
+  gt_str_append_char(outbuf, ' ');
+  gt_str_append_char(outbuf, firstsucc ? '1' : '0');
+  gt_str_append_char(outbuf, ' ');
+  gt_str_append_uword(outbuf, fd);
+  gt_str_append_char(outbuf, ' ');
+  gt_str_append_uword(outbuf, flb);
+}
+
+static int gt_esa_lcpitvs_visitor_processleafedge(GtESAVisitor *ev,
                                                   bool firstsucc,
                                                   GtUword fd,
                                                   GT_UNUSED GtUword flb,
@@ -37,13 +56,24 @@ static int gt_esa_lcpitvs_visitor_processleafedge(GT_UNUSED GtESAVisitor *ev,
                                                   GT_UNUSED GtError *err)
 
 {
-  printf("L %c " GT_WU " " GT_WU " " GT_WU "\n", firstsucc ? '1' : '0',
-         fd, flb, leafnumber);
+  GtESALcpintervalsVisitor *lev = gt_esa_lcpitvs_visitor_cast(ev);
+
+  if (lev->outbuf != NULL)
+  {
+    gt_esa_lcpitvs_visitor_append_edge(lev->outbuf, 'L', firstsucc, fd, flb);
+    gt_str_append_char(lev->outbuf, ' ');
+    gt_str_append_uword(lev->outbuf, leafnumber);
+    gt_str_append_char(lev->outbuf, '\n');
+  } else
+  {
+    printf("L %c " GT_WU " " GT_WU " " GT_WU "\n", firstsucc ? '1' : '0',
+           fd, flb, leafnumber);
+  }
   return 0;
 }
 
 static int gt_esa_lcpitvs_visitor_processbranchingedge(
-                                                    GT_UNUSED GtESAVisitor *ev,
+                                                    GtESAVisitor *ev,
                                                     bool firstsucc,
                                                     GtUword fd,
                                                     GtUword flb,
@@ -56,8 +86,21 @@ static int gt_esa_lcpitvs_visitor_processbranchingedge(
                                                         GtESAVisitorInfo *sinfo,
                                                     GT_UNUSED GtError *err)
 {
-  printf("B %c " GT_WU " " GT_WU " " GT_WU " " GT_WU "\n",
-         firstsucc ? '1' : '0', fd, flb, sd, slb);
+  GtESALcpintervalsVisitor *lev = gt_esa_lcpitvs_visitor_cast(ev);
+
+  if (lev->outbuf != NULL)
+  {
+    gt_esa_lcpitvs_visitor_append_edge(lev->outbuf, 'B', firstsucc, fd, flb);
+    gt_str_append_char(lev->outbuf, ' ');
+    gt_str_append_uword(lev->outbuf, sd);
+    gt_str_append_char(lev->outbuf, ' ');
+    gt_str_append_uword(lev->outbuf, slb);
+    gt_str_append_char(lev->outbuf, '\n');
+  } else
+  {
+    printf("B %c " GT_WU " " GT_WU " " GT_WU " " GT_WU "\n",
+           firstsucc ? '1' : '0', fd, flb, sd, slb);
+  }
   return 0;
 }
 
@@ -79,7 +122,15 @@ static const GtESAVisitorClass* gt_esa_lcpitvs_visitor_class(void)
 }
 
 GtESAVisitor* gt_esa_lcpitvs_visitor_new(void)
+{
+  return gt_esa_lcpitvs_visitor_new_buffered(NULL);
+}
+
+GtESAVisitor* gt_esa_lcpitvs_visitor_new_buffered(GtStr *outbuf)
 {
   GtESAVisitor *ev = gt_esa_visitor_create(gt_esa_lcpitvs_visitor_class());
+  GtESALcpintervalsVisitor *lev = gt_esa_lcpitvs_visitor_cast(ev);
+
+  lev->outbuf = outbuf;
   return ev;
 }
@@ -18,10 +18,15 @@
 #ifndef ESA_LCPINTERVALS_VISITOR_H
 #define ESA_LCPINTERVALS_VISITOR_H
 
+#include "core/str_api.h"
 #include "match/esa_visitor.h"
 
 typedef struct GtESALcpintervalsVisitor GtESALcpintervalsVisitor;
 
 GtESAVisitor*            gt_esa_lcpitvs_visitor_new(void);
 
+/* Returns a visitor which appends its output to <outbuf> instead of
+   printing it to stdout. */
+GtESAVisitor*            gt_esa_lcpitvs_visitor_new_buffered(GtStr *outbuf);
+
 #endif
@@ -19,6 +19,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include "core/alphabet.h"
+#include "core/cstr_api.h"
 #include "core/error.h"
 #include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/unused_api.h"
@@ -27,6 +28,9 @@
 #include "core/encseq.h"
 #include "core/format64.h"
 #include "core/ma_api.h"
+#include "core/minmax.h"
+#include "core/thread_api.h"
+#include "core/xansi_api.h"
 #include "optionargmode.h"
 #include "greedyfwdmat.h"
 #include "initbasepower.h"
@@ -38,6 +42,9 @@ typedef struct
        showsubjectpos;
   Definedunsignedlong minlength,
                       maxlength;
+  GtStr *outbuf;
+  struct Gmatchchunk *chunk;
+  GtUword queryidx;
 } Rangespecinfo;
 
 typedef void (*Preprocessgmatchlength)(uint64_t,
@@ -62,6 +69,10 @@ typedef struct
   GtUword totallength;
   const GtAlphabet *alphabet;
   Greedygmatchforwardfunction gmatchforward;
+  Greedygmatchforwardbatchfunction gmatchforwardbatch;
+  GtUword batchsize;
+  const GtUchar **qstarttab;
+  GtUword *gmatchlengthtab, *witnesspositiontab;
   Preprocessgmatchlength preprocessgmatchlength;
   Processgmatchlength processgmatchlength;
   Postprocessgmatchlength postprocessgmatchlength;
@@ -99,6 +110,64 @@ static void checkifsequenceisthere(const GtEncseq *encseq,
 }
 #endif
 
+static void processgmatch(Substringinfo *substringinfo,
+                          const GtUchar *query,
+                          const GtUchar *qptr,
+                          GtUword gmatchlength,
+                          GtUword witnessposition)
+{
+  if (gmatchlength > 0)
+  {
+#ifndef NDEBUG
+    if (substringinfo->encseq != NULL)
+    {
+      checkifsequenceisthere(substringinfo->encseq,
+                             witnessposition,
+                             gmatchlength,
+                             qptr);
+    }
+#endif
+    substringinfo->processgmatchlength(substringinfo->alphabet,
+                                       query,
+                                       gmatchlength,
+                                       (GtUword) (qptr-query),
+                                       witnessposition,
+                                       substringinfo->processinfo);
+  }
+}
+
+static void gmatchbatchinsinglesequence(Substringinfo *substringinfo,
+                                        const GtUchar *query,
+                                        GtUword querylen,
+                                        bool withwitness)
+{
+  GtUword offset, idx, numofqueries;
+
+  for (offset = 0; offset < querylen; offset += numofqueries)
+  {
+    numofqueries = MIN(substringinfo->batchsize, querylen - offset);
+    for (idx = 0; idx < numofqueries; idx++)
+    {
+      substringinfo->qstarttab[idx] = query + offset + idx;
+    }
+    substringinfo->gmatchforwardbatch(substringinfo->genericindex,
+                                      numofqueries,
+                                      substringinfo->qstarttab,
+                                      query+querylen,
+                                      substringinfo->gmatchlengthtab,
+                                      withwitness
+                                        ? substringinfo->witnesspositiontab
+                                        : NULL);
+    for (idx = 0; idx < numofqueries; idx++)
+    {
+      processgmatch(substringinfo,query,substringinfo->qstarttab[idx],
+                    substringinfo->gmatchlengthtab[idx],
+                    withwitness ? substringinfo->witnesspositiontab[idx]
+                                : (GtUword) 0);
+    }
+  }
+}
+
 static void gmatchposinsinglesequence(Substringinfo *substringinfo,
                                       uint64_t unitnum,
                                       const GtUchar *query,
@@ -123,35 +192,24 @@ static void gmatchposinsinglesequence(Substringinfo *substringinfo,
   {
     wptr = NULL;
   }
-  for (qptr = query, remaining = querylen; remaining > 0; qptr++, remaining--)
+  if (substringinfo->gmatchforwardbatch != NULL)
   {
-    gmatchlength = substringinfo->gmatchforward(substringinfo->genericindex,
-                                                0,
-                                                0,
-                                                substringinfo->totallength,
-                                                wptr,
-                                                qptr,
-                                                query+querylen);
-    if (gmatchlength > 0)
+    gmatchbatchinsinglesequence(substringinfo,query,querylen,
+                                wptr != NULL ? true : false);
+  } else
+  {
+    for (qptr = query, remaining = querylen; remaining > 0;
+         qptr++, remaining--)
     {
-#ifndef NDEBUG
-      if (substringinfo->encseq != NULL)
-      {
-        gt_assert(wptr != NULL);
-        checkifsequenceisthere(substringinfo->encseq,
-                               witnessposition,
-                               gmatchlength,
-                               qptr);
-      }
-#endif
-      substringinfo->processgmatchlength(substringinfo->alphabet,
-                                         query,
-                                         gmatchlength,
-                                         (GtUword) (qptr-query),
-                                         wptr == NULL
-                                           ? (GtUword) 0
-                                           : witnessposition,
-                                         substringinfo->processinfo);
+      gmatchlength = substringinfo->gmatchforward(substringinfo->genericindex,
+                                                  0,
+                                                  0,
+                                                  substringinfo->totallength,
+                                                  wptr,
+                                                  qptr,
+                                                  query+querylen);
+      processgmatch(substringinfo,query,qptr,gmatchlength,
+                    wptr == NULL ? (GtUword) 0 : witnessposition);
     }
   }
   if (substringinfo->postprocessgmatchlength != NULL)
@@ -165,16 +223,91 @@ static void gmatchposinsinglesequence(Substringinfo *substringinfo,
   }
 }
 
+/* The queries are read in chunks. The output of each query is collected
+   in its own buffer, so that the queries of a chunk can be processed by
+   several threads in any order and the output is still written in the
+   order of the input. A buffer exceeding GMATCH_OUTBUF_FLUSHSIZE bytes is
+   written as soon as all queries before it have been written, so the
+   memory for the output does not grow with the length of the queries. */
+
+#define GMATCH_QUERIES_PER_THREAD 16
+#define GMATCH_CHUNK_MAXLENGTH    (1UL << 22)
+#define GMATCH_OUTBUF_FLUSHSIZE   (1UL << 16)
+
+typedef struct
+{
+  const GtUchar *sequence;
+  GtUchar *sequencecopy; /* if the iterator reuses its buffer before the
+                            query is processed */
+  GtUword length;
+  char *desc;
+  uint64_t unitnum;
+  GtStr *outbuf;
+  bool done;
+} Gmatchquery;
+
+typedef struct Gmatchchunk
+{
+  Gmatchquery *querytab;
+  GtUword numofqueries,
+          nextquery,  /* the next query to be processed */
+          nextoutput; /* the first query whose output is not complete */
+  GtMutex *mutex;     /* NULL if the queries are processed sequentially */
+  GtCondition *outputdone;
+} Gmatchchunk;
+
+static void gmatchwriteoutput(GtStr *outbuf)
+{
+  gt_xfwrite(gt_str_get(outbuf),sizeof (char),(size_t) gt_str_length(outbuf),
+             stdout);
+  gt_str_reset(outbuf);
+}
+
+static void gmatchcheckoutbuf(Rangespecinfo *rangespecinfo)
+{
+  Gmatchchunk *chunk = rangespecinfo->chunk;
+
+  if (gt_str_length(rangespecinfo->outbuf) < GMATCH_OUTBUF_FLUSHSIZE)
+  {
+    return;
+  }
+#ifdef GT_THREADS_ENABLED
+  if (chunk->mutex != NULL)
+  {
+    /* wait until all queries before this one are written. Queries are
+       taken in input order, so the one with the smallest index among those
+       not completed never waits. */
+    gt_mutex_lock(chunk->mutex);
+    while (chunk->nextoutput != rangespecinfo->queryidx)
+    {
+      gt_condition_wait(chunk->outputdone,chunk->mutex);
+    }
+    gt_mutex_unlock(chunk->mutex);
+  }
+#else
+  (void) chunk;
+#endif
+  gmatchwriteoutput(rangespecinfo->outbuf);
+}
+
 static void showunitnum(uint64_t unitnum,
                         const char *desc,
-                        GT_UNUSED void *info)
+                        void *info)
 {
-  printf("unit " Formatuint64_t, PRINTuint64_tcast(unitnum));
+  GtStr *outbuf = ((Rangespecinfo *) info)->outbuf;
+  char unitbuf[32];
+
+  (void) snprintf(unitbuf,sizeof (unitbuf),"unit " Formatuint64_t,
+                  PRINTuint64_tcast(unitnum));
+  gt_str_append_cstr(outbuf,unitbuf);
   if (desc != NULL && desc[0] != '\0')
   {
-    printf(" (%s)",desc);
+    gt_str_append_cstr(outbuf," (");
+    gt_str_append_cstr(outbuf,desc);
+    gt_str_append_char(outbuf,')');
   }
-  printf("\n");
+  gt_str_append_char(outbuf,'\n');
+  gmatchcheckoutbuf((Rangespecinfo *) info);
 }
 
 static void showifinlengthrange(const GtAlphabet *alphabet,
@@ -193,27 +326,155 @@ static void showifinlengthrange(const GtAlphabet *alphabet,
   {
     if (rangespecinfo->showquerypos)
     {
-      printf(""GT_WU" ",querystart);
+      gt_str_append_uword(rangespecinfo->outbuf,querystart);
+      gt_str_append_char(rangespecinfo->outbuf,' ');
     }
-    printf(""GT_WU"",gmatchlength);
+    gt_str_append_uword(rangespecinfo->outbuf,gmatchlength);
     if (rangespecinfo->showsubjectpos)
     {
-      printf(" "GT_WU"",subjectpos);
+      gt_str_append_char(rangespecinfo->outbuf,' ');
+      gt_str_append_uword(rangespecinfo->outbuf,subjectpos);
     }
     if (rangespecinfo->showsequence)
     {
-      (void) putchar(' ');
-      gt_alphabet_decode_seq_to_fp(alphabet,stdout,start + querystart,
-                                   gmatchlength);
+      gt_str_append_char(rangespecinfo->outbuf,' ');
+      gt_alphabet_decode_seq_to_str_append(alphabet,rangespecinfo->outbuf,
+                                           start + querystart,gmatchlength);
     }
-    (void) putchar('\n');
+    gt_str_append_char(rangespecinfo->outbuf,'\n');
+    gmatchcheckoutbuf(rangespecinfo);
   }
 }
 
+typedef struct
+{
+  Substringinfo substringinfo;
+  Rangespecinfo rangespecinfo;
+  GtThread *thread;
+} Gmatchthreadinfo;
+
+static void gmatchprocessquery(Gmatchthreadinfo *threadinfo,
+                               Gmatchchunk *chunk,
+                               GtUword queryidx)
+{
+  Gmatchquery *gmatchquery = chunk->querytab + queryidx;
+
+  threadinfo->rangespecinfo.outbuf = gmatchquery->outbuf;
+  threadinfo->rangespecinfo.chunk = chunk;
+  threadinfo->rangespecinfo.queryidx = queryidx;
+  gmatchposinsinglesequence(&threadinfo->substringinfo,
+                            gmatchquery->unitnum,
+                            gmatchquery->sequence,
+                            gmatchquery->length,
+                            gmatchquery->desc);
+}
+
+static void gmatchqueryfinish(Gmatchquery *gmatchquery)
+{
+  gmatchwriteoutput(gmatchquery->outbuf);
+  gt_free(gmatchquery->sequencecopy);
+  gmatchquery->sequencecopy = NULL;
+  gt_free(gmatchquery->desc);
+  gmatchquery->desc = NULL;
+}
+
+#ifdef GT_THREADS_ENABLED
+static void *gmatchprocessqueries(void *data)
+{
+  Gmatchthreadinfo *threadinfo = (Gmatchthreadinfo *) data;
+  Gmatchchunk *chunk = threadinfo->rangespecinfo.chunk;
+
+  while (true)
+  {
+    GtUword queryidx;
+
+    gt_mutex_lock(chunk->mutex);
+    queryidx = chunk->nextquery++;
+    gt_mutex_unlock(chunk->mutex);
+    if (queryidx >= chunk->numofqueries)
+    {
+      break;
+    }
+    gmatchprocessquery(threadinfo,chunk,queryidx);
+    gt_mutex_lock(chunk->mutex);
+    chunk->querytab[queryidx].done = true;
+    if (chunk->nextoutput == queryidx)
+    {
+      while (chunk->nextoutput < chunk->numofqueries &&
+             chunk->querytab[chunk->nextoutput].done)
+      {
+        gmatchqueryfinish(chunk->querytab + chunk->nextoutput);
+        chunk->nextoutput++;
+      }
+      gt_condition_broadcast(chunk->outputdone);
+    }
+    gt_mutex_unlock(chunk->mutex);
+  }
+  return NULL;
+}
+#endif
+
+static void gmatchprocesschunk(Gmatchthreadinfo *threadinfotab,
+                               unsigned int numofthreads,
+                               Gmatchchunk *chunk)
+{
+  GtUword idx;
+
+  chunk->nextquery = chunk->nextoutput = 0;
+  for (idx = 0; idx < chunk->numofqueries; idx++)
+  {
+    chunk->querytab[idx].done = false;
+  }
+#ifdef GT_THREADS_ENABLED
+  if (numofthreads > 1U && chunk->numofqueries > 1UL)
+  {
+    unsigned int t;
+
+    chunk->mutex = gt_mutex_new();
+    chunk->outputdone = gt_condition_new();
+    for (t = 0; t < numofthreads; t++)
+    {
+      threadinfotab[t].rangespecinfo.chunk = chunk;
+    }
+    for (t = 1U; t < numofthreads; t++)
+    {
+      threadinfotab[t].thread = gt_thread_new(gmatchprocessqueries,
+                                              threadinfotab + t,NULL);
+      gt_assert(threadinfotab[t].thread != NULL);
+    }
+    (void) gmatchprocessqueries(threadinfotab);
+    for (t = 1U; t < numofthreads; t++)
+    {
+      gt_thread_join(threadinfotab[t].thread);
+      gt_thread_delete(threadinfotab[t].thread);
+    }
+    gt_assert(chunk->nextoutput == chunk->numofqueries);
+    gt_condition_delete(chunk->outputdone);
+    gt_mutex_delete(chunk->mutex);
+    chunk->outputdone = NULL;
+    chunk->mutex = NULL;
+  } else
+#else
+  (void) numofthreads;
+#endif
+  {
+    for (idx = 0; idx < chunk->numofqueries; idx++)
+    {
+      gmatchprocessquery(threadinfotab,chunk,idx);
+      gmatchqueryfinish(chunk->querytab + idx);
+    }
+  }
+  chunk->numofqueries = 0;
+}
+
 int gt_findsubquerygmatchforward(const GtEncseq *encseq,
-                              const void *genericindex,
+                              const void * const *genericindextab,
+                              unsigned int numofthreads,
                               GtUword totallength,
                               Greedygmatchforwardfunction gmatchforward,
+                              Greedygmatchforwardbatchfunction
+                                gmatchforwardbatch,
+                              GtUword batchsize,
                               const GtAlphabet *alphabet,
                               const GtStrArray *queryfilenames,
                               Definedunsignedlong minlength,
@@ -223,31 +484,73 @@ int gt_findsubquerygmatchforward(const GtEncseq *encseq,
                               bool showsubjectpos,
                               GtError *err)
 {
-  Substringinfo substringinfo;
-  Rangespecinfo rangespecinfo;
+  Gmatchthreadinfo *threadinfotab;
+  Gmatchchunk chunk;
   bool haserr = false;
   GtSeqIterator *seqit;
   const GtUchar *query;
-  GtUword querylen;
+  GtUword idx, querylen, maxqueries, chunklength = 0;
   char *desc = NULL;
   int retval;
   uint64_t unitnum;
+  unsigned int t;
 
   gt_error_check(err);
-  substringinfo.genericindex = genericindex;
-  substringinfo.totallength = totallength;
-  rangespecinfo.minlength = minlength;
-  rangespecinfo.maxlength = maxlength;
-  rangespecinfo.showsequence = showsequence;
-  rangespecinfo.showquerypos = showquerypos;
-  rangespecinfo.showsubjectpos = showsubjectpos;
-  substringinfo.preprocessgmatchlength = showunitnum;
-  substringinfo.processgmatchlength = showifinlengthrange;
-  substringinfo.postprocessgmatchlength = NULL;
-  substringinfo.alphabet = alphabet;
-  substringinfo.processinfo = &rangespecinfo;
-  substringinfo.gmatchforward = gmatchforward;
-  substringinfo.encseq = encseq;
+  gt_assert(numofthreads > 0);
+  threadinfotab = gt_malloc(sizeof (*threadinfotab) * numofthreads);
+  for (t = 0; t < numofthreads; t++)
+  {
+    Substringinfo *substringinfo = &threadinfotab[t].substringinfo;
+    Rangespecinfo *rangespecinfo = &threadinfotab[t].rangespecinfo;
+
+    substringinfo->genericindex = genericindextab[t];
+    substringinfo->totallength = totallength;
+    rangespecinfo->minlength = minlength;
+    rangespecinfo->maxlength = maxlength;
+    rangespecinfo->showsequence = showsequence;
+    rangespecinfo->showquerypos = showquerypos;
+    rangespecinfo->showsubjectpos = showsubjectpos;
+    rangespecinfo->outbuf = NULL;
+    rangespecinfo->chunk = NULL;
+    rangespecinfo->queryidx = 0;
+    substringinfo->preprocessgmatchlength = showunitnum;
+    substringinfo->processgmatchlength = showifinlengthrange;
+    substringinfo->postprocessgmatchlength = NULL;
+    substringinfo->alphabet = alphabet;
+    substringinfo->processinfo = rangespecinfo;
+    substringinfo->gmatchforward = gmatchforward;
+    substringinfo->encseq = encseq;
+    substringinfo->gmatchforwardbatch = gmatchforwardbatch;
+    substringinfo->batchsize = batchsize;
+    if (gmatchforwardbatch != NULL)
+    {
+      gt_assert(batchsize > 0);
+      substringinfo->qstarttab = gt_malloc(sizeof (*substringinfo->qstarttab)
+                                           * batchsize);
+      substringinfo->gmatchlengthtab
+        = gt_malloc(sizeof (*substringinfo->gmatchlengthtab) * batchsize);
+      substringinfo->witnesspositiontab
+        = gt_malloc(sizeof (*substringinfo->witnesspositiontab) * batchsize);
+    } else
+    {
+      substringinfo->qstarttab = NULL;
+      substringinfo->gmatchlengthtab = NULL;
+      substringinfo->witnesspositiontab = NULL;
+    }
+  }
+  maxqueries = numofthreads == 1U
+                 ? 1UL
+                 : (GtUword) numofthreads * GMATCH_QUERIES_PER_THREAD;
+  chunk.querytab = gt_malloc(sizeof (*chunk.querytab) * maxqueries);
+  for (idx = 0; idx < maxqueries; idx++)
+  {
+    chunk.querytab[idx].sequencecopy = NULL;
+    chunk.querytab[idx].desc = NULL;
+    chunk.querytab[idx].outbuf = gt_str_new();
+  }
+  chunk.numofqueries = 0;
+  chunk.mutex = NULL;
+  chunk.outputdone = NULL;
   seqit = gt_seq_iterator_sequence_buffer_new(queryfilenames, err);
   if (!seqit)
     haserr = true;
@@ -256,6 +559,8 @@ int gt_findsubquerygmatchforward(const GtEncseq *encseq,
     gt_seq_iterator_set_symbolmap(seqit, gt_alphabet_symbolmap(alphabet));
     for (unitnum = 0; /* Nothing */; unitnum++)
     {
+      Gmatchquery *gmatchquery;
+
       retval = gt_seq_iterator_next(seqit,
                                 &query,
                                 &querylen,
@@ -270,14 +575,47 @@ int gt_findsubquerygmatchforward(const GtEncseq *encseq,
       {
         break;
       }
-      gmatchposinsinglesequence(&substringinfo,
-                                unitnum,
-                                query,
-                                querylen,
-                                desc);
+      gmatchquery = chunk.querytab + chunk.numofqueries;
+      chunk.numofqueries++;
+      chunklength += querylen;
+      if (chunk.numofqueries == maxqueries ||
+          chunklength >= GMATCH_CHUNK_MAXLENGTH)
+      {
+        /* the chunk is processed before the iterator is called again */
+        gmatchquery->sequence = query;
+      } else
+      {
+        gmatchquery->sequencecopy
+          = gt_malloc(sizeof (*gmatchquery->sequencecopy) *
+                      (querylen > 0 ? querylen : 1UL));
+        memcpy(gmatchquery->sequencecopy,query,sizeof (*query) * querylen);
+        gmatchquery->sequence = gmatchquery->sequencecopy;
+      }
+      gmatchquery->length = querylen;
+      gmatchquery->desc = gt_cstr_dup(desc != NULL ? desc : "");
+      gmatchquery->unitnum = unitnum;
+      if (gmatchquery->sequencecopy == NULL)
+      {
+        gmatchprocesschunk(threadinfotab,numofthreads,&chunk);
+        chunklength = 0;
+      }
     }
     gt_seq_iterator_delete(seqit);
   }
+  /* output the queries read before an error occurred */
+  gmatchprocesschunk(threadinfotab,numofthreads,&chunk);
+  for (idx = 0; idx < maxqueries; idx++)
+  {
+    gt_str_delete(chunk.querytab[idx].outbuf);
+  }
+  gt_free(chunk.querytab);
+  for (t = 0; t < numofthreads; t++)
+  {
+    gt_free(threadinfotab[t].substringinfo.qstarttab);
+    gt_free(threadinfotab[t].substringinfo.gmatchlengthtab);
+    gt_free(threadinfotab[t].substringinfo.witnesspositiontab);
+  }
+  gt_free(threadinfotab);
   return haserr ? -1 : 0;
 }
 
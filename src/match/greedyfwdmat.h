@@ -35,10 +35,28 @@ typedef GtUword (*Greedygmatchforwardfunction) (const void *,
                                                       const GtUchar *,
                                                       const GtUchar *);
 
+/* computes the values of a Greedygmatchforwardfunction for a batch of
+   queries ending at the same position */
+typedef void (*Greedygmatchforwardbatchfunction) (const void *,
+                                                  GtUword,
+                                                  const GtUchar * const *,
+                                                  const GtUchar *,
+                                                  GtUword *,
+                                                  GtUword *);
+
+/* The queries are distributed over <numofthreads> threads, thread t uses
+   the index <genericindextab[t]>. The output appears in the order of the
+   queries. If gmatchforwardbatch is not NULL, the suffixes of each query
+   are processed in batches of batchsize suffixes using
+   gmatchforwardbatch */
 int gt_findsubquerygmatchforward(const GtEncseq *encseq,
-                              const void *genericindex,
+                              const void * const *genericindextab,
+                              unsigned int numofthreads,
                               GtUword totallength,
                               Greedygmatchforwardfunction gmatchforward,
+                              Greedygmatchforwardbatchfunction
+                                gmatchforwardbatch,
+                              GtUword batchsize,
                               const GtAlphabet *alphabet,
                               const GtStrArray *queryfilenames,
                               Definedunsignedlong minlength,
@@ -43,6 +43,7 @@ struct Genericindex
   bool withesa;
   const Mbtab **mbtab;      /* only relevant for packedindex */
   unsigned int maxdepth;    /* maximaldepth of boundaries */
+  bool isview;              /* suffixarray is owned by another index */
 };
 
 void genericindex_delete(Genericindex *genericindex)
@@ -51,6 +52,15 @@ void genericindex_delete(Genericindex *genericindex)
   {
     return;
   }
+  if (genericindex->isview)
+  {
+    if (genericindex->packedindex != NULL)
+    {
+      gt_deletevoidBWTSeqView(genericindex->packedindex);
+    }
+    gt_free(genericindex);
+    return;
+  }
   gt_freesuffixarray(genericindex->suffixarray);
   gt_free(genericindex->suffixarray);
   if (genericindex->packedindex != NULL)
@@ -104,6 +114,7 @@ Genericindex *genericindex_new(const char *indexname,
     demand |= SARR_SSPTAB;
   }
   genericindex->withesa = withesa;
+  genericindex->isview = false;
   genericindex->suffixarray = gt_malloc(sizeof (*genericindex->suffixarray));
   if (gt_mapsuffixarray(genericindex->suffixarray,
                         demand,
@@ -166,6 +177,21 @@ Genericindex *genericindex_new(const char *indexname,
   return genericindex;
 }
 
+Genericindex *genericindex_new_view(const Genericindex *genericindex)
+{
+  Genericindex *view;
+
+  gt_assert(genericindex != NULL);
+  view = gt_malloc(sizeof (*view));
+  *view = *genericindex;
+  view->isview = true;
+  if (genericindex->packedindex != NULL)
+  {
+    view->packedindex = gt_newvoidBWTSeqView(genericindex->packedindex);
+  }
+  return view;
+}
+
 typedef struct
 {
   GtUword offset,
@@ -1368,6 +1394,43 @@ bool gt_indexbasedexactpatternmatching(const Limdfsresources *limdfsresources,
   }
 }
 
+bool gt_indexbasedexactpatternmatching_hasbatch(
+                                     const Limdfsresources *limdfsresources)
+{
+  return limdfsresources->genericindex->withesa ? false : true;
+}
+
+void gt_indexbasedexactpatternmatching_batch(
+                                     const Limdfsresources *limdfsresources,
+                                     GtUword numofpatterns,
+                                     const GtUchar * const *patterntab,
+                                     const GtUword *patternlentab,
+                                     GtUwordPair *boundtab)
+{
+  gt_assert(!limdfsresources->genericindex->withesa);
+  gt_pck_exactpatternmatching_batch(limdfsresources->genericindex->packedindex,
+                                    numofpatterns,
+                                    patterntab,
+                                    patternlentab,
+                                    boundtab);
+}
+
+bool gt_indexbasedexactpatternmatching_bound(
+                                     const Limdfsresources *limdfsresources,
+                                     const GtUwordPair *bound,
+                                     GtUword patternlength)
+{
+  gt_assert(!limdfsresources->genericindex->withesa);
+  return gt_pck_exactpatternmatching_bound(
+                                    limdfsresources->genericindex->packedindex,
+                                    bound,
+                                    patternlength,
+                                    limdfsresources->genericindex->totallength,
+                                    limdfsresources->currentpathspace,
+                                    limdfsresources->processmatch,
+                                    limdfsresources->processmatchinfo);
+}
+
 GtUchar gt_limdfs_getencodedchar(const Limdfsresources *limdfsresources,
                               GtUword pos,
                               GtReadmode readmode)
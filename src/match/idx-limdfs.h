@@ -47,6 +47,11 @@ Genericindex *genericindex_new(const char *indexname,
                                GtLogger *logger,
                                GtError *err);
 
+/* returns an index sharing all tables with <genericindex> which can be
+   queried in another thread concurrently to <genericindex>. It must be
+   deleted with genericindex_delete before <genericindex>. */
+Genericindex *genericindex_new_view(const Genericindex *genericindex);
+
 typedef struct Limdfsresources Limdfsresources;
 
 Limdfsresources *gt_newLimdfsresources(const Genericindex *genericindex,
@@ -100,6 +105,27 @@ bool gt_indexbasedexactpatternmatching(const Limdfsresources *limdfsresources,
                                     const GtUchar *pattern,
                                     GtUword patternlength);
 
+/* The exact matches of a batch of patterns in a packed index can be
+   computed in two phases: first the bwt-intervals of all patterns are
+   determined by interleaved backward searches, then the matches of each
+   pattern are reported in the order of the patterns. This is not
+   available for enhanced suffix arrays. */
+
+bool gt_indexbasedexactpatternmatching_hasbatch(
+                                     const Limdfsresources *limdfsresources);
+
+void gt_indexbasedexactpatternmatching_batch(
+                                     const Limdfsresources *limdfsresources,
+                                     GtUword numofpatterns,
+                                     const GtUchar * const *patterntab,
+                                     const GtUword *patternlentab,
+                                     GtUwordPair *boundtab);
+
+bool gt_indexbasedexactpatternmatching_bound(
+                                     const Limdfsresources *limdfsresources,
+                                     const GtUwordPair *bound,
+                                     GtUword patternlength);
+
 GtUchar gt_limdfs_getencodedchar(const Limdfsresources *limdfsresources,
                               GtUword pos,
                               GtReadmode readmode);
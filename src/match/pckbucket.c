@@ -264,6 +264,7 @@ Pckbuckettable *gt_pckbuckettable_map(const char *indexname,
   {
     return NULL;
   }
+  gt_fa_mmap_apply_policy_for_suffix(mapptr,PCKBUCKETTABLE,GT_FA_MAP_NORMAL);
   maxdepth = (unsigned int) ((GtUword *) mapptr)[0];
   pckbt = pckbuckettable_allocandinittable(numofchars,maxdepth,false);
   pckbt->mapptr = mapptr;
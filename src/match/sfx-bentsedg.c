@@ -1791,10 +1791,12 @@ static GtBentsedgIterator *gt_BentsedgIterator_new(GtCodetype mincode,
 }
 
 static bool gt_BentsedgIterator_next(GtBucketspecification *bucketspec,
+                                     GtCodetype *code,
                                      GtBentsedgIterator *bs_it)
 {
   if (bs_it->code <= bs_it->maxcode)
   {
+    *code = bs_it->code;
     bs_it->rightchar = gt_bcktab_calcboundsparts(bucketspec,
                                                  bs_it->bcktab,
                                                  bs_it->code,
@@ -1897,6 +1899,7 @@ typedef struct
   GtBentsedgePrioqueue *queue;
   GtUword nextrequest;
   GtMutex *mutex;
+  GtCondition *processed; /* signaled whenever <nextrequest> increases */
 } GtBentsedgSynchronizer;
 
 static GtBentsedgSynchronizer *gt_bendsedgSynchronizer_new(void)
@@ -1906,6 +1909,7 @@ static GtBentsedgSynchronizer *gt_bendsedgSynchronizer_new(void)
   bs_sync->queue = gt_bs_priority_queue_new(gt_jobs);
   bs_sync->nextrequest = 0;
   bs_sync->mutex = gt_mutex_new();
+  bs_sync->processed = gt_condition_new();
   return bs_sync;
 }
 
@@ -1938,6 +1942,7 @@ static void gt_bendsedgSynchronizer_delete(GtBentsedgSynchronizer *bs_sync)
   {
     gt_assert(gt_bs_priority_queue_is_empty(bs_sync->queue));
     gt_mutex_delete(bs_sync->mutex);
+    gt_condition_delete(bs_sync->processed);
     gt_bs_priority_queue_delete(bs_sync->queue);
     gt_free(bs_sync);
   }
@@ -1947,6 +1952,10 @@ typedef struct
 {
   GtBentsedgresources *bsr;
   unsigned int prefixlength, thread_num;
+  const GtBcktab *bcktab;
+  GtOutlcpinfo *outlcpinfo; /* shared, only used when holding the mutex
+                               of <bs_sync> */
+  GtLcpvalues *tableoflcpvalues; /* the lcp-values of the current bucket */
   GtBentsedgIterator *bs_it; /* shared, _next-function needs a mutex */
   GtBentsedgSynchronizer *bs_sync; /* shared _process-function needs a mutex */
   GtThread *thread;
@@ -1960,16 +1969,21 @@ static void *gt_bentsedg_stream_thread_caller(void *data)
   while (true)
   {
     GtBucketspecification bucketspec;
+    GtCodetype code;
     GtUword bucketnumber;
 
     gt_mutex_lock(thinfo->bs_it->mutex);
-    if (!gt_BentsedgIterator_next(&bucketspec,thinfo->bs_it))
+    if (!gt_BentsedgIterator_next(&bucketspec,&code,thinfo->bs_it))
     {
       gt_mutex_unlock(thinfo->bs_it->mutex);
       break;
     }
     bucketnumber = thinfo->bs_it->bucketnumber++;
     gt_mutex_unlock(thinfo->bs_it->mutex);
+    if (thinfo->tableoflcpvalues != NULL)
+    {
+      thinfo->tableoflcpvalues->numoflargelcpvalues = 0;
+    }
     if (bucketspec.nonspecialsinbucket > 1UL)
     {
       gt_sort_bentleysedgewick(thinfo->bsr,bucketspec.left,
@@ -1977,7 +1991,37 @@ static void *gt_bentsedg_stream_thread_caller(void *data)
                                (GtUword) thinfo->prefixlength);
     }
     gt_mutex_lock(thinfo->bs_sync->mutex);
+    if (thinfo->outlcpinfo != NULL)
+    {
+      /* the lcp-values of a bucket depend on the previous bucket and are
+         output in the order of the buckets. So wait for the turn of the
+         current bucket. */
+      while (thinfo->bs_sync->nextrequest < bucketnumber)
+      {
+        gt_condition_wait(thinfo->bs_sync->processed,thinfo->bs_sync->mutex);
+      }
+      gt_Outlcpinfo_prebucket(thinfo->outlcpinfo,code,bucketspec.left);
+      if (bucketspec.nonspecialsinbucket > 0)
+      {
+        gt_Outlcpinfo_nonspecialsbucket(thinfo->outlcpinfo,
+                                        thinfo->prefixlength,
+                                        thinfo->bsr->sssp,
+                                        thinfo->tableoflcpvalues,
+                                        &bucketspec,
+                                        code);
+      }
+      gt_Outlcpinfo_postbucket(thinfo->outlcpinfo,
+                               thinfo->prefixlength,
+                               thinfo->bsr->sssp,
+                               thinfo->bcktab,
+                               &bucketspec,
+                               code);
+    }
     gt_bendsedgSynchronizer_process(thinfo->bs_sync,bucketnumber);
+    if (thinfo->outlcpinfo != NULL)
+    {
+      gt_condition_broadcast(thinfo->bs_sync->processed);
+    }
     gt_mutex_unlock(thinfo->bs_sync->mutex);
   }
   return NULL;
@@ -1992,6 +2036,7 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
                        GtUword sumofwidth,
                        unsigned int numofchars,
                        unsigned int prefixlength,
+                       GtOutlcpinfo *outlcpinfo,
                        unsigned int sortmaxdepth,
                        const Sfxstrategy *sfxstrategy,
                        GtProcessunsortedsuffixrange processunsortedsuffixrange,
@@ -2006,6 +2051,14 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   GtSuffixsortspace **sssp_tab;
 
   gt_assert(gt_jobs > 1U);
+  /* each thread computes the lcp-values of its bucket in a table of its own,
+     which is only possible if the lcp-values go to a file */
+  gt_assert(outlcpinfo == NULL || gt_Outlcpinfo_lcp2file(outlcpinfo));
+  if (outlcpinfo != NULL)
+  {
+    /* the reservoir for the small lcp-values of the file output */
+    (void) gt_Outlcpinfo_resizereservoir(outlcpinfo,bcktab);
+  }
   th_tab = gt_malloc(sizeof *th_tab * gt_jobs);
   sssp_tab = gt_malloc(sizeof *sssp_tab * gt_jobs);
   bs_it = gt_BentsedgIterator_new(mincode,maxcode,sumofwidth,numofchars,bcktab);
@@ -2014,6 +2067,8 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   {
     th_tab[tp].thread_num = tp;
     th_tab[tp].prefixlength = prefixlength;
+    th_tab[tp].bcktab = bcktab;
+    th_tab[tp].outlcpinfo = outlcpinfo;
     if (tp == 0)
     {
       sssp_tab[tp] = suffixsortspace;
@@ -2028,7 +2083,21 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
                                            bcktab,
                                            sortmaxdepth,
                                            sfxstrategy,
-                                           false);
+                                           outlcpinfo != NULL ? true : false);
+    if (outlcpinfo != NULL)
+    {
+      th_tab[tp].tableoflcpvalues
+        = gt_lcpvalues_new(gt_bcktab_nonspecialsmaxsize(bcktab));
+      th_tab[tp].bsr->tableoflcpvalues = th_tab[tp].tableoflcpvalues;
+      if (th_tab[tp].bsr->srsw != NULL)
+      {
+        gt_shortreadsort_assigntableoflcpvalues(th_tab[tp].bsr->srsw,
+                                                th_tab[tp].tableoflcpvalues);
+      }
+    } else
+    {
+      th_tab[tp].tableoflcpvalues = NULL;
+    }
     th_tab[tp].bsr->processunsortedsuffixrange
       = processunsortedsuffixrange;
     th_tab[tp].bsr->processunsortedsuffixrangeinfo
@@ -2053,6 +2122,7 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   for (tp = 0; tp < gt_jobs; tp++)
   {
     bentsedgresources_delete(th_tab[tp].bsr, logger);
+    gt_lcpvalues_delete(th_tab[tp].tableoflcpvalues);
   }
   gt_suffixsortspace_delete_cloned(sssp_tab,gt_jobs);
   gt_BentsedgIterator_delete(bs_it);
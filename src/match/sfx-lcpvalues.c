@@ -369,6 +369,7 @@ void gt_Outlcpinfo_reinit(GtOutlcpinfo *outlcpinfo,
 }
 
 static void outlcpvalues(Lcpsubtab *lcpsubtab,
+                         const GtLcpvalues *tableoflcpvalues,
                          GtUword width,
                          GtUword posoffset)
 {
@@ -377,21 +378,21 @@ static void outlcpvalues(Lcpsubtab *lcpsubtab,
 
   gt_assert(lcpsubtab != NULL && lcpsubtab->lcp2file != NULL);
   lcpsubtab->lcp2file->largelcpvalues.nextfreeLargelcpvalue = 0;
-  if (lcpsubtab->tableoflcpvalues.numoflargelcpvalues > 0 &&
-      lcpsubtab->tableoflcpvalues.numoflargelcpvalues >=
+  if (tableoflcpvalues->numoflargelcpvalues > 0 &&
+      tableoflcpvalues->numoflargelcpvalues >=
       lcpsubtab->lcp2file->largelcpvalues.allocatedLargelcpvalue)
   {
     lcpsubtab->lcp2file->largelcpvalues.spaceLargelcpvalue
       = gt_realloc(lcpsubtab->lcp2file->largelcpvalues.spaceLargelcpvalue,
                    sizeof (*lcpsubtab->lcp2file->largelcpvalues.
                            spaceLargelcpvalue) *
-                   lcpsubtab->tableoflcpvalues.numoflargelcpvalues);
+                   tableoflcpvalues->numoflargelcpvalues);
     lcpsubtab->lcp2file->largelcpvalues.allocatedLargelcpvalue
-      = lcpsubtab->tableoflcpvalues.numoflargelcpvalues;
+      = tableoflcpvalues->numoflargelcpvalues;
   }
   for (idx=0; idx<width; idx++)
   {
-    lcpvalue = gt_lcptab_getvalue(&lcpsubtab->tableoflcpvalues,0,idx);
+    lcpvalue = gt_lcptab_getvalue(tableoflcpvalues,0,idx);
     if (lcpsubtab->lcp2file->maxbranchdepth < lcpvalue)
     {
       lcpsubtab->lcp2file->maxbranchdepth = lcpvalue;
@@ -660,6 +661,7 @@ void gt_Outlcpinfo_nonspecialsbucket(GtOutlcpinfo *outlcpinfo,
     if (outlcpinfo->lcpsubtab.lcp2file != NULL)
     {
       outlcpvalues(&outlcpinfo->lcpsubtab,
+                   tableoflcpvalues,
                    bucketspec->nonspecialsinbucket,
                    bucketspec->left);
     } else
@@ -848,6 +850,47 @@ GtLcpvalues *gt_Outlcpinfo_lcpvalues_ref(GtOutlcpinfo *outlcpinfo)
   return &outlcpinfo->lcpsubtab.tableoflcpvalues;
 }
 
+bool gt_Outlcpinfo_lcp2file(const GtOutlcpinfo *outlcpinfo)
+{
+  return outlcpinfo != NULL && outlcpinfo->lcpsubtab.lcp2file != NULL
+           ? true : false;
+}
+
+GtLcpvalues *gt_lcpvalues_new(GtUword numofentries)
+{
+  GtLcpvalues *tableoflcpvalues = gt_malloc(sizeof *tableoflcpvalues);
+
+  tableoflcpvalues->bucketoflcpvalues = NULL;
+  tableoflcpvalues->numofentries = 0;
+#ifndef NDEBUG
+  tableoflcpvalues->isset = NULL;
+#endif
+  (void) gt_tableoflcpvalues_realloc(tableoflcpvalues,numofentries);
+  return tableoflcpvalues;
+}
+
+size_t gt_lcpvalues_requiredspace(GtUword numofentries)
+{
+  size_t requiredspace = sizeof (GtLcpvalues) +
+                         sizeof (GtLcpvaluetype) * numofentries;
+#ifndef NDEBUG
+  requiredspace += GT_NUMOFINTSFORBITS(numofentries) * sizeof (GtBitsequence);
+#endif
+  return requiredspace;
+}
+
+void gt_lcpvalues_delete(GtLcpvalues *tableoflcpvalues)
+{
+  if (tableoflcpvalues != NULL)
+  {
+    gt_free(tableoflcpvalues->bucketoflcpvalues);
+#ifndef NDEBUG
+    gt_free(tableoflcpvalues->isset);
+#endif
+    gt_free(tableoflcpvalues);
+  }
+}
+
 GtRMQ *gt_lcpvalues_rmq_new(const GtLcpvalues *samplelcpvalues)
 {
   return gt_rmq_new(samplelcpvalues->bucketoflcpvalues,
@@ -149,6 +149,21 @@ GtLcpvalues *gt_Outlcpinfo_resizereservoir(GtOutlcpinfo *outlcpinfo,
 
 GtLcpvalues *gt_Outlcpinfo_lcpvalues_ref(GtOutlcpinfo *outlcpinfo);
 
+/* Returns true iff the lcp-values are written to the lcp-table files, i.e.
+   <gt_Outlcpinfo_nonspecialsbucket> only reads the given table of
+   lcp-values and not the one owned by <outlcpinfo>. */
+bool gt_Outlcpinfo_lcp2file(const GtOutlcpinfo *outlcpinfo);
+
+/* A table for the lcp-values of a single bucket with <numofentries>
+   entries, e.g.\ for a sorting thread. */
+GtLcpvalues *gt_lcpvalues_new(GtUword numofentries);
+
+/* The number of bytes of a table created by <gt_lcpvalues_new()> with
+   <numofentries> entries. */
+size_t gt_lcpvalues_requiredspace(GtUword numofentries);
+
+void gt_lcpvalues_delete(GtLcpvalues *tableoflcpvalues);
+
 void gt_Outlcpinfo_check_lcpvalues(const GtEncseq *encseq,
                                    GtReadmode readmode,
                                    const GtSuffixsortspace *sortedsample,
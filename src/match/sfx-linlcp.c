@@ -24,6 +24,9 @@
 #include "core/logger.h"
 #include "core/minmax.h"
 #include "core/compact_ulong_store.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#endif
 #include "esa-seqread.h"
 #include "sarr-def.h"
 #include "sfx-linlcp.h"
@@ -71,6 +74,160 @@ GtUword *gt_ENCSEQ_lcp13_kasai(const GtEncseq *encseq,
   return lcptab;
 }
 
+/* plcptab overlays phitab: the phi-value of <pos> is read before
+   the plcp-value of <pos> is stored in the same cell. */
+static GtUword gt_plain_plcp_phi_range(unsigned int *plcptab,
+                                       const GtUchar *sequence,
+                                       bool withspecial,
+                                       GtUword totallength,
+                                       unsigned int suftab0,
+                                       GtUword start,
+                                       GtUword end)
+{
+  GtUword pos, lcpvalue = 0, maxlcp = 0;
+
+  for (pos = start; pos < end; pos++)
+  {
+    if (pos != (GtUword) suftab0)
+    {
+      const unsigned int currentphitab = plcptab[pos];
+      const GtUword lastoffset = totallength - MAX(pos,currentphitab);
+      const GtUchar *ptr1 = sequence + pos,
+                    *ptr2 = sequence + currentphitab;
+
+      while (lcpvalue < lastoffset)
+      {
+        GtUchar cc1 = ptr1[lcpvalue];
+        GtUchar cc2 = ptr2[lcpvalue];
+        if (cc1 == cc2 && (!withspecial || ISNOTSPECIAL(cc1)))
+        {
+          lcpvalue++;
+        } else
+        {
+          break;
+        }
+      }
+      gt_assert(lcpvalue <= (GtUword) UINT_MAX);
+      plcptab[pos] = (unsigned int) lcpvalue;
+      if (lcpvalue > 0)
+      {
+        if (maxlcp < lcpvalue)
+        {
+          maxlcp = lcpvalue;
+        }
+        lcpvalue--;
+      }
+    } else
+    {
+      plcptab[pos] = 0;
+    }
+  }
+  return maxlcp;
+}
+
+#ifdef GT_THREADS_ENABLED
+
+/* In the multithreaded mode, the positions (or suffix array indexes) are
+   split into <gt_jobs> chunks. Each chunk of the plcp-table is computed by
+   its own thread, starting with lcp-value 0 at the first position of the
+   chunk. As the lcp-value drops by at most one from one position to the next,
+   the amortized running time remains linear. Except for a small thread info
+   record, no additional space is required. */
+
+#define GT_LINLCP_MINCHUNKLENGTH 4096UL
+
+typedef enum
+{
+  GT_LINLCP_PHI,
+  GT_LINLCP_PLCP,
+  GT_LINLCP_PLCP2LCP
+} GtLinlcpmode;
+
+typedef struct
+{
+  unsigned int *table;
+  const unsigned int *suftab, *plcptab;
+  const GtUchar *sequence;
+  bool withspecial;
+  GtUword partwidth, totallength, start, end, maxlcp;
+  GtLinlcpmode mode;
+  GtThread *thread;
+} GtLinlcpthreadinfo;
+
+static bool gt_linlcp_useparallel(GtUword totallength)
+{
+  return gt_jobs > 1U && totallength >= GT_LINLCP_MINCHUNKLENGTH * gt_jobs
+         ? true : false;
+}
+
+static void *gt_linlcp_thread(void *data)
+{
+  GtLinlcpthreadinfo *th = (GtLinlcpthreadinfo *) data;
+  GtUword idx;
+
+  th->maxlcp = 0;
+  switch (th->mode)
+  {
+    case GT_LINLCP_PHI:
+      for (idx = MAX(th->start,1UL); idx < th->end; idx++)
+      {
+        th->table[th->suftab[idx]] = th->suftab[idx-1];
+      }
+      break;
+    case GT_LINLCP_PLCP:
+      th->maxlcp = gt_plain_plcp_phi_range(th->table,
+                                           th->sequence,
+                                           th->withspecial,
+                                           th->totallength,
+                                           th->suftab[0],
+                                           th->start,
+                                           th->end);
+      break;
+    case GT_LINLCP_PLCP2LCP:
+      for (idx = th->start; idx < th->end; idx++)
+      {
+        th->table[idx] = idx < th->partwidth
+                           ? th->plcptab[th->suftab[idx]] : 0;
+      }
+      break;
+  }
+  return NULL;
+}
+
+/* runs <mode> on the range <0>..<length>-1 split into <gt_jobs> chunks and
+   returns the maximum of the lcp-values computed by the threads */
+static GtUword gt_linlcp_run_threads(GtLinlcpthreadinfo *thtab,
+                                     GtLinlcpmode mode,
+                                     GtUword length)
+{
+  unsigned int t;
+  GtUword maxlcp = 0, chunklength = length/gt_jobs;
+
+  for (t = 0; t < gt_jobs; t++)
+  {
+    if (t > 0)
+    {
+      thtab[t] = thtab[0];
+    }
+    thtab[t].mode = mode;
+    thtab[t].start = t * chunklength;
+    thtab[t].end = t == gt_jobs - 1 ? length : (t+1) * chunklength;
+    thtab[t].thread = gt_thread_new(gt_linlcp_thread,thtab + t,NULL);
+    gt_assert(thtab[t].thread != NULL);
+  }
+  for (t = 0; t < gt_jobs; t++)
+  {
+    gt_thread_join(thtab[t].thread);
+    gt_thread_delete(thtab[t].thread);
+    if (maxlcp < thtab[t].maxlcp)
+    {
+      maxlcp = thtab[t].maxlcp;
+    }
+  }
+  return maxlcp;
+}
+#endif
+
 unsigned int *gt_plain_lcp13_kasai(GtUword *maxlcp,
                                    const GtUchar *sequence,
                                    bool withspecial,
@@ -136,10 +293,39 @@ unsigned int *gt_plain_lcp_phialgorithm(bool onlyplcp,
                                         GtUword totallength,
                                         const unsigned int *suftab)
 {
-  unsigned int *plcptab, *phitab, pos, suftab0, previousvalue;
-  GtUword idx, lcpvalue = 0;
+  unsigned int *plcptab, *phitab, previousvalue;
+  GtUword idx;
 
   phitab = gt_malloc(sizeof (*phitab) * (totallength+1));
+  plcptab = phitab; /* overlay both arrays */
+  gt_assert(totallength <= (GtUword) UINT_MAX);
+#ifdef GT_THREADS_ENABLED
+  if (gt_linlcp_useparallel(totallength))
+  {
+    GtLinlcpthreadinfo *thtab = gt_malloc(sizeof *thtab * gt_jobs);
+    unsigned int *lcptab = NULL;
+
+    thtab[0].table = phitab;
+    thtab[0].plcptab = NULL;
+    thtab[0].suftab = suftab;
+    thtab[0].sequence = sequence;
+    thtab[0].withspecial = withspecial;
+    thtab[0].partwidth = partwidth;
+    thtab[0].totallength = totallength;
+    (void) gt_linlcp_run_threads(thtab,GT_LINLCP_PHI,totallength+1);
+    *maxlcp = gt_linlcp_run_threads(thtab,GT_LINLCP_PLCP,totallength);
+    if (!onlyplcp)
+    {
+      lcptab = gt_malloc(sizeof (*lcptab) * (totallength+1));
+      thtab[0].table = lcptab;
+      thtab[0].plcptab = plcptab;
+      (void) gt_linlcp_run_threads(thtab,GT_LINLCP_PLCP2LCP,totallength+1);
+      gt_free(plcptab);
+    }
+    gt_free(thtab);
+    return onlyplcp ? plcptab : lcptab;
+  }
+#endif
   previousvalue = suftab[0];
   for (idx = 1UL; idx <= totallength; idx++)
   {
@@ -147,46 +333,13 @@ unsigned int *gt_plain_lcp_phialgorithm(bool onlyplcp,
     phitab[currentvalue] = previousvalue;
     previousvalue = currentvalue;
   }
-  plcptab = phitab; /* overlay both arrays */
-  suftab0 = suftab[0];
-  gt_assert(totallength <= (GtUword) UINT_MAX);
-  *maxlcp = 0;
-  for (pos = 0; pos < (unsigned int) totallength; pos++)
-  {
-    if (pos != suftab0)
-    {
-      const unsigned int currentphitab = phitab[pos];
-      const GtUword lastoffset = totallength - MAX(pos,currentphitab);
-      const GtUchar *ptr1 = sequence + pos,
-                    *ptr2 = sequence + currentphitab;
-
-      while (lcpvalue < lastoffset)
-      {
-        GtUchar cc1 = ptr1[lcpvalue];
-        GtUchar cc2 = ptr2[lcpvalue];
-        if (cc1 == cc2 && (!withspecial || ISNOTSPECIAL(cc1)))
-        {
-          lcpvalue++;
-        } else
-        {
-          break;
-        }
-      }
-      gt_assert(lcpvalue <= (GtUword) UINT_MAX);
-      plcptab[pos] = (unsigned int) lcpvalue;
-      if (lcpvalue > 0)
-      {
-        if (*maxlcp < lcpvalue)
-        {
-          *maxlcp = lcpvalue;
-        }
-        lcpvalue--;
-      }
-    } else
-    {
-      plcptab[pos] = 0;
-    }
-  }
+  *maxlcp = gt_plain_plcp_phi_range(plcptab,
+                                    sequence,
+                                    withspecial,
+                                    totallength,
+                                    suftab[0],
+                                    0,
+                                    totallength);
   if (onlyplcp)
   {
     return plcptab;
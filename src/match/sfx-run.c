@@ -25,6 +25,7 @@
 #include "core/codetype.h"
 #include "core/encseq.h"
 #include "core/encseq_metadata.h"
+#include "core/encseq_shards.h"
 #include "core/fa.h"
 #include "core/logger.h"
 #include "core/readmode.h"
@@ -455,7 +456,10 @@ int gt_runsuffixerator(bool doesa,
   {
     GtEncseqLoader *el;
     el = gt_encseq_loader_new_from_options(so->loadopts, err);
-    if (!gt_encseq_options_ssp_value(so->loadopts))
+    /* the volumes of a sharded encoded sequence have no common metadata,
+       the loader determines the tables of each volume */
+    if (!gt_encseq_options_ssp_value(so->loadopts) &&
+        !gt_encseq_shards_exist(gt_str_get(so->inputindex)))
     {
       GtEncseqMetadata* emd = gt_encseq_metadata_new(gt_str_get(so->inputindex),
                                                      err);
@@ -20,6 +20,9 @@
 #include "core/unused_api.h"
 #include "core/timer_api.h"
 #include "core/mathsupport.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#endif
 #include "sfx-lwcheck.h"
 #include "bare-encseq.h"
 #include "sfx-sain.h"
@@ -49,6 +52,10 @@ typedef enum
 
 typedef signed int GtSsainindextype;
 
+#ifdef GT_THREADS_ENABLED
+typedef struct GtSainchunkinfo GtSainchunkinfo;
+#endif
+
 typedef struct
 {
   GtUword totallength,
@@ -67,6 +74,11 @@ typedef struct
   GtReadmode readmode; /* only relevant for encseq and bare_encseq */
   const GtBareEncseq *bare_encseq;
   GtSainSeqtype seqtype;
+#ifdef GT_THREADS_ENABLED
+  /* the chunks classified when inserting the S*-suffixes, reused by the
+     later scans of the same sequence */
+  GtSainchunkinfo *chunks;
+#endif
   bool bucketfillptrpoints2suftab,
        bucketsizepoints2suftab,
        roundtablepoints2suftab;
@@ -107,6 +119,9 @@ static void gt_sain_allocate_tmpspace(GtSainseq *sainseq,
   sainseq->bucketfillptrpoints2suftab = false;
   sainseq->bucketsizepoints2suftab = false;
   sainseq->roundtablepoints2suftab = false;
+#ifdef GT_THREADS_ENABLED
+  sainseq->chunks = NULL;
+#endif
 }
 
 static GtSainseq *gt_sainseq_new_from_encseq(const GtEncseq *encseq,
@@ -204,6 +219,9 @@ static GtSainseq *gt_sainseq_new_from_array(GtUsainindextype *arr,
   GtSainseq *sainseq = (GtSainseq *) gt_malloc(sizeof *sainseq);
 
   sainseq->seqtype = GT_SAIN_INTSEQ;
+#ifdef GT_THREADS_ENABLED
+  sainseq->chunks = NULL;
+#endif
   sainseq->seq.array = arr;
   sainseq->totallength = len;
   sainseq->bare_encseq = NULL;
@@ -296,6 +314,9 @@ static void gt_sainseq_delete(GtSainseq *sainseq)
     {
       gt_free(sainseq->sstarfirstcharcount);
     }
+#ifdef GT_THREADS_ENABLED
+    gt_free(sainseq->chunks);
+#endif
     gt_free(sainseq);
   }
 }
@@ -666,10 +687,663 @@ static void gt_sain_induceStypes2fromspecialranges(const GtSainseq *sainseq,
 
 #include "match/sfx-sain.inc"
 
+static void gt_sain_determineSstarfirstchardist(GtSainseq *sainseq)
+{
+  const GtUsainindextype *seqptr;
+  GtUword nextcc = GT_UNIQUEINT(sainseq->totallength);
+  bool nextisStype = true;
+
+  gt_assert(sainseq->seqtype == GT_SAIN_INTSEQ);
+  for (seqptr = sainseq->seq.array + sainseq->totallength - 1;
+       seqptr >= sainseq->seq.array; seqptr--)
+  {
+    GtUword currentcc = (GtUword) *seqptr;
+    bool currentisStype = (currentcc < nextcc ||
+                           (currentcc == nextcc && nextisStype)) ? true : false;
+    if (!currentisStype && nextisStype)
+    {
+      sainseq->sstarfirstcharcount[nextcc]++;
+    }
+    sainseq->bucketsize[currentcc]++;
+    nextisStype = currentisStype;
+    nextcc = currentcc;
+  }
+}
+
+#ifdef GT_THREADS_ENABLED
+
+/* The following functions split the sequence into <gt_jobs> chunks of
+   consecutive positions and classify the positions of each chunk in a
+   separate thread. The type of the first position after a chunk is determined
+   independently by each thread, so that all threads scan their chunk from
+   right to left in the same way as the sequential functions do. The S*-suffixes
+   of a chunk are written to the same places as in the sequential scan: for each
+   chunk we first count them and then derive the write positions from the
+   counts of the chunks to the right. So the content of the suffix array after
+   each step is identical to the one obtained by the sequential functions. */
+
+#define GT_SAIN_MINCHUNKLENGTH 4096UL
+
+typedef enum
+{
+  GT_SAIN_CHUNK_COUNT,
+  GT_SAIN_CHUNK_INSERT,
+  GT_SAIN_CHUNK_EXPAND,
+  GT_SAIN_CHUNK_LENGTH,
+  GT_SAIN_CHUNK_MAP
+} GtSainchunkmode;
+
+struct GtSainchunkinfo
+{
+  const GtSainseq *sainseq;
+  GtUword start, /* first position of the chunk */
+          end, /* first position after the chunk */
+          nextcc, /* character at position end */
+          countSstartype,
+          leftmostSstar,
+          nextSstartypepos;
+  bool nextisStype; /* type of position end */
+  GtUsainindextype *suftab,
+                   *sstarcount, /* per character, only for mode COUNT */
+                   *sstarptr; /* only for mode EXPAND and MAP */
+  GtSainchunkmode mode;
+  GtThread *thread;
+};
+
+static bool gt_sain_useparallel(const GtSainseq *sainseq)
+{
+  return gt_jobs > 1U &&
+         sainseq->totallength >= GT_SAIN_MINCHUNKLENGTH * gt_jobs
+         ? true : false;
+}
+
+/* Returns the character at the next position delivered by <esr>, or by
+   direct access if <esr> is NULL. */
+static GtUword gt_sain_chunk_getchar(const GtSainseq *sainseq,
+                                     GtEncseqReader *esr,
+                                     GtUword position)
+{
+  if (esr != NULL)
+  {
+    GtUchar cc = gt_encseq_reader_next_encoded_char(esr);
+
+    return ISSPECIAL(cc) ? GT_UNIQUEINT(position) : (GtUword) cc;
+  }
+  return gt_sainseq_getchar(sainseq,position);
+}
+
+static bool gt_sain_isStype(const GtSainseq *sainseq,GtUword position)
+{
+  GtEncseqReader *esr = NULL;
+  GtUword currentcc;
+  bool isStype;
+
+  if (sainseq->seqtype == GT_SAIN_ENCSEQ)
+  {
+    esr = gt_encseq_create_reader_with_readmode(sainseq->seq.encseq,
+                                                sainseq->readmode,
+                                                position);
+  }
+  currentcc = gt_sain_chunk_getchar(sainseq,esr,position);
+  while (true)
+  {
+    GtUword nextcc = position + 1 < sainseq->totallength
+                       ? gt_sain_chunk_getchar(sainseq,esr,position + 1)
+                       : GT_UNIQUEINT(sainseq->totallength);
+
+    if (currentcc != nextcc)
+    {
+      isStype = currentcc < nextcc ? true : false;
+      break;
+    }
+    position++;
+  }
+  gt_encseq_reader_delete(esr);
+  return isStype;
+}
+
+static void *gt_sain_chunk_thread(void *data)
+{
+  GtSainchunkinfo *chunk = (GtSainchunkinfo *) data;
+  const GtSainseq *sainseq = chunk->sainseq;
+  GtEncseqReader *esr = NULL;
+  GtUword position, nextcc;
+  bool nextisStype;
+
+  if (chunk->mode == GT_SAIN_CHUNK_MAP)
+  {
+    GtUsainindextype *suftabptr;
+
+    for (suftabptr = chunk->suftab + chunk->start;
+         suftabptr < chunk->suftab + chunk->end; suftabptr++)
+    {
+      *suftabptr = chunk->sstarptr[*suftabptr];
+    }
+    return NULL;
+  }
+  if (chunk->mode == GT_SAIN_CHUNK_COUNT)
+  {
+    if (chunk->end < sainseq->totallength)
+    {
+      chunk->nextcc = gt_sainseq_getchar(sainseq,chunk->end);
+      chunk->nextisStype = gt_sain_isStype(sainseq,chunk->end);
+    } else
+    {
+      chunk->nextcc = GT_UNIQUEINT(sainseq->totallength);
+      chunk->nextisStype = true;
+    }
+    chunk->countSstartype = 0;
+    chunk->leftmostSstar = sainseq->totallength;
+  }
+  nextcc = chunk->nextcc;
+  nextisStype = chunk->nextisStype;
+  /* as the sequential scan, read the chunk from right to left with one
+     reader instead of accessing each position of the encoded sequence */
+  if (sainseq->seqtype == GT_SAIN_ENCSEQ && chunk->start < chunk->end)
+  {
+    esr = gt_encseq_create_reader_with_readmode(
+                            sainseq->seq.encseq,
+                            gt_readmode_inverse_direction(sainseq->readmode),
+                            sainseq->totallength - chunk->end);
+  }
+  for (position = chunk->end; position > chunk->start; /* Nothing */)
+  {
+    GtUword currentcc;
+    bool currentisStype;
+
+    position--;
+    currentcc = gt_sain_chunk_getchar(sainseq,esr,position);
+    currentisStype = (currentcc < nextcc ||
+                      (currentcc == nextcc && nextisStype)) ? true : false;
+    if (!currentisStype && nextisStype)
+    {
+      switch (chunk->mode)
+      {
+        case GT_SAIN_CHUNK_COUNT:
+          chunk->countSstartype++;
+          if (chunk->sstarcount != NULL)
+          {
+            chunk->sstarcount[nextcc]++;
+          }
+          chunk->leftmostSstar = position + 1;
+          break;
+        case GT_SAIN_CHUNK_INSERT:
+          /* sstarcount now holds the fill pointers of this chunk */
+          chunk->suftab[--chunk->sstarcount[nextcc]]
+            = (GtUsainindextype) position;
+          break;
+        case GT_SAIN_CHUNK_EXPAND:
+          *--chunk->sstarptr = (GtUsainindextype) (position + 1);
+          break;
+        case GT_SAIN_CHUNK_LENGTH:
+          gt_assert(position < chunk->nextSstartypepos);
+          chunk->suftab[GT_DIV2(position+1)]
+            = (GtUsainindextype) (chunk->nextSstartypepos - position);
+          chunk->nextSstartypepos = position + 1;
+          break;
+        default:
+          gt_assert(false);
+      }
+    }
+    nextisStype = currentisStype;
+    nextcc = currentcc;
+  }
+  gt_encseq_reader_delete(esr);
+  return NULL;
+}
+
+static GtSainchunkinfo *gt_sain_chunks_new(const GtSainseq *sainseq,
+                                           GtUword length,
+                                           GtUsainindextype *suftab,
+                                           bool withsstarcount)
+{
+  unsigned int t;
+  GtUword chunklength = length/gt_jobs;
+  GtSainchunkinfo *chunks = gt_malloc(sizeof *chunks * gt_jobs);
+
+  for (t = 0; t < gt_jobs; t++)
+  {
+    chunks[t].sainseq = sainseq;
+    chunks[t].start = t * chunklength;
+    chunks[t].end = t == gt_jobs - 1 ? length : (t+1) * chunklength;
+    chunks[t].suftab = suftab;
+    chunks[t].sstarptr = NULL;
+    chunks[t].sstarcount
+      = withsstarcount ? gt_calloc((size_t) sainseq->numofchars,
+                                   sizeof *chunks[t].sstarcount)
+                       : NULL;
+  }
+  return chunks;
+}
+
+static void gt_sain_chunks_delete(GtSainchunkinfo *chunks)
+{
+  unsigned int t;
+
+  for (t = 0; t < gt_jobs; t++)
+  {
+    gt_free(chunks[t].sstarcount);
+  }
+  gt_free(chunks);
+}
+
+static void gt_sain_chunks_run(GtSainchunkinfo *chunks,GtSainchunkmode mode)
+{
+  unsigned int t;
+
+  for (t = 0; t < gt_jobs; t++)
+  {
+    chunks[t].mode = mode;
+    chunks[t].thread = gt_thread_new(gt_sain_chunk_thread,chunks + t,NULL);
+    gt_assert(chunks[t].thread != NULL);
+  }
+  for (t = 0; t < gt_jobs; t++)
+  {
+    gt_thread_join(chunks[t].thread);
+    gt_thread_delete(chunks[t].thread);
+  }
+}
+
+static GtUword gt_sain_parallel_insertSstarsuffixes(GtSainseq *sainseq,
+                                                    GtUsainindextype *suftab)
+{
+  GtUword charidx, countSstartype = 0;
+  unsigned int t;
+  GtSainchunkinfo *chunks = gt_sain_chunks_new(sainseq,sainseq->totallength,
+                                               suftab,true);
+
+  gt_sain_chunks_run(chunks,GT_SAIN_CHUNK_COUNT);
+  gt_sain_endbuckets(sainseq);
+  /* the sequential scan processes the rightmost chunk first, so its
+     S*-suffixes are stored at the end of the buckets */
+  for (t = gt_jobs; t > 0; t--)
+  {
+    GtUsainindextype *sstarcount = chunks[t-1].sstarcount;
+
+    for (charidx = 0; charidx < sainseq->numofchars; charidx++)
+    {
+      GtUsainindextype count = sstarcount[charidx];
+
+      if (sainseq->sstarfirstcharcount != NULL)
+      {
+        sainseq->sstarfirstcharcount[charidx] += count;
+      }
+      sstarcount[charidx] = sainseq->bucketfillptr[charidx];
+      sainseq->bucketfillptr[charidx] -= count;
+    }
+    countSstartype += chunks[t-1].countSstartype;
+  }
+  gt_sain_chunks_run(chunks,GT_SAIN_CHUNK_INSERT);
+  /* keep the classification of the chunks for the later scans */
+  for (t = 0; t < gt_jobs; t++)
+  {
+    gt_free(chunks[t].sstarcount);
+    chunks[t].sstarcount = NULL;
+  }
+  gt_free(sainseq->chunks);
+  sainseq->chunks = chunks;
+  gt_assert(GT_MULT2(countSstartype) <= sainseq->totallength);
+  return countSstartype;
+}
+
+/* Returns the chunks of the sequence of <sainseq> classified when inserting
+   the S*-suffixes, or classifies them if this was done sequentially. */
+static GtSainchunkinfo *gt_sain_classifiedchunks(GtSainseq *sainseq,
+                                                 GtUsainindextype *suftab)
+{
+  unsigned int t;
+
+  if (sainseq->chunks == NULL)
+  {
+    sainseq->chunks = gt_sain_chunks_new(sainseq,sainseq->totallength,suftab,
+                                         false);
+    gt_sain_chunks_run(sainseq->chunks,GT_SAIN_CHUNK_COUNT);
+  }
+  for (t = 0; t < gt_jobs; t++)
+  {
+    sainseq->chunks[t].suftab = suftab;
+  }
+  return sainseq->chunks;
+}
+
+static void gt_sain_parallel_assignSstarlength(GtSainseq *sainseq,
+                                               GtUsainindextype *lentab)
+{
+  GtUword nextSstartypepos = sainseq->totallength;
+  unsigned int t;
+  GtSainchunkinfo *chunks = gt_sain_classifiedchunks(sainseq,lentab);
+
+  for (t = gt_jobs; t > 0; t--)
+  {
+    chunks[t-1].nextSstartypepos = nextSstartypepos;
+    if (chunks[t-1].countSstartype > 0)
+    {
+      nextSstartypepos = chunks[t-1].leftmostSstar;
+    }
+  }
+  gt_sain_chunks_run(chunks,GT_SAIN_CHUNK_LENGTH);
+}
+
+static void gt_sain_parallel_expandorder2original(GtSainseq *sainseq,
+                                                  GtUword numberofsuffixes,
+                                                  GtUsainindextype *suftab)
+{
+  GtUsainindextype *sstarsuffixes = suftab + GT_MULT2(numberofsuffixes);
+  unsigned int t;
+  GtSainchunkinfo *chunks = gt_sain_classifiedchunks(sainseq,suftab);
+
+  for (t = gt_jobs; t > 0; t--)
+  {
+    chunks[t-1].sstarptr = sstarsuffixes;
+    sstarsuffixes -= chunks[t-1].countSstartype;
+  }
+  gt_assert(sstarsuffixes == suftab + numberofsuffixes);
+  gt_sain_chunks_run(chunks,GT_SAIN_CHUNK_EXPAND);
+  chunks = gt_sain_chunks_new(sainseq,numberofsuffixes,suftab,false);
+  for (t = 0; t < gt_jobs; t++)
+  {
+    chunks[t].sstarptr = sstarsuffixes;
+  }
+  gt_sain_chunks_run(chunks,GT_SAIN_CHUNK_MAP);
+  gt_sain_chunks_delete(chunks);
+  if (sainseq->seqtype == GT_SAIN_INTSEQ)
+  {
+    GtUword charidx;
+
+    gt_assert(sainseq->sstarfirstcharcount == NULL);
+    sainseq->sstarfirstcharcount = sainseq->bucketfillptr;
+    for (charidx = 0; charidx < sainseq->numofchars; charidx++)
+    {
+      sainseq->sstarfirstcharcount[charidx] = 0;
+      sainseq->bucketsize[charidx] = 0;
+    }
+    gt_sain_determineSstarfirstchardist(sainseq);
+  }
+}
+
+/* The induction scans cannot be split into independent chunks, as a suffix
+   placed into a bucket may be read later by the same scan. But most of their
+   time is spent on the random accesses to the sequence, which deliver the
+   character of each suffix and the type of its left context. So the scans
+   process the suffix array in blocks: the threads first look up this
+   information for the entries of a block, then the entries are induced
+   sequentially as by the functions in sfx-sain.inc. An entry changed by the
+   sequential scan after the threads have read it is looked up again. */
+
+#define GT_SAIN_INDUCEBLOCKSIZE 65536UL
+
+/* Only the access to an encoded sequence is expensive enough to gain from
+   this. For the other sequences the sequential part alone takes about as
+   long as the sequential scan. */
+static bool gt_sain_useparallelinduce(const GtSainseq *sainseq)
+{
+  return sainseq->seqtype == GT_SAIN_ENCSEQ && gt_sain_useparallel(sainseq)
+         ? true : false;
+}
+/* no suffix is induced from the entry */
+#define GT_SAIN_INDUCENONE      UINT_MAX
+/* the entry of an L-scan refers to a special character and is cleared */
+#define GT_SAIN_INDUCESPECIAL   (UINT_MAX - 1U)
+
+typedef enum
+{
+  GT_SAIN_INDUCE_L1,
+  GT_SAIN_INDUCE_S1,
+  GT_SAIN_INDUCE_L2,
+  GT_SAIN_INDUCE_S2
+} GtSaininducemode;
+
+typedef struct
+{
+  const GtSainseq *sainseq;
+  const GtSsainindextype *suftab;
+  GtSsainindextype *values;
+  GtUsainindextype *codes;
+  GtUword start, end;
+  GtSaininducemode mode;
+  GtThread *thread;
+} GtSaininduceslice;
+
+/* Returns (cc << 1) | flag for the suffix <cc> to be induced from the entry
+   <value> > 0 in the given <mode>, where <flag> tells if the left context
+   of the induced suffix leads to an entry of the other type. */
+static GtUsainindextype gt_sain_inducecode(const GtSainseq *sainseq,
+                                           GtSaininducemode mode,
+                                           GtSsainindextype value)
+{
+  GtUword position = (GtUword) value, currentcc, leftcontextcc;
+  bool flag;
+
+  gt_assert(value > 0);
+  if (mode == GT_SAIN_INDUCE_L1 || mode == GT_SAIN_INDUCE_S1)
+  {
+    /* only the fast method marks entries by adding totallength */
+    if (position >= sainseq->totallength)
+    {
+      position -= sainseq->totallength;
+    }
+    if (position == 0)
+    {
+      return mode == GT_SAIN_INDUCE_L1 &&
+             gt_sainseq_getchar(sainseq,0) >= sainseq->numofchars
+               ? GT_SAIN_INDUCESPECIAL : GT_SAIN_INDUCENONE;
+    }
+    currentcc = gt_sainseq_getchar(sainseq,position);
+    if (currentcc >= sainseq->numofchars)
+    {
+      return mode == GT_SAIN_INDUCE_L1 ? GT_SAIN_INDUCESPECIAL
+                                       : GT_SAIN_INDUCENONE;
+    }
+    leftcontextcc = gt_sainseq_getchar(sainseq,position - 1);
+    flag = mode == GT_SAIN_INDUCE_L1 ? leftcontextcc < currentcc
+                                     : leftcontextcc > currentcc;
+  } else
+  {
+    currentcc = gt_sainseq_getchar(sainseq,--position);
+    if (currentcc >= sainseq->numofchars)
+    {
+      return GT_SAIN_INDUCENONE;
+    }
+    if (position == 0)
+    {
+      flag = mode == GT_SAIN_INDUCE_S2 ? true : false;
+    } else
+    {
+      leftcontextcc = gt_sainseq_getchar(sainseq,position - 1);
+      flag = mode == GT_SAIN_INDUCE_L2 ? leftcontextcc < currentcc
+                                       : leftcontextcc > currentcc;
+    }
+  }
+  return (GtUsainindextype) ((currentcc << 1) | (flag ? 1UL : 0));
+}
+
+static void *gt_sain_induceslice_thread(void *data)
+{
+  GtSaininduceslice *slice = (GtSaininduceslice *) data;
+  GtUword idx;
+
+  for (idx = slice->start; idx < slice->end; idx++)
+  {
+    GtSsainindextype value = slice->suftab[idx];
+
+    slice->values[idx] = value;
+    if (value > 0)
+    {
+      slice->codes[idx] = gt_sain_inducecode(slice->sainseq,slice->mode,value);
+    }
+  }
+  return NULL;
+}
+
+/* looks up the codes of the entries of <suftab> in [blockstart,blockend),
+   stored at the offsets relative to <blockstart> */
+static void gt_sain_induceblock_prefetch(GtSaininduceslice *slices,
+                                         const GtSsainindextype *suftab,
+                                         GtUword blockstart,
+                                         GtUword blockend)
+{
+  GtUword slicelength = (blockend - blockstart + gt_jobs - 1)/gt_jobs;
+  unsigned int t;
+
+  for (t = 0; t < gt_jobs; t++)
+  {
+    slices[t].suftab = suftab + blockstart;
+    slices[t].start = MIN(t * slicelength,blockend - blockstart);
+    slices[t].end = MIN((t+1) * slicelength,blockend - blockstart);
+    slices[t].thread = gt_thread_new(gt_sain_induceslice_thread,slices + t,
+                                     NULL);
+    gt_assert(slices[t].thread != NULL);
+  }
+  for (t = 0; t < gt_jobs; t++)
+  {
+    gt_thread_join(slices[t].thread);
+    gt_thread_delete(slices[t].thread);
+  }
+}
+
+/* Performs the induction scan of the given <mode> over the first
+   <nonspecialentries> entries of <suftab>, with the same result as the
+   corresponding sequential scan. <currentround> is the round counter of the
+   fast method for the first induction and NULL otherwise. The S*-suffixes
+   preceding special ranges must already be induced for the S-scans. */
+static void gt_sain_parallel_induce(const GtSainseq *sainseq,
+                                    GtUsainindextype *currentround,
+                                    GtSsainindextype *suftab,
+                                    GtUword nonspecialentries,
+                                    GtSaininducemode mode)
+{
+  const GtSsainindextype totallength = (GtSsainindextype) sainseq->totallength;
+  const bool lscan = mode == GT_SAIN_INDUCE_L1 || mode == GT_SAIN_INDUCE_L2,
+             fast = currentround != NULL && sainseq->roundtable != NULL;
+  const GtUword blocksize = GT_SAIN_INDUCEBLOCKSIZE * gt_jobs;
+  GtUword lastupdatecc = 0, blockidx,
+          numofblocks = (nonspecialentries + blocksize - 1)/blocksize;
+  GtUsainindextype *fillptr = sainseq->bucketfillptr;
+  GtSsainindextype *bucketptr = NULL,
+                   *values = gt_malloc(sizeof *values * blocksize);
+  GtUsainindextype *codes = gt_malloc(sizeof *codes * blocksize);
+  GtSaininduceslice *slices = gt_malloc(sizeof *slices * gt_jobs);
+  unsigned int t;
+
+  if (fast && mode == GT_SAIN_INDUCE_L1)
+  {
+    *currentround = 0;
+  }
+  for (t = 0; t < gt_jobs; t++)
+  {
+    slices[t].sainseq = sainseq;
+    slices[t].values = values;
+    slices[t].codes = codes;
+    slices[t].mode = mode;
+  }
+  for (blockidx = 0; blockidx < numofblocks; blockidx++)
+  {
+    GtUword blockstart, blockend, idx;
+
+    if (lscan)
+    {
+      blockstart = blockidx * blocksize;
+      blockend = MIN(blockstart + blocksize,nonspecialentries);
+    } else
+    {
+      blockend = nonspecialentries - blockidx * blocksize;
+      blockstart = blockend > blocksize ? blockend - blocksize : 0;
+    }
+    gt_sain_induceblock_prefetch(slices,suftab,blockstart,blockend);
+    for (idx = 0; idx < blockend - blockstart; idx++)
+    {
+      GtSsainindextype *suftabptr
+        = suftab + (lscan ? blockstart + idx : blockend - 1 - idx);
+      GtSsainindextype position = *suftabptr;
+      GtUword offset = (GtUword) (suftabptr - suftab) - blockstart;
+      GtUsainindextype code;
+
+      if (position <= 0)
+      {
+        if (mode == GT_SAIN_INDUCE_L2 || mode == GT_SAIN_INDUCE_S2 ||
+            (mode == GT_SAIN_INDUCE_L1 && position < 0))
+        {
+          *suftabptr = ~position;
+        }
+        continue;
+      }
+      code = values[offset] == position
+               ? codes[offset]
+               : gt_sain_inducecode(sainseq,mode,position);
+      if (mode == GT_SAIN_INDUCE_L1 || mode == GT_SAIN_INDUCE_S1)
+      {
+        if (position >= totallength)
+        {
+          gt_assert(fast);
+          (*currentround)++;
+          position -= totallength;
+        }
+      } else
+      {
+        if (mode == GT_SAIN_INDUCE_L2)
+        {
+          *suftabptr = ~position;
+        }
+      }
+      if (code == GT_SAIN_INDUCESPECIAL)
+      {
+        *suftabptr = 0;
+      } else
+      {
+        if (code != GT_SAIN_INDUCENONE)
+        {
+          GtUword currentcc = (GtUword) (code >> 1);
+
+          /* the left context of the suffix at position is induced */
+          position--;
+          if (fast)
+          {
+            gt_assert(sainseq->roundtable[code] <= *currentround);
+            if (sainseq->roundtable[code] < *currentround)
+            {
+              position += totallength;
+              sainseq->roundtable[code] = *currentround;
+            }
+          }
+          GT_SAINUPDATEBUCKETPTR(currentcc);
+          if (lscan)
+          {
+            gt_assert(suftabptr < bucketptr);
+            *bucketptr++ = (code & 1U) ? ~position : position;
+          } else
+          {
+            gt_assert(bucketptr != NULL && bucketptr - 1 < suftabptr);
+            *(--bucketptr) = (code & 1U)
+                               ? ~(mode == GT_SAIN_INDUCE_S1 ? position + 1
+                                                             : position)
+                               : position;
+          }
+        }
+        if (mode == GT_SAIN_INDUCE_S1 ||
+            (mode == GT_SAIN_INDUCE_L1 && code != GT_SAIN_INDUCENONE))
+        {
+          *suftabptr = 0;
+        }
+      }
+    }
+  }
+  gt_free(slices);
+  gt_free(codes);
+  gt_free(values);
+}
+#endif
+
 static GtUword gt_sain_insertSstarsuffixes(GtSainseq *sainseq,
                                            GtUsainindextype *suftab,
                                            GtLogger *logger)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallel(sainseq) &&
+      sainseq->numofchars * gt_jobs <= sainseq->totallength)
+  {
+    return gt_sain_parallel_insertSstarsuffixes(sainseq,suftab);
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -717,6 +1391,14 @@ static void gt_sain_induceLtypesuffixes1(GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallelinduce(sainseq))
+  {
+    gt_sain_parallel_induce(sainseq,&sainseq->currentround,suftab,
+                            nonspecialentries,GT_SAIN_INDUCE_L1);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -772,6 +1454,19 @@ static void gt_sain_induceStypesuffixes1(GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallelinduce(sainseq))
+  {
+    gt_sain_special_singleSinduction1(sainseq,
+                                      suftab,
+                                      (GtSsainindextype)
+                                      (sainseq->totallength-1));
+    gt_sain_induceStypes1fromspecialranges(sainseq,suftab);
+    gt_sain_parallel_induce(sainseq,&sainseq->currentround,suftab,
+                            nonspecialentries,GT_SAIN_INDUCE_S1);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -932,6 +1627,14 @@ static void gt_sain_induceLtypesuffixes2(const GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallelinduce(sainseq))
+  {
+    gt_sain_parallel_induce(sainseq,NULL,suftab,nonspecialentries,
+                            GT_SAIN_INDUCE_L2);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -954,6 +1657,19 @@ static void gt_sain_induceStypesuffixes2(const GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallelinduce(sainseq))
+  {
+    gt_sain_special_singleSinduction2(sainseq,
+                                      suftab,
+                                      (GtSsainindextype) sainseq->totallength,
+                                      nonspecialentries);
+    gt_sain_induceStypes2fromspecialranges(sainseq,suftab,nonspecialentries);
+    gt_sain_parallel_induce(sainseq,NULL,suftab,nonspecialentries,
+                            GT_SAIN_INDUCE_S2);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -1079,6 +1795,13 @@ static void gt_sain_expandorder2original(GtSainseq *sainseq,
                                          GtUword numberofsuffixes,
                                          GtUsainindextype *suftab)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallel(sainseq))
+  {
+    gt_sain_parallel_expandorder2original(sainseq,numberofsuffixes,suftab);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -1103,6 +1826,13 @@ static void gt_sain_expandorder2original(GtSainseq *sainseq,
 static void gt_sain_assignSstarlength(GtSainseq *sainseq,
                                       GtUsainindextype *lentab)
 {
+#ifdef GT_THREADS_ENABLED
+  if (gt_sain_useparallel(sainseq))
+  {
+    gt_sain_parallel_assignSstarlength(sainseq,lentab);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -1192,29 +1922,6 @@ static GtUword gt_sain_assignSstarnames(const GtSainseq *sainseq,
   return currentname;
 }
 
-static void gt_sain_determineSstarfirstchardist(GtSainseq *sainseq)
-{
-  const GtUsainindextype *seqptr;
-  GtUword nextcc = GT_UNIQUEINT(sainseq->totallength);
-  bool nextisStype = true;
-
-  gt_assert(sainseq->seqtype == GT_SAIN_INTSEQ);
-  for (seqptr = sainseq->seq.array + sainseq->totallength - 1;
-       seqptr >= sainseq->seq.array; seqptr--)
-  {
-    GtUword currentcc = (GtUword) *seqptr;
-    bool currentisStype = (currentcc < nextcc ||
-                           (currentcc == nextcc && nextisStype)) ? true : false;
-    if (!currentisStype && nextisStype)
-    {
-      sainseq->sstarfirstcharcount[nextcc]++;
-    }
-    sainseq->bucketsize[currentcc]++;
-    nextisStype = currentisStype;
-    nextcc = currentcc;
-  }
-}
-
 static void gt_sain_insertsortedSstarsuffixes(const GtSainseq *sainseq,
                                               GtUsainindextype *suftab,
                                               GtUword readidx,
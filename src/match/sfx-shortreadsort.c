@@ -19,6 +19,7 @@
 #include "core/intbits.h"
 #include "core/stack-inlined.h"
 #include "core/minmax.h"
+#include "core/encseq.h"
 #include "core/assert_api.h"
 #include "sfx-lcpvalues.h"
 #include "sfx-shortreadsort.h"
@@ -41,7 +42,8 @@ struct GtShortreadsortworkinfo
   uint16_t *mediumsizelcpvalues; /* always NULL for firstcodes;
                                     otherwise: NULL if lcpvalues are
                                     not required */
-  GtUword *seqnum_relpos_bucket; /* only for firstcodes */
+  GtUword *seqnum_relpos_bucket, /* only for firstcodes */
+          *seqnum_bucket;        /* only for firstcodes */
   GtArrayGtTwobitencoding tbereservoir;
   GtUword tmplcplen, currentbucketsize, sumofstoredvalues;
   bool fwd, complement, withmediumsizelcps;
@@ -70,7 +72,7 @@ static GtUword gt_shortreadsort_encoding_size(GtUword bucketsize,
 static size_t gt_shortreadsort_size_perbucketentry(bool firstcodes,
                                                    GtUword maxremain)
 {
-  return (firstcodes ? sizeof (uint16_t) : 0) +
+  return (firstcodes ? (sizeof (uint16_t) + sizeof (GtUword)) : 0) +
          sizeof (GtShortreadsort) + sizeof (GtUword) +
          sizeof (GtTwobitencoding) *
          gt_shortreadsort_encoding_factor(maxremain);
@@ -109,6 +111,9 @@ static void gt_shortreadsort_resize(GtShortreadsortworkinfo *srsw,
     srsw->seqnum_relpos_bucket
       = gt_realloc(srsw->seqnum_relpos_bucket,
                    sizeof (*srsw->seqnum_relpos_bucket) * bucketsize);
+    srsw->seqnum_bucket
+      = gt_realloc(srsw->seqnum_bucket,
+                   sizeof (*srsw->seqnum_bucket) * bucketsize);
   }
   if ((firstcodes || srsw->withmediumsizelcps) &&
       srsw->currentbucketsize < bucketsize)
@@ -149,6 +154,7 @@ GtShortreadsortworkinfo *gt_shortreadsort_new(GtUword maxwidth,
   srsw->mediumsizelcpvalues = NULL;
   srsw->withmediumsizelcps = withmediumsizelcps;
   srsw->seqnum_relpos_bucket = NULL;
+  srsw->seqnum_bucket = NULL;
   GT_INITARRAY(&srsw->tbereservoir,GtTwobitencoding);
   if (maxwidth > 0)
   {
@@ -172,6 +178,8 @@ void gt_shortreadsort_delete(GtShortreadsortworkinfo *srsw)
     srsw->mediumsizelcpvalues = NULL;
     gt_free(srsw->seqnum_relpos_bucket);
     srsw->seqnum_relpos_bucket = NULL;
+    gt_free(srsw->seqnum_bucket);
+    srsw->seqnum_bucket = NULL;
     GT_FREEARRAY(&srsw->tbereservoir,GtTwobitencoding);
     gt_free(srsw);
   }
@@ -693,17 +701,29 @@ void gt_shortreadsort_firstcodes_sort(GtShortreadsortresult *srsresult,
                                       GtUword depth,
                                       GtUword maxdepth)
 {
-  GtUword idx, pos, seqnum, relpos, seqnum_relpos;
+  GtUword idx, seqnum, relpos, seqnum_relpos;
   gt_assert(maxdepth == 0 || maxdepth > depth);
 
   srsw->tbereservoir.nextfreeGtTwobitencoding = 0;
+  if (gt_spmsuftab_usebitsforpositions(spmsuftab))
+  {
+    /* convert all positions of the bucket at once, the relative positions
+       are stored in place of the absolute ones */
+    for (idx = 0; idx < width; idx++)
+    {
+      srsw->seqnum_relpos_bucket[idx]
+        = gt_spmsuftab_get(spmsuftab,subbucketleft + idx);
+    }
+    gt_encseq_seqnum_batch(encseq,srsw->seqnum_bucket,
+                           srsw->seqnum_relpos_bucket,
+                           srsw->seqnum_relpos_bucket,width);
+  }
   for (idx = 0; idx < width; idx++)
   {
     if (gt_spmsuftab_usebitsforpositions(spmsuftab))
     {
-      pos = gt_spmsuftab_get(spmsuftab,subbucketleft + idx);
-      seqnum = gt_encseq_seqnum(encseq,pos);
-      relpos = pos - gt_encseq_seqstartpos(encseq,seqnum);
+      seqnum = srsw->seqnum_bucket[idx];
+      relpos = srsw->seqnum_relpos_bucket[idx];
       srsw->shortreadsorttable[idx].suffixrepresentation
         = gt_seqnumrelpos_encode(snrp, seqnum, relpos);
     } else
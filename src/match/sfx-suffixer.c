@@ -1780,6 +1780,16 @@ Sfxiterator *gt_Sfxiterator_new_withadditionalvalues(
                                         : numofsuffixestosort);
     }
     estimatedspace += sizeof (uint8_t) * largestbucketsize;
+#ifdef GT_THREADS_ENABLED
+    /* each thread of the threaded sorting fills a table of lcp-values of its
+       own, which holds the largest bucket of a part */
+    if (GT_SFX_THREADS_JOBS > 1U && sfi->outlcpinfo != NULL &&
+        sfi->dcov == NULL && gt_Outlcpinfo_lcp2file(sfi->outlcpinfo))
+    {
+      estimatedspace += GT_SFX_THREADS_JOBS *
+                        gt_lcpvalues_requiredspace(largestbucketsize);
+    }
+#endif
     SHOWCURRENTSPACE;
 #ifdef DEBUGSIZEESTIMATION
     if (sfi->sfxstrategy.outsuftabonfile)
@@ -2086,7 +2096,12 @@ static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
     gt_bcktab_determinemaxsize(sfi->bcktab, sfi->currentmincode,
                                sfi->currentmaxcode,sumofwidthforpart);
 #ifdef GT_THREADS_ENABLED
-    if (GT_SFX_THREADS_JOBS > 1U
+    /* the threaded sorting computes lcp-values only if they are output to
+       a file and no difference cover is used, as the sorting with the
+       difference cover needs the lcp-values of the entire sample */
+    if (GT_SFX_THREADS_JOBS > 1U &&
+        (sfi->outlcpinfo == NULL ||
+         (sfi->dcov == NULL && gt_Outlcpinfo_lcp2file(sfi->outlcpinfo)))
 #ifdef GT_THREADS_PARTITION
         &&
         sfi->partitions_for_threads != NULL &&
@@ -2119,6 +2134,7 @@ static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
                                  sumofwidthforpart,
                                  sfi->numofchars,
                                  sfi->prefixlength,
+                                 sfi->outlcpinfo,
                                  sortmaxdepth,
                                  &sfi->sfxstrategy,
                                  processunsortedsuffixrange,
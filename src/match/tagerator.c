@@ -23,9 +23,12 @@
 #include "core/format64.h"
 #include "core/intbits.h"
 #include "core/ma_api.h"
+#include "core/minmax.h"
 #include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/str_array.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
+#include "core/xansi_api.h"
 #include "apmeoveridx.h"
 #include "dist-short.h"
 #include "echoseq.h"
@@ -56,6 +59,7 @@ typedef struct
   GtUchar transformedtag[MAXTAGSIZE],
         rctransformedtag[MAXTAGSIZE];
   GtUword taglen;
+  GtStr *outbuf; /* collects the output for the tag */
 } TgrTagwithlength;
 
 typedef struct
@@ -75,18 +79,19 @@ typedef struct
           firstitem = false;\
         } else\
         {\
-          (void) putchar('\t');\
+          gt_str_append_char(outbuf,'\t');\
         }
 
 static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
 {
   TgrShowmatchinfo *showmatchinfo = (TgrShowmatchinfo *) processinfo;
+  GtStr *outbuf = showmatchinfo->twlptr->outbuf;
   bool firstitem = true;
 
   gt_assert(showmatchinfo->tageratoroptions != NULL);
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBLENGTH)
   {
-    printf(""GT_WU"",match->dblen);
+    gt_str_append_uword(outbuf,match->dblen);
     firstitem = false;
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBSTARTPOS)
@@ -94,7 +99,7 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
     ADDTABULATOR;
     if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBABSPOS)
     {
-      printf(""GT_WU"",match->dbstartpos);
+      gt_str_append_uword(outbuf,match->dbstartpos);
     } else
     {
       GtUword seqstartpos,
@@ -102,27 +107,29 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
                                                   match->dbstartpos);
       seqstartpos = gt_encseq_seqstartpos(showmatchinfo->encseq, seqnum);
       gt_assert(seqstartpos <= match->dbstartpos);
-      printf(""GT_WU"\t"GT_WU"",seqnum, match->dbstartpos - seqstartpos);
+      gt_str_append_uword(outbuf,seqnum);
+      gt_str_append_char(outbuf,'\t');
+      gt_str_append_uword(outbuf,match->dbstartpos - seqstartpos);
     }
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBSEQUENCE)
   {
     ADDTABULATOR;
     gt_assert(match->dbsubstring != NULL);
-    gt_alphabet_decode_seq_to_fp(showmatchinfo->alpha,
-                                 stdout,
-                                 match->dbsubstring,
-                                 (GtUword) match->dblen);
+    gt_alphabet_decode_seq_to_str_append(showmatchinfo->alpha,
+                                         outbuf,
+                                         match->dbsubstring,
+                                         (GtUword) match->dblen);
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_STRAND)
   {
     ADDTABULATOR;
-    printf("%c",ISRCDIR(showmatchinfo->twlptr) ? '-' : '+');
+    gt_str_append_char(outbuf,ISRCDIR(showmatchinfo->twlptr) ? '-' : '+');
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_EDIST)
   {
     ADDTABULATOR;
-    printf(""GT_WU"",match->distance);
+    gt_str_append_uword(outbuf,match->distance);
   }
   if (showmatchinfo->tageratoroptions->maxintervalwidth > 0)
   {
@@ -144,20 +151,21 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
         if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSTARTPOS)
         {
           ADDTABULATOR;
-          printf(""GT_WU"",match->querylen - suffixlength);
+          gt_str_append_uword(outbuf,match->querylen - suffixlength);
         }
         if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
         {
           ADDTABULATOR;
-          printf(""GT_WU"",suffixlength);
+          gt_str_append_uword(outbuf,suffixlength);
         }
         if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSUFFIXSEQ)
         {
           ADDTABULATOR;
-          gt_alphabet_decode_seq_to_fp(NULL,
-                                       stdout,showmatchinfo->tagptr +
-                                       (match->querylen - suffixlength),
-                                       suffixlength);
+          gt_alphabet_decode_seq_to_str_append(NULL,
+                                               outbuf,showmatchinfo->tagptr +
+                                               (match->querylen -
+                                                suffixlength),
+                                               suffixlength);
         }
       }
     } else
@@ -165,26 +173,26 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
       if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSTARTPOS)
       {
         ADDTABULATOR;
-        printf("0");
+        gt_str_append_char(outbuf,'0');
       }
       if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
       {
         ADDTABULATOR;
-        printf(""GT_WU"",match->querylen);
+        gt_str_append_uword(outbuf,match->querylen);
       }
       if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSUFFIXSEQ)
       {
         ADDTABULATOR;
-        gt_alphabet_decode_seq_to_fp(NULL,
-                                     stdout,
-                                     showmatchinfo->tagptr,
-                                     match->querylen);
+        gt_alphabet_decode_seq_to_str_append(NULL,
+                                             outbuf,
+                                             showmatchinfo->tagptr,
+                                             match->querylen);
       }
     }
   }
   if (!firstitem)
   {
-    printf("\n");
+    gt_str_append_char(outbuf,'\n');
   }
 }
 
@@ -272,7 +280,9 @@ static void showmstats(void *processinfo,
 {
   TgrTagwithlength *twl = (TgrTagwithlength *) patterninfo;
 
-  printf(""GT_WU" %c",mstatlength,ISRCDIR(twl) ? '-' : '+');
+  gt_str_append_uword(twl->outbuf,mstatlength);
+  gt_str_append_char(twl->outbuf,' ');
+  gt_str_append_char(twl->outbuf,ISRCDIR(twl) ? '-' : '+');
   if (gt_intervalwidthleq((const Limdfsresources *) processinfo,leftbound,
                        rightbound))
   {
@@ -284,10 +294,11 @@ static void showmstats(void *processinfo,
                                   mstatlength);
     for (idx = 0; idx<mstatspos->nextfreeGtUword; idx++)
     {
-      printf(" "GT_WU"",mstatspos->spaceGtUword[idx]);
+      gt_str_append_char(twl->outbuf,' ');
+      gt_str_append_uword(twl->outbuf,mstatspos->spaceGtUword[idx]);
     }
   }
-  printf("\n");
+  gt_str_append_char(twl->outbuf,'\n');
 }
 
 static int cmpdescend(const void *a,const void *b)
@@ -535,11 +546,360 @@ static void searchoverstrands(const TageratorOptions *tageratoroptions,
   }
 }
 
+static void tgr_showtag(const TageratorOptions *tageratoroptions,
+                        const GtAlphabet *alpha,
+                        uint64_t tagnumber,
+                        const TgrTagwithlength *twl)
+{
+  GtStr *outbuf = twl->outbuf;
+  bool firstitem = true;
+
+  gt_str_append_char(outbuf,'#');
+  if (tageratoroptions->outputmode & TAGOUT_TAGNUM)
+  {
+    char numbuf[32];
+
+    (void) snprintf(numbuf,sizeof (numbuf),"\t" Formatuint64_t,
+                    PRINTuint64_tcast(tagnumber));
+    gt_str_append_cstr(outbuf,numbuf);
+    firstitem = false;
+  }
+  if (tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
+  {
+    ADDTABULATOR;
+    gt_str_append_uword(outbuf,twl->taglen);
+  }
+  if (tageratoroptions->outputmode & TAGOUT_TAGSEQ)
+  {
+    ADDTABULATOR;
+    gt_alphabet_decode_seq_to_str_append(alpha,outbuf,twl->transformedtag,
+                                         twl->taglen);
+  }
+  gt_str_append_char(outbuf,'\n');
+}
+
+/* the tags are read in chunks of at most TGR_UNITS_PER_THREAD units per
+   thread. A unit consists of batchsize tags in batch mode and of a single
+   tag otherwise. The units of a chunk are distributed over the threads and
+   the output collected for each tag is shown in the order of the tags
+   after the chunk has been processed. */
+
+#define TGR_UNITS_PER_THREAD 16
+
+typedef struct
+{
+  const TageratorOptions *tageratoroptions;
+  const AbstractDfstransformer *dfst;
+  const GtAlphabet *alpha;
+  TgrTagwithlength twl;
+  TgrShowmatchinfo showmatchinfo;
+  ArrayTgrSimplematch storeonline, storeoffline;
+  Myersonlineresources *mor;
+  Genericindex *genericindexview; /* NULL for the first thread */
+  Limdfsresources *limdfsresources;
+  const GtUchar **patterntab;
+  GtUword *patternlentab;
+  GtUwordPair *boundtab;
+  const TgrTagwithlength *tagtab;
+  GtUword numoftags, unitsize, *nextunit;
+  uint64_t firsttagnumber;
+  GtMutex *mutex;
+  GtThread *thread;
+} TgrThreadinfo;
+
+/* make <tag> the current tag of the thread */
+static void tgr_settag(TgrThreadinfo *threadinfo,const TgrTagwithlength *tag)
+{
+  threadinfo->twl = *tag;
+  threadinfo->twl.tagptr = threadinfo->twl.transformedtag;
+}
+
+/* search the exact matches of all tags in the unit: first determine the
+   bwt-intervals of all tags and their reverse complements by interleaved
+   backward searches, then report the matches in the same order as
+   searchoverstrands does for a single tag */
+static void tgr_searchbatch(TgrThreadinfo *threadinfo,
+                            GtUword firsttag,
+                            GtUword numoftags)
+{
+  const TageratorOptions *tageratoroptions = threadinfo->tageratoroptions;
+  const TgrTagwithlength *tagtab = threadinfo->tagtab + firsttag;
+  TgrTagwithlength *twl = &threadinfo->twl;
+  GtUword idx, numofpatterns = 0;
+
+  for (idx = 0; idx < numoftags; idx++)
+  {
+    if (!tageratoroptions->nofwdmatch)
+    {
+      threadinfo->patterntab[numofpatterns] = tagtab[idx].transformedtag;
+      threadinfo->patternlentab[numofpatterns++] = tagtab[idx].taglen;
+    }
+    if (!tageratoroptions->norcmatch)
+    {
+      threadinfo->patterntab[numofpatterns] = tagtab[idx].rctransformedtag;
+      threadinfo->patternlentab[numofpatterns++] = tagtab[idx].taglen;
+    }
+  }
+  gt_indexbasedexactpatternmatching_batch(threadinfo->limdfsresources,
+                                          numofpatterns,
+                                          threadinfo->patterntab,
+                                          threadinfo->patternlentab,
+                                          threadinfo->boundtab);
+  numofpatterns = 0;
+  for (idx = 0; idx < numoftags; idx++)
+  {
+    tgr_settag(threadinfo,tagtab + idx);
+    tgr_showtag(tageratoroptions,threadinfo->alpha,
+                threadinfo->firsttagnumber + firsttag + idx,twl);
+    threadinfo->showmatchinfo.tagptr = twl->tagptr = twl->transformedtag;
+    if (!tageratoroptions->nofwdmatch)
+    {
+      (void) gt_indexbasedexactpatternmatching_bound(
+                                               threadinfo->limdfsresources,
+                                               threadinfo->boundtab +
+                                                 numofpatterns++,
+                                               twl->taglen);
+    }
+    if (!tageratoroptions->norcmatch)
+    {
+      threadinfo->showmatchinfo.tagptr = twl->tagptr = twl->rctransformedtag;
+      (void) gt_indexbasedexactpatternmatching_bound(
+                                               threadinfo->limdfsresources,
+                                               threadinfo->boundtab +
+                                                 numofpatterns++,
+                                               twl->taglen);
+    }
+  }
+}
+
+static void tgr_processunit(TgrThreadinfo *threadinfo,GtUword unit)
+{
+  GtUword idx, firsttag = unit * threadinfo->unitsize,
+          numoftags = MIN(threadinfo->unitsize,
+                          threadinfo->numoftags - firsttag);
+
+  if (threadinfo->patterntab != NULL)
+  {
+    tgr_searchbatch(threadinfo,firsttag,numoftags);
+    return;
+  }
+  for (idx = firsttag; idx < firsttag + numoftags; idx++)
+  {
+    tgr_settag(threadinfo,threadinfo->tagtab + idx);
+    tgr_showtag(threadinfo->tageratoroptions,threadinfo->alpha,
+                threadinfo->firsttagnumber + idx,&threadinfo->twl);
+    threadinfo->storeoffline.nextfreeTgrSimplematch = 0;
+    threadinfo->storeonline.nextfreeTgrSimplematch = 0;
+    searchoverstrands(threadinfo->tageratoroptions,
+                      &threadinfo->twl,
+                      threadinfo->dfst,
+                      threadinfo->mor,
+                      threadinfo->limdfsresources,
+                      &threadinfo->showmatchinfo,
+                      &threadinfo->storeonline,
+                      &threadinfo->storeoffline);
+  }
+}
+
+#ifdef GT_THREADS_ENABLED
+static void *tgr_processunits(void *data)
+{
+  TgrThreadinfo *threadinfo = (TgrThreadinfo *) data;
+  GtUword numofunits = (threadinfo->numoftags + threadinfo->unitsize - 1)
+                       / threadinfo->unitsize;
+
+  while (true)
+  {
+    GtUword unit;
+
+    gt_mutex_lock(threadinfo->mutex);
+    unit = (*threadinfo->nextunit)++;
+    gt_mutex_unlock(threadinfo->mutex);
+    if (unit >= numofunits)
+    {
+      break;
+    }
+    tgr_processunit(threadinfo,unit);
+  }
+  return NULL;
+}
+#endif
+
+static void tgr_processchunk(TgrThreadinfo *threadinfotab,
+                             unsigned int numofthreads,
+                             TgrTagwithlength *tagtab,
+                             GtUword numoftags,
+                             uint64_t firsttagnumber)
+{
+  GtUword idx, unitsize = threadinfotab[0].unitsize;
+  unsigned int t;
+
+  for (t = 0; t < numofthreads; t++)
+  {
+    threadinfotab[t].tagtab = tagtab;
+    threadinfotab[t].numoftags = numoftags;
+    threadinfotab[t].firsttagnumber = firsttagnumber;
+  }
+#ifdef GT_THREADS_ENABLED
+  if (numofthreads > 1U && numoftags > unitsize)
+  {
+    GtUword nextunit = 0;
+    GtMutex *mutex = gt_mutex_new();
+
+    for (t = 0; t < numofthreads; t++)
+    {
+      threadinfotab[t].nextunit = &nextunit;
+      threadinfotab[t].mutex = mutex;
+    }
+    for (t = 1U; t < numofthreads; t++)
+    {
+      threadinfotab[t].thread = gt_thread_new(tgr_processunits,
+                                              threadinfotab + t,NULL);
+      gt_assert(threadinfotab[t].thread != NULL);
+    }
+    (void) tgr_processunits(threadinfotab);
+    for (t = 1U; t < numofthreads; t++)
+    {
+      gt_thread_join(threadinfotab[t].thread);
+      gt_thread_delete(threadinfotab[t].thread);
+    }
+    gt_mutex_delete(mutex);
+  } else
+#endif
+  {
+    for (idx = 0; idx * unitsize < numoftags; idx++)
+    {
+      tgr_processunit(threadinfotab,idx);
+    }
+  }
+  for (idx = 0; idx < numoftags; idx++)
+  {
+    gt_xfwrite(gt_str_get(tagtab[idx].outbuf),sizeof (char),
+               (size_t) gt_str_length(tagtab[idx].outbuf),stdout);
+    gt_str_reset(tagtab[idx].outbuf);
+  }
+}
+
+static void tgr_threadinfo_init(TgrThreadinfo *threadinfo,
+                                const TageratorOptions *tageratoroptions,
+                                const AbstractDfstransformer *dfst,
+                                Genericindex *genericindex,
+                                const GtEncseq *encseq,
+                                GtUword unitsize)
+{
+  const GtAlphabet *alpha = gt_encseq_alphabet(encseq);
+  unsigned int numofchars = gt_alphabet_num_of_chars(alpha);
+  ProcessIdxMatch processmatch;
+  void *processmatchinfoonline, *processmatchinfooffline;
+
+  threadinfo->tageratoroptions = tageratoroptions;
+  threadinfo->dfst = dfst;
+  threadinfo->alpha = alpha;
+  threadinfo->unitsize = unitsize;
+  threadinfo->twl.outbuf = NULL;
+  GT_INITARRAY(&threadinfo->storeonline,TgrSimplematch);
+  GT_INITARRAY(&threadinfo->storeoffline,TgrSimplematch);
+  threadinfo->storeonline.twlptr = threadinfo->storeoffline.twlptr
+                                 = &threadinfo->twl;
+  if (tageratoroptions->docompare)
+  {
+    processmatch = tgr_storematch;
+    processmatchinfoonline = &threadinfo->storeonline;
+    processmatchinfooffline = &threadinfo->storeoffline;
+    threadinfo->showmatchinfo.eqsvector = NULL;
+    threadinfo->showmatchinfo.encseq = encseq;
+  } else
+  {
+    TgrShowmatchinfo *showmatchinfo = &threadinfo->showmatchinfo;
+
+    processmatch = tgr_showmatch;
+    showmatchinfo->twlptr = &threadinfo->twl;
+    showmatchinfo->tageratoroptions = tageratoroptions;
+    showmatchinfo->alphasize = numofchars;
+    showmatchinfo->alpha = alpha;
+    showmatchinfo->eqsvector = gt_malloc(sizeof (*showmatchinfo->eqsvector) *
+                                         showmatchinfo->alphasize);
+    showmatchinfo->encseq = encseq;
+    processmatchinfooffline = showmatchinfo;
+    processmatchinfoonline = showmatchinfo;
+  }
+  threadinfo->mor = NULL;
+  if (tageratoroptions->doonline || tageratoroptions->docompare)
+  {
+    threadinfo->mor = gt_newMyersonlineresources(numofchars,
+                                                 tageratoroptions->nowildcards,
+                                                 encseq,
+                                                 processmatch,
+                                                 processmatchinfoonline);
+  }
+  threadinfo->limdfsresources = NULL;
+  if (!tageratoroptions->doonline || tageratoroptions->docompare)
+  {
+    GtUword maxpathlength;
+
+    if (tageratoroptions->userdefinedmaxdistance >= 0)
+    {
+      maxpathlength = (GtUword) (1+ MAXTAGSIZE +
+                                       tageratoroptions->
+                                       userdefinedmaxdistance);
+    } else
+    {
+      maxpathlength = (GtUword) (1+MAXTAGSIZE);
+    }
+    threadinfo->limdfsresources
+      = gt_newLimdfsresources(genericindex,
+                              tageratoroptions->nowildcards,
+                              tageratoroptions->maxintervalwidth,
+                              maxpathlength,
+                              false, /* keepexpandedonstack */
+                              processmatch,
+                              processmatchinfooffline,
+                              tageratoroptions->docompare
+                                ? checkmstats
+                                : showmstats,
+                              &threadinfo->twl, /* refer to uninit struct */
+                              dfst);
+  }
+  if (tageratoroptions->batchsize > 0)
+  {
+    gt_assert(threadinfo->limdfsresources != NULL &&
+              gt_indexbasedexactpatternmatching_hasbatch(
+                                               threadinfo->limdfsresources));
+    threadinfo->patterntab = gt_malloc(sizeof (*threadinfo->patterntab) * 2 *
+                                       tageratoroptions->batchsize);
+    threadinfo->patternlentab
+      = gt_malloc(sizeof (*threadinfo->patternlentab) * 2 *
+                  tageratoroptions->batchsize);
+    threadinfo->boundtab = gt_malloc(sizeof (*threadinfo->boundtab) * 2 *
+                                     tageratoroptions->batchsize);
+  } else
+  {
+    threadinfo->patterntab = NULL;
+    threadinfo->patternlentab = NULL;
+    threadinfo->boundtab = NULL;
+  }
+}
+
+static void tgr_threadinfo_delete(TgrThreadinfo *threadinfo)
+{
+  gt_free(threadinfo->patterntab);
+  gt_free(threadinfo->patternlentab);
+  gt_free(threadinfo->boundtab);
+  GT_FREEARRAY(&threadinfo->storeonline,TgrSimplematch);
+  GT_FREEARRAY(&threadinfo->storeoffline,TgrSimplematch);
+  gt_free(threadinfo->showmatchinfo.eqsvector);
+  if (threadinfo->limdfsresources != NULL)
+  {
+    gt_freeLimdfsresources(&threadinfo->limdfsresources,threadinfo->dfst);
+  }
+  gt_freeMyersonlineresources(threadinfo->mor);
+  genericindex_delete(threadinfo->genericindexview);
+}
+
 int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
 {
-  bool haserr = false, firstitem;
+  bool haserr = false;
   int retval;
-  Myersonlineresources *mor = NULL;
   Genericindex *genericindex = NULL;
   const GtEncseq *encseq = NULL;
   GtLogger *logger;
@@ -583,19 +943,15 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
   }
   if (!haserr)
   {
-    TgrTagwithlength twl;
-    uint64_t tagnumber;
-    unsigned int numofchars;
+    TgrThreadinfo *threadinfotab;
+    TgrTagwithlength *tagtab, *twl;
+    uint64_t tagnumber, firsttagnumber = 0;
     const GtUchar *symbolmap, *currenttag;
     char *desc = NULL;
-    ProcessIdxMatch processmatch;
-    TgrShowmatchinfo showmatchinfo;
-    void *processmatchinfoonline, *processmatchinfooffline;
-    Limdfsresources *limdfsresources = NULL;
-    const GtAlphabet *alpha;
-    ArrayTgrSimplematch storeonline, storeoffline;
     const AbstractDfstransformer *dfst;
     GtSeqIterator *seqit = NULL;
+    GtUword idx, unitsize, maxtags, numoftags = 0;
+    unsigned int t, numofthreads = gt_jobs;
 
     if (tageratoroptions->userdefinedmaxdistance >= 0)
     {
@@ -604,66 +960,30 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
     {
       dfst = gt_pms_AbstractDfstransformer();
     }
-    GT_INITARRAY(&storeonline,TgrSimplematch);
-    GT_INITARRAY(&storeoffline,TgrSimplematch);
-    storeonline.twlptr = storeoffline.twlptr = &twl;
-    alpha = gt_encseq_alphabet(encseq);
-    symbolmap = gt_alphabet_symbolmap(alpha);
-    numofchars = gt_alphabet_num_of_chars(alpha);
-    if (tageratoroptions->docompare)
-    {
-      processmatch = tgr_storematch;
-      processmatchinfoonline = &storeonline;
-      processmatchinfooffline = &storeoffline;
-      showmatchinfo.eqsvector = NULL;
-      showmatchinfo.encseq = encseq;
-    } else
-    {
-      processmatch = tgr_showmatch;
-      showmatchinfo.twlptr = &twl;
-      showmatchinfo.tageratoroptions = tageratoroptions;
-      showmatchinfo.alphasize = (unsigned int) numofchars;
-      showmatchinfo.alpha = alpha;
-      showmatchinfo.eqsvector = gt_malloc(sizeof (*showmatchinfo.eqsvector) *
-                                          showmatchinfo.alphasize);
-      showmatchinfo.encseq = encseq;
-      processmatchinfooffline = &showmatchinfo;
-      processmatchinfoonline = &showmatchinfo;
-    }
-    if (tageratoroptions->doonline || tageratoroptions->docompare)
-    {
-      gt_assert(encseq != NULL);
-      mor = gt_newMyersonlineresources(numofchars,
-                                    tageratoroptions->nowildcards,
-                                    encseq,
-                                    processmatch,
-                                    processmatchinfoonline);
-    }
-    if (!tageratoroptions->doonline || tageratoroptions->docompare)
+    symbolmap = gt_alphabet_symbolmap(gt_encseq_alphabet(encseq));
+    unitsize = tageratoroptions->batchsize > 0 ? tageratoroptions->batchsize
+                                               : 1UL;
+    maxtags = numofthreads == 1U
+                ? unitsize
+                : unitsize * numofthreads * TGR_UNITS_PER_THREAD;
+    threadinfotab = gt_malloc(sizeof (*threadinfotab) * numofthreads);
+    for (t = 0; t < numofthreads; t++)
     {
-      GtUword maxpathlength;
-
-      if (tageratoroptions->userdefinedmaxdistance >= 0)
-      {
-        maxpathlength = (GtUword) (1+ MAXTAGSIZE +
-                                         tageratoroptions->
-                                         userdefinedmaxdistance);
-      } else
+      threadinfotab[t].genericindexview = NULL;
+      if (t > 0 && genericindex != NULL)
       {
-        maxpathlength = (GtUword) (1+MAXTAGSIZE);
+        threadinfotab[t].genericindexview
+          = genericindex_new_view(genericindex);
       }
-      limdfsresources = gt_newLimdfsresources(genericindex,
-                                           tageratoroptions->nowildcards,
-                                           tageratoroptions->maxintervalwidth,
-                                           maxpathlength,
-                                           false, /* keepexpandedonstack */
-                                           processmatch,
-                                           processmatchinfooffline,
-                                           tageratoroptions->docompare
-                                             ? checkmstats
-                                             : showmstats,
-                                           &twl, /* refer to uninit structure */
-                                           dfst);
+      tgr_threadinfo_init(threadinfotab + t,tageratoroptions,dfst,
+                          t == 0 ? genericindex
+                                 : threadinfotab[t].genericindexview,
+                          encseq,unitsize);
+    }
+    tagtab = gt_malloc(sizeof (*tagtab) * maxtags);
+    for (idx = 0; idx < maxtags; idx++)
+    {
+      tagtab[idx].outbuf = gt_str_new();
     }
     printf("# for each match show: ");
     gt_getsetargmodekeywords(tageratoroptions->modedesc,
@@ -679,16 +999,17 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
     {
       for (tagnumber = 0; !haserr; tagnumber++)
       {
-        retval = gt_seq_iterator_next(seqit, &currenttag, &twl.taglen, &desc,
+        twl = tagtab + numoftags;
+        retval = gt_seq_iterator_next(seqit, &currenttag, &twl->taglen, &desc,
                                      err);
         if (retval != 1)
         {
           break;
         }
-        if (dotransformtag(twl.transformedtag,
+        if (dotransformtag(twl->transformedtag,
                            symbolmap,
                            currenttag,
-                           twl.taglen,
+                           twl->taglen,
                            tagnumber,
                            tageratoroptions->replacewildcard,
                            err) != 0)
@@ -696,67 +1017,59 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
           haserr = true;
           break;
         }
-        gt_copy_reverse_complement(twl.rctransformedtag,twl.transformedtag,
-                                   twl.taglen);
-        twl.tagptr = twl.transformedtag;
-        firstitem = true;
-        printf("#");
-        if (tageratoroptions->outputmode & TAGOUT_TAGNUM)
-        {
-          printf("\t" Formatuint64_t,PRINTuint64_tcast(tagnumber));
-          firstitem = false;
-        }
-        if (tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
-        {
-          ADDTABULATOR;
-          printf(""GT_WU"",twl.taglen);
-        }
-        if (tageratoroptions->outputmode & TAGOUT_TAGSEQ)
-        {
-          ADDTABULATOR;
-          gt_alphabet_decode_seq_to_fp(alpha,stdout,twl.transformedtag,
-                                       twl.taglen);
-        }
-        printf("\n");
-        storeoffline.nextfreeTgrSimplematch = 0;
-        storeonline.nextfreeTgrSimplematch = 0;
+        gt_copy_reverse_complement(twl->rctransformedtag,twl->transformedtag,
+                                   twl->taglen);
+        twl->tagptr = twl->transformedtag;
         if (tageratoroptions->userdefinedmaxdistance > 0 &&
-            twl.taglen <= (GtUword)
-                          tageratoroptions->userdefinedmaxdistance)
+            twl->taglen <= (GtUword)
+                           tageratoroptions->userdefinedmaxdistance)
         {
           gt_error_set(err,"tag \"%*.*s\" of length "GT_WU"; "
                        "tags must be longer than the allowed number of errors "
                        "(which is "GT_WD")",
-                       (int) twl.taglen,
-                       (int) twl.taglen,currenttag,
-                       twl.taglen,
+                       (int) twl->taglen,
+                       (int) twl->taglen,currenttag,
+                       twl->taglen,
                        tageratoroptions->userdefinedmaxdistance);
+          /* the tag itself is shown before the error is reported */
+          tgr_processchunk(threadinfotab,numofthreads,tagtab,numoftags,
+                           firsttagnumber);
+          tgr_showtag(tageratoroptions,threadinfotab[0].alpha,tagnumber,twl);
+          gt_xfwrite(gt_str_get(twl->outbuf),sizeof (char),
+                     (size_t) gt_str_length(twl->outbuf),stdout);
+          numoftags = 0;
           haserr = true;
           break;
         }
         gt_assert(tageratoroptions->userdefinedmaxdistance < 0 ||
-                  twl.taglen > (GtUword)
-                               tageratoroptions->userdefinedmaxdistance);
-        searchoverstrands(tageratoroptions,
-                          &twl,
-                          dfst,
-                          mor,
-                          limdfsresources,
-                          &showmatchinfo,
-                          &storeonline,
-                          &storeoffline);
+                  twl->taglen > (GtUword)
+                                tageratoroptions->userdefinedmaxdistance);
+        if (++numoftags == maxtags)
+        {
+          tgr_processchunk(threadinfotab,numofthreads,tagtab,numoftags,
+                           firsttagnumber);
+          firsttagnumber += numoftags;
+          numoftags = 0;
+        }
+      }
+      if (numoftags > 0)
+      {
+        tgr_processchunk(threadinfotab,numofthreads,tagtab,numoftags,
+                         firsttagnumber);
       }
       gt_seq_iterator_delete(seqit);
     }
-    GT_FREEARRAY(&storeonline,TgrSimplematch);
-    GT_FREEARRAY(&storeoffline,TgrSimplematch);
-    gt_free(showmatchinfo.eqsvector);
-    if (limdfsresources != NULL)
+    for (idx = 0; idx < maxtags; idx++)
+    {
+      gt_str_delete(tagtab[idx].outbuf);
+    }
+    gt_free(tagtab);
+    for (t = 0; t < numofthreads; t++)
     {
-      gt_freeLimdfsresources(&limdfsresources,dfst);
+      tgr_threadinfo_delete(threadinfotab + t);
     }
+    gt_free(threadinfotab);
   }
-  gt_freeMyersonlineresources(mor);
   if (genericindex == NULL)
   {
     if (encseq != NULL)
@@ -20,6 +20,7 @@
 #include "core/defined-types.h"
 #include "core/divmodmul.h"
 #include "core/fa.h"
+#include "core/fileutils_api.h"
 #include "core/intbits.h"
 #include "core/mathsupport.h"
 #include "core/minmax.h"
@@ -397,6 +398,11 @@ int gt_constructmerbuckets(const char *inputindex,
   return haserr ? -1 : 0;
 }
 
+bool gt_tyrbckinfo_exists(const char *tyrindexname)
+{
+  return gt_file_exists_with_suffix(tyrindexname,BUCKETSUFFIX);
+}
+
 Tyrbckinfo *gt_tyrbckinfo_new(const char *tyrindexname,unsigned int alphasize,
                               GtError *err)
 {
@@ -453,3 +459,15 @@ void gt_tyrbckinfo_delete(Tyrbckinfo **tyrbckinfoptr)
   gt_free(tyrbckinfo);
   *tyrbckinfoptr = NULL;
 }
+
+unsigned int gt_tyrbckinfo_prefixlength(const Tyrbckinfo *tyrbckinfo)
+{
+  gt_assert(tyrbckinfo != NULL);
+  return tyrbckinfo->prefixlength;
+}
+
+const GtUword *gt_tyrbckinfo_bounds(const Tyrbckinfo *tyrbckinfo)
+{
+  gt_assert(tyrbckinfo != NULL);
+  return tyrbckinfo->bounds;
+}
@@ -29,11 +29,21 @@ int gt_constructmerbuckets(const char *inputindex,
                            const Definedunsignedint *callprefixlength,
                            GtError *err);
 
+/* Returns true if the bucket boundaries of the index <tyrindexname> were
+   constructed by option -pl of gt tallymer mkindex. */
+bool gt_tyrbckinfo_exists(const char *tyrindexname);
+
 Tyrbckinfo *gt_tyrbckinfo_new(const char *tyrindexname,unsigned int alphasize,
                               GtError *err);
 
 void gt_tyrbckinfo_delete(Tyrbckinfo **tyrbckinfoptr);
 
+unsigned int gt_tyrbckinfo_prefixlength(const Tyrbckinfo *tyrbckinfo);
+
+/* the mers with prefix code <c> occupy the bytes
+   [bounds[c],bounds[c+1]) of the mer table */
+const GtUword *gt_tyrbckinfo_bounds(const Tyrbckinfo *tyrbckinfo);
+
 const GtUchar *gt_searchinbuckets(const Tyrindex *tyrindex,
                                   const Tyrbckinfo *tyrbckinfo,
                                   const GtUchar *bytecode);
@@ -17,15 +17,20 @@
 
 #include <errno.h>
 #include "core/alphabet.h"
+#include "core/chardef.h"
 #include "core/divmodmul.h"
 #include "core/fa.h"
 #include "core/format64.h"
 #include "core/logger.h"
+#include "core/minmax.h"
+#include "core/multithread_api.h"
+#include "core/radix_sort.h"
 #include "core/spacecalc.h"
 #include "core/str.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "core/ma_api.h"
+#include "core/intbits.h"
 #include "esa-seqread.h"
 #include "esa-mmsearch.h"
 #include "tyr-basic.h"
@@ -193,28 +198,29 @@ static void showListUlong(const GtEncseq *encseq,
   }
 }
 
-static bool decideifocc(const TyrDfsstate *state,GtUword countocc)
+static bool decideifoccinrange(GtUword minocc,GtUword maxocc,
+                               GtUword countocc)
 {
-  if (state->minocc > 0)
+  if (minocc > 0)
   {
-    if (state->maxocc > 0)
+    if (maxocc > 0)
     {
-      if (countocc >= state->minocc && countocc <= state->maxocc)
+      if (countocc >= minocc && countocc <= maxocc)
       {
         return true;
       }
     } else
     {
-      if (countocc >= state->minocc)
+      if (countocc >= minocc)
       {
         return true;
       }
     }
   } else
   {
-    if (state->maxocc > 0)
+    if (maxocc > 0)
     {
-      if (countocc <= state->maxocc)
+      if (countocc <= maxocc)
       {
         return true;
       }
@@ -223,6 +229,11 @@ static bool decideifocc(const TyrDfsstate *state,GtUword countocc)
   return false;
 }
 
+static bool decideifocc(const TyrDfsstate *state,GtUword countocc)
+{
+  return decideifoccinrange(state->minocc,state->maxocc,countocc);
+}
+
 static uint64_t addupdistribution(const GtArrayCountwithpositions *distribution)
 {
   GtUword idx;
@@ -344,19 +355,14 @@ static int adddistpos2distribution(GtUword countocc,
 
 #define MAXSMALLMERCOUNT UCHAR_MAX
 
-static int outputsortedstring2indexviafileptr(const GtEncseq *encseq,
-                                              GtUword mersize,
-                                              GtUchar *bytebuffer,
-                                              GtUword sizeofbuffer,
-                                              FILE *merindexfpout,
-                                              FILE *countsfilefpout,
-                                              GtUword position,
-                                              GtUword countocc,
-                                              GtArrayLargecount *largecounts,
-                                              GtUword countoutputmers,
-                                              GT_UNUSED GtError *err)
+static void outputbytecode2index(const GtUchar *bytebuffer,
+                                 GtUword sizeofbuffer,
+                                 FILE *merindexfpout,
+                                 FILE *countsfilefpout,
+                                 GtUword countocc,
+                                 GtArrayLargecount *largecounts,
+                                 GtUword countoutputmers)
 {
-  gt_encseq_sequence2bytecode(bytebuffer,encseq,position,mersize);
   gt_xfwrite(bytebuffer, sizeof (*bytebuffer), (size_t) sizeofbuffer,
              merindexfpout);
   if (countsfilefpout != NULL)
@@ -377,6 +383,28 @@ static int outputsortedstring2indexviafileptr(const GtEncseq *encseq,
     }
     gt_xfwrite(&smallcount, sizeof (smallcount),(size_t) 1,countsfilefpout);
   }
+}
+
+static int outputsortedstring2indexviafileptr(const GtEncseq *encseq,
+                                              GtUword mersize,
+                                              GtUchar *bytebuffer,
+                                              GtUword sizeofbuffer,
+                                              FILE *merindexfpout,
+                                              FILE *countsfilefpout,
+                                              GtUword position,
+                                              GtUword countocc,
+                                              GtArrayLargecount *largecounts,
+                                              GtUword countoutputmers,
+                                              GT_UNUSED GtError *err)
+{
+  gt_encseq_sequence2bytecode(bytebuffer,encseq,position,mersize);
+  outputbytecode2index(bytebuffer,
+                       sizeofbuffer,
+                       merindexfpout,
+                       countsfilefpout,
+                       countocc,
+                       largecounts,
+                       countoutputmers);
   return 0;
 }
 
@@ -711,3 +739,391 @@ int gt_merstatistics(const char *inputindex,
   }
   return haserr ? -1 : 0;
 }
+
+/* The following functions count the mers directly in the encoded sequence,
+   without an enhanced suffix array. The codes of all mers not containing a
+   wildcard are collected and sorted by radixsort, which delivers them in the
+   same order as the depth first traversal of the enhanced suffix array.
+   Several threads scan disjoint ranges of the sequence. To limit the space
+   requirement, the codes are processed in parts consisting of consecutive
+   buckets of codes with the same prefix. */
+
+#define TYR_MAXBUCKETBITS 16U
+
+typedef struct
+{
+  const GtEncseq *encseq;
+  unsigned int mersize,
+               bucketshift;
+  GtUword startpos, /* the mers starting in [startpos,endpos) are scanned */
+          endpos,
+          *bucketcounts, /* filled when counting */
+          firstbucket, /* when collecting, the codes in buckets */
+          endbucket,   /* [firstbucket,endbucket) are stored in codes */
+          nextfreecode;
+  GtCodetype *codes;
+} TyrMercodescan;
+
+typedef struct
+{
+  TyrMercodescan *scans;
+  unsigned int numofscans,
+               nextscan;
+  GtMutex *mutex;
+} TyrMercodescanpool;
+
+/* The codes are computed by a rolling two bit encoding instead of a
+   <GtKmercodeiterator>, as the latter does not support mers of length
+   <GT_UNITSIN2BITENC>. */
+static void tyr_mercodescan(TyrMercodescan *scan)
+{
+  GtEncseqReader *esr;
+  GtCodetype code = 0, mask;
+  GtUword pos, validchars = 0;
+
+  if (scan->startpos >= scan->endpos)
+  {
+    return;
+  }
+  mask = scan->mersize == (unsigned int) GT_UNITSIN2BITENC
+           ? ~(GtCodetype) 0
+           : ((GtCodetype) 1 << GT_MULT2(scan->mersize)) - 1;
+  esr = gt_encseq_create_reader_with_readmode(scan->encseq,
+                                              GT_READMODE_FORWARD,
+                                              scan->startpos);
+  for (pos = scan->startpos; pos < scan->endpos + scan->mersize - 1; pos++)
+  {
+    GtUchar cc = gt_encseq_reader_next_encoded_char(esr);
+
+    if (ISSPECIAL(cc))
+    {
+      validchars = 0;
+      continue;
+    }
+    code = ((code << 2) | cc) & mask;
+    if (++validchars >= (GtUword) scan->mersize)
+    {
+      const GtUword bucket = (GtUword) (code >> scan->bucketshift);
+
+      if (scan->codes == NULL)
+      {
+        scan->bucketcounts[bucket]++;
+      } else
+      {
+        if (bucket >= scan->firstbucket && bucket < scan->endbucket)
+        {
+          scan->codes[scan->nextfreecode++] = code;
+        }
+      }
+    }
+  }
+  gt_encseq_reader_delete(esr);
+}
+
+static void *tyr_mercodescanthread(void *data)
+{
+  TyrMercodescanpool *pool = (TyrMercodescanpool *) data;
+
+  while (true)
+  {
+    unsigned int scanidx;
+
+    gt_mutex_lock(pool->mutex);
+    scanidx = pool->nextscan++;
+    gt_mutex_unlock(pool->mutex);
+    if (scanidx >= pool->numofscans)
+    {
+      break;
+    }
+    tyr_mercodescan(pool->scans + scanidx);
+  }
+  return NULL;
+}
+
+static int tyr_mercodescanall(TyrMercodescanpool *pool,GtError *err)
+{
+  pool->nextscan = 0;
+  return gt_multithread(tyr_mercodescanthread,pool,err);
+}
+
+static void tyr_code2bytecode(GtUchar *bytebuffer,
+                              GtUword sizeofbuffer,
+                              GtUword mersize,
+                              GtCodetype code)
+{
+  GtUword idx;
+
+  /* the first character occupies the two most significant bits */
+  code <<= GT_MULT2(GT_MULT4(sizeofbuffer) - mersize);
+  for (idx = 0; idx < sizeofbuffer; idx++)
+  {
+    bytebuffer[idx]
+      = (GtUchar) ((code >> GT_MULT8(sizeofbuffer - 1 - idx)) & UCHAR_MAX);
+  }
+}
+
+static int tyr_countmersinencseq(const GtEncseq *encseq,
+                                 const char *storeindex,
+                                 bool storecounts,
+                                 GtUword mersize,
+                                 GtUword minocc,
+                                 GtUword maxocc,
+                                 unsigned int numofparts,
+                                 GtLogger *logger,
+                                 GtError *err)
+{
+  TyrMercodescanpool pool;
+  GtArrayLargecount largecounts;
+  FILE *merindexfpout = NULL, *countsfilefpout = NULL;
+  GtUchar *bytebuffer;
+  GtCodetype *codes = NULL;
+  GtUword numofmerstarts, numofbuckets, bucket, firstbucket, numofmers = 0,
+          partsize, maxpartsize = 0, countoutputmers = 0, currentpart = 0,
+          *bucketsizes;
+  const GtUword sizeofbuffer = MERBYTES(mersize),
+                totallength = gt_encseq_total_length(encseq);
+  unsigned int idx, bucketbits;
+  bool haserr = false;
+
+  gt_error_check(err);
+  gt_assert(mersize <= (GtUword) GT_UNITSIN2BITENC && mersize <= totallength);
+  numofmerstarts = totallength - mersize + 1;
+  bucketbits = (unsigned int) MIN(GT_MULT2(mersize),
+                                  (GtUword) TYR_MAXBUCKETBITS);
+  numofbuckets = 1UL << bucketbits;
+  pool.numofscans = gt_jobs;
+  if ((GtUword) pool.numofscans > numofmerstarts)
+  {
+    pool.numofscans = (unsigned int) numofmerstarts;
+  }
+  pool.scans = gt_malloc(sizeof *pool.scans * pool.numofscans);
+  pool.mutex = gt_mutex_new();
+  for (idx = 0; idx < pool.numofscans; idx++)
+  {
+    TyrMercodescan *scan = pool.scans + idx;
+
+    scan->encseq = encseq;
+    scan->mersize = (unsigned int) mersize;
+    scan->bucketshift = (unsigned int) GT_MULT2(mersize) - bucketbits;
+    scan->startpos = (GtUword) (((GtUint64) numofmerstarts * idx)
+                                / pool.numofscans);
+    scan->endpos = (GtUword) (((GtUint64) numofmerstarts * (idx+1))
+                              / pool.numofscans);
+    scan->bucketcounts = gt_calloc((size_t) numofbuckets,
+                                   sizeof *scan->bucketcounts);
+    scan->codes = NULL;
+  }
+  gt_logger_log(logger,"count "GT_WU"-mers in "GT_WU" buckets using %u "
+                "threads",mersize,numofbuckets,pool.numofscans);
+  if (tyr_mercodescanall(&pool,err) != 0)
+  {
+    haserr = true;
+  }
+  bucketsizes = gt_calloc((size_t) numofbuckets,sizeof *bucketsizes);
+  if (!haserr)
+  {
+    for (bucket = 0; bucket < numofbuckets; bucket++)
+    {
+      for (idx = 0; idx < pool.numofscans; idx++)
+      {
+        bucketsizes[bucket] += pool.scans[idx].bucketcounts[bucket];
+      }
+      numofmers += bucketsizes[bucket];
+    }
+    /* determine the size of the largest part */
+    partsize = 0;
+    for (bucket = 0; bucket < numofbuckets; bucket++)
+    {
+      if (partsize > 0 && partsize + bucketsizes[bucket] >
+                          (numofmers - 1) / numofparts + 1)
+      {
+        maxpartsize = MAX(maxpartsize,partsize);
+        partsize = 0;
+      }
+      partsize += bucketsizes[bucket];
+    }
+    maxpartsize = MAX(maxpartsize,partsize);
+    gt_logger_log(logger,"number of "GT_WU"-mers in the sequences not "
+                  "containing a wildcard: "GT_WU,mersize,numofmers);
+    gt_logger_log(logger,"sort at most "GT_WU" codes at once",maxpartsize);
+    codes = gt_malloc(sizeof *codes * MAX(maxpartsize,1UL));
+    merindexfpout = gt_fa_fopen_with_suffix(storeindex,MERSUFFIX,"wb",err);
+    if (merindexfpout == NULL)
+    {
+      haserr = true;
+    }
+  }
+  if (!haserr && storecounts)
+  {
+    countsfilefpout = gt_fa_fopen_with_suffix(storeindex,COUNTSSUFFIX,"wb",
+                                              err);
+    if (countsfilefpout == NULL)
+    {
+      haserr = true;
+    }
+  }
+  bytebuffer = gt_malloc(sizeof *bytebuffer * sizeofbuffer);
+  GT_INITARRAY(&largecounts,Largecount);
+  for (firstbucket = 0; !haserr && firstbucket < numofbuckets;
+       firstbucket = bucket)
+  {
+    GtUword offset = 0, codeidx, runend;
+
+    partsize = 0;
+    for (bucket = firstbucket; bucket < numofbuckets; bucket++)
+    {
+      if (partsize > 0 && partsize + bucketsizes[bucket] >
+                          (numofmers - 1) / numofparts + 1)
+      {
+        break;
+      }
+      partsize += bucketsizes[bucket];
+    }
+    if (partsize == 0)
+    {
+      continue;
+    }
+    for (idx = 0; idx < pool.numofscans; idx++)
+    {
+      TyrMercodescan *scan = pool.scans + idx;
+      GtUword scanbucket;
+
+      scan->firstbucket = firstbucket;
+      scan->endbucket = bucket;
+      scan->codes = codes + offset;
+      scan->nextfreecode = 0;
+      for (scanbucket = firstbucket; scanbucket < bucket; scanbucket++)
+      {
+        offset += scan->bucketcounts[scanbucket];
+      }
+    }
+    gt_assert(offset == partsize);
+    gt_logger_log(logger,"part "GT_WU": buckets "GT_WU".."GT_WU" with "GT_WU
+                  " codes",currentpart++,firstbucket,bucket-1,partsize);
+    if (tyr_mercodescanall(&pool,err) != 0)
+    {
+      haserr = true;
+      break;
+    }
+    gt_radixsort_inplace_ulong(codes,partsize);
+    for (codeidx = 0; codeidx < partsize; codeidx = runend)
+    {
+      for (runend = codeidx + 1;
+           runend < partsize && codes[runend] == codes[codeidx]; runend++)
+        /* Nothing */ ;
+      if (decideifoccinrange(minocc,maxocc,runend - codeidx))
+      {
+        tyr_code2bytecode(bytebuffer,sizeofbuffer,mersize,codes[codeidx]);
+        outputbytecode2index(bytebuffer,
+                             sizeofbuffer,
+                             merindexfpout,
+                             countsfilefpout,
+                             runend - codeidx,
+                             &largecounts,
+                             countoutputmers);
+        countoutputmers++;
+      }
+    }
+  }
+  if (!haserr)
+  {
+    if (countsfilefpout != NULL)
+    {
+      gt_logger_log(logger,"write "GT_WU" mercounts > "GT_WU
+                    " to file \"%s%s\"",
+                    largecounts.nextfreeLargecount,
+                    (GtUword) MAXSMALLMERCOUNT,
+                    storeindex,
+                    COUNTSSUFFIX);
+      gt_xfwrite(largecounts.spaceLargecount, sizeof (Largecount),
+                 (size_t) largecounts.nextfreeLargecount,
+                 countsfilefpout);
+    }
+    gt_logger_log(logger,"number of "GT_WU"-mers in index: "GT_WU"",
+                  mersize,
+                  countoutputmers);
+    gt_logger_log(logger,"index size: %.2f megabytes\n",
+                  GT_MEGABYTES(countoutputmers * sizeofbuffer +
+                               sizeof (GtUword) * EXTRAINTEGERS));
+    outputbytewiseUlongvalue(merindexfpout,mersize);
+    outputbytewiseUlongvalue(merindexfpout,
+                             (GtUword) gt_alphabet_num_of_chars(
+                                              gt_encseq_alphabet(encseq)));
+  }
+  gt_fa_xfclose(merindexfpout);
+  gt_fa_xfclose(countsfilefpout);
+  GT_FREEARRAY(&largecounts,Largecount);
+  gt_free(bytebuffer);
+  gt_free(codes);
+  gt_free(bucketsizes);
+  for (idx = 0; idx < pool.numofscans; idx++)
+  {
+    gt_free(pool.scans[idx].bucketcounts);
+  }
+  gt_free(pool.scans);
+  gt_mutex_delete(pool.mutex);
+  return haserr ? -1 : 0;
+}
+
+int gt_merstatistics_encseq(const char *inputindex,
+                            GtUword mersize,
+                            GtUword minocc,
+                            GtUword maxocc,
+                            const char *storeindex,
+                            bool storecounts,
+                            unsigned int numofparts,
+                            GtLogger *logger,
+                            GtError *err)
+{
+  GtEncseqLoader *encseqloader;
+  GtEncseq *encseq;
+  bool haserr = false;
+
+  gt_error_check(err);
+  gt_assert(numofparts > 0 && strlen(storeindex) > 0);
+  encseqloader = gt_encseq_loader_new();
+  gt_encseq_loader_do_not_require_des_tab(encseqloader);
+  gt_encseq_loader_do_not_require_sds_tab(encseqloader);
+  gt_encseq_loader_do_not_require_ssp_tab(encseqloader);
+  gt_encseq_loader_set_logger(encseqloader,logger);
+  encseq = gt_encseq_loader_load(encseqloader,inputindex,err);
+  gt_encseq_loader_delete(encseqloader);
+  if (encseq == NULL)
+  {
+    haserr = true;
+  }
+  if (!haserr &&
+      gt_alphabet_num_of_chars(gt_encseq_alphabet(encseq)) != 4U)
+  {
+    gt_error_set(err,"counting mers in an encoded sequence requires a DNA "
+                     "sequence");
+    haserr = true;
+  }
+  if (!haserr && mersize > (GtUword) GT_UNITSIN2BITENC)
+  {
+    gt_error_set(err,"counting mers in an encoded sequence requires mersize "
+                     "<= %u",(unsigned int) GT_UNITSIN2BITENC);
+    haserr = true;
+  }
+  if (!haserr && mersize > gt_encseq_total_length(encseq))
+  {
+    gt_error_set(err,"mersize "GT_WU" > "GT_WU" = totallength not allowed",
+                 mersize,
+                 gt_encseq_total_length(encseq));
+    haserr = true;
+  }
+  if (!haserr && tyr_countmersinencseq(encseq,
+                                       storeindex,
+                                       storecounts,
+                                       mersize,
+                                       minocc,
+                                       maxocc,
+                                       numofparts,
+                                       logger,
+                                       err) != 0)
+  {
+    haserr = true;
+  }
+  gt_encseq_delete(encseq);
+  return haserr ? -1 : 0;
+}
@@ -34,4 +34,19 @@ int gt_merstatistics(const char *inputindex,
                      GtLogger *logger,
                      GtError *err);
 
+/* Like <gt_merstatistics()>, but counts the mers directly in the encoded
+   sequence <inputindex> using <gt_jobs> threads, instead of traversing an
+   enhanced suffix array. Only storing an index is supported. The codes of the
+   mers are sorted in <numofparts> parts, reducing the space peak accordingly.
+   Requires a DNA sequence and <mersize> <= <GT_UNITSIN2BITENC>. */
+int gt_merstatistics_encseq(const char *inputindex,
+                            GtUword mersize,
+                            GtUword minocc,
+                            GtUword maxocc,
+                            const char *storeindex,
+                            bool storecounts,
+                            unsigned int numofparts,
+                            GtLogger *logger,
+                            GtError *err);
+
 #endif
@@ -14,34 +14,84 @@
   ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
-
+#include <string.h>
 #include "core/alphabet.h"
+#include "core/arraydef.h"
 #include "core/fa.h"
+#include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/chardef.h"
+#include "core/divmodmul.h"
 #include "core/format64.h"
 #include "core/encseq.h"
+#include "core/intbits.h"
 #include "core/ma_api.h"
+#include "core/minmax.h"
+#include "core/multithread_api.h"
+#include "core/thread_api.h"
+#include "core/xansi_api.h"
 #include "revcompl.h"
 #include "tyr-map.h"
 #include "tyr-search.h"
 #include "tyr-show.h"
 #include "tyr-mersplit.h"
 
+/* number of binary searches advanced in lockstep */
+#define TYR_SEARCHINTERLEAVE   16U
+/* number of mers of a query collected before they are searched */
+#define TYR_SEARCHWINDOW       4096UL
+/* queries are processed in blocks of about this many symbols by
+   one thread, the output of a block is buffered */
+#define TYR_SEARCHBLOCKLENGTH  (1UL << 16)
+/* number of blocks read before they are processed */
+#define TYR_SEARCHCHUNKBLOCKS  64UL
+
+#ifdef __GNUC__
+#define TYR_PREFETCH(PTR) __builtin_prefetch(PTR,0,0)
+#else
+#define TYR_PREFETCH(PTR) (void) (PTR)
+#endif
+
 typedef struct
 {
   GtUchar *bytecode,  /* buffer for encoded word to be searched */
         *rcbuf;
   const GtUchar *mertable, *lastmer;
-  GtUword mersize;
+  const GtUword *bounds;
+  GtUword mersize,
+          merbytes,
+          prefixshift; /* right shift of a key delivering its bucket */
   unsigned int showmode,
                searchstrand;
+  bool batched;
   GtAlphabet *dnaalpha;
 } Tyrsearchinfo;
 
+typedef struct
+{
+  GtUword key,       /* code of the mer, left aligned to <merbytes> bytes */
+          qpos,
+          mernumber; /* <GT_UNDEF_UWORD> if the mer does not occur */
+  bool forward;
+} Tyrmerquery;
+
+typedef struct
+{
+  const Tyrcountinfo *tyrcountinfo;
+  const Tyrsearchinfo *tyrsearchinfo;
+  GtArrayGtUchar sequences;   /* the queries of the chunk, concatenated */
+  GtArrayGtUword seqstarts,   /* start of each query in <sequences> */
+                 blockstarts; /* first query of each block */
+  GtStr **blockoutput;
+  uint64_t firstunitnum;
+  GtUword nextblock;
+  GtMutex *mutex;
+} Tyrsearchchunk;
+
 static void gt_tyrsearchinfo_init(Tyrsearchinfo *tyrsearchinfo,
                                const Tyrindex *tyrindex,
+                               const Tyrbckinfo *tyrbckinfo,
                                unsigned int showmode,
                                unsigned int searchstrand)
 {
@@ -49,10 +99,28 @@ static void gt_tyrsearchinfo_init(Tyrsearchinfo *tyrsearchinfo,
 
   merbytes = gt_tyrindex_merbytes(tyrindex);
   tyrsearchinfo->mersize = gt_tyrindex_mersize(tyrindex);
+  tyrsearchinfo->merbytes = merbytes;
   tyrsearchinfo->mertable = gt_tyrindex_mertable(tyrindex);
   tyrsearchinfo->lastmer = gt_tyrindex_lastmer(tyrindex);
   tyrsearchinfo->showmode = showmode;
   tyrsearchinfo->searchstrand = searchstrand;
+  /* the bucket boundaries are only available for a non-empty index built
+     with option -pl, mers fitting into a word are then searched in
+     batches */
+  if (tyrbckinfo != NULL &&
+      tyrsearchinfo->mersize <= (GtUword) GT_UNITSIN2BITENC)
+  {
+    tyrsearchinfo->batched = true;
+    tyrsearchinfo->bounds = gt_tyrbckinfo_bounds(tyrbckinfo);
+    tyrsearchinfo->prefixshift
+      = GT_MULT8(merbytes) -
+        GT_MULT2((GtUword) gt_tyrbckinfo_prefixlength(tyrbckinfo));
+  } else
+  {
+    tyrsearchinfo->batched = false;
+    tyrsearchinfo->bounds = NULL;
+    tyrsearchinfo->prefixshift = 0;
+  }
   tyrsearchinfo->dnaalpha = gt_alphabet_new_dna();
   tyrsearchinfo->bytecode = gt_malloc(sizeof *tyrsearchinfo->bytecode
                                       * merbytes);
@@ -97,53 +165,66 @@ static void gt_tyrsearchinfo_delete(Tyrsearchinfo *tyrsearchinfo)
           firstitem = false;\
         } else\
         {\
-          (void) putchar('\t');\
+          gt_str_append_char(outbuf,'\t');\
         }
 
-static void mermatchoutput(const Tyrindex *tyrindex,
+static void mermatchoutput(GtStr *outbuf,
                            const Tyrcountinfo *tyrcountinfo,
                            const Tyrsearchinfo *tyrsearchinfo,
-                           const GtUchar *result,
-                           const GtUchar *query,
+                           GtUword mernumber,
                            const GtUchar *qptr,
+                           GtUword queryposition,
                            uint64_t unitnum,
                            bool forward)
 {
   bool firstitem = true;
-  GtUword queryposition;
 
-  queryposition = (GtUword) (qptr-query);
   if (tyrsearchinfo->showmode & SHOWQSEQNUM)
   {
-    printf(Formatuint64_t,PRINTuint64_tcast(unitnum));
+    char numbuf[32];
+
+    (void) snprintf(numbuf,sizeof numbuf,Formatuint64_t,
+                    PRINTuint64_tcast(unitnum));
+    gt_str_append_cstr(outbuf,numbuf);
     firstitem = false;
   }
   if (tyrsearchinfo->showmode & SHOWQPOS)
   {
     ADDTABULATOR;
-    printf("%c"GT_WU"",forward ? '+' : '-',queryposition);
+    gt_str_append_char(outbuf,forward ? '+' : '-');
+    gt_str_append_uword(outbuf,queryposition);
   }
   if (tyrsearchinfo->showmode & SHOWCOUNTS)
   {
-    GtUword mernumber = gt_tyrindex_ptr2number(tyrindex,result);
     ADDTABULATOR;
-    printf(""GT_WU"",gt_tyrcountinfo_get(tyrcountinfo,mernumber));
+    gt_str_append_uword(outbuf,gt_tyrcountinfo_get(tyrcountinfo,mernumber));
   }
   if (tyrsearchinfo->showmode & SHOWSEQUENCE)
   {
     ADDTABULATOR;
-    gt_alphabet_decode_seq_to_fp(tyrsearchinfo->dnaalpha,
-                                 stdout,
-                                 qptr,
-                                 tyrsearchinfo->mersize);
+    gt_alphabet_decode_seq_to_str_append(tyrsearchinfo->dnaalpha,
+                                         outbuf,
+                                         qptr,
+                                         tyrsearchinfo->mersize);
   }
   if (tyrsearchinfo->showmode & (SHOWSEQUENCE | SHOWQPOS | SHOWCOUNTS))
   {
-    (void) putchar('\n');
+    gt_str_append_char(outbuf,'\n');
+  }
+}
+
+static void tyr_flushoutput(GtStr *outbuf)
+{
+  if (gt_str_length(outbuf) > 0)
+  {
+    gt_xfwrite(gt_str_get(outbuf),sizeof (char),
+               (size_t) gt_str_length(outbuf),stdout);
+    gt_str_reset(outbuf);
   }
 }
 
-static void singleseqtyrsearch(const Tyrindex *tyrindex,
+static void singleseqtyrsearch(GtStr *outbuf,
+                               const Tyrindex *tyrindex,
                                const Tyrcountinfo *tyrcountinfo,
                                const Tyrsearchinfo *tyrsearchinfo,
                                const Tyrbckinfo *tyrbckinfo,
@@ -172,12 +253,12 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
         result = gt_searchsinglemer(qptr,tyrindex,tyrsearchinfo,tyrbckinfo);
         if (result != NULL)
         {
-          mermatchoutput(tyrindex,
+          mermatchoutput(outbuf,
                          tyrcountinfo,
                          tyrsearchinfo,
-                         result,
-                         query,
+                         gt_tyrindex_ptr2number(tyrindex,result),
                          qptr,
+                         (GtUword) (qptr-query),
                          unitnum,
                          true);
         }
@@ -191,12 +272,12 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
                                     tyrsearchinfo,tyrbckinfo);
         if (result != NULL)
         {
-          mermatchoutput(tyrindex,
+          mermatchoutput(outbuf,
                          tyrcountinfo,
                          tyrsearchinfo,
-                         result,
-                         query,
+                         gt_tyrindex_ptr2number(tyrindex,result),
                          qptr,
+                         (GtUword) (qptr-query),
                          unitnum,
                          false);
         }
@@ -210,6 +291,273 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
   }
 }
 
+static GtUword tyr_bytecode2key(const GtUchar *bytecode,GtUword merbytes)
+{
+  GtUword idx, key = 0;
+
+  for (idx = 0; idx < merbytes; idx++)
+  {
+    key = (key << 8) | (GtUword) bytecode[idx];
+  }
+  return key;
+}
+
+/* Search the mers in <merqueries>, <TYR_SEARCHINTERLEAVE> at a time: in each
+   round the middle elements of all searches still running are prefetched
+   before any of them is compared, so that the cache misses of the searches
+   overlap instead of being waited for one after the other. */
+static void tyr_interleavedsearch(Tyrmerquery *merqueries,
+                                  GtUword nummerqueries,
+                                  const Tyrsearchinfo *tyrsearchinfo)
+{
+  GtUword left[TYR_SEARCHINTERLEAVE],
+          right[TYR_SEARCHINTERLEAVE],
+          mid[TYR_SEARCHINTERLEAVE],
+          first, idx;
+  const GtUword merbytes = tyrsearchinfo->merbytes;
+  const GtUchar *mertable = tyrsearchinfo->mertable;
+
+  for (first = 0; first < nummerqueries; first += TYR_SEARCHINTERLEAVE)
+  {
+    Tyrmerquery *mq = merqueries + first;
+    const GtUword width = MIN(nummerqueries - first,
+                              (GtUword) TYR_SEARCHINTERLEAVE);
+    bool searching;
+
+    for (idx = 0; idx < width; idx++)
+    {
+      const GtUword prefixcode = mq[idx].key >> tyrsearchinfo->prefixshift;
+
+      left[idx] = tyrsearchinfo->bounds[prefixcode]/merbytes;
+      right[idx] = tyrsearchinfo->bounds[prefixcode+1]/merbytes;
+      mq[idx].mernumber = GT_UNDEF_UWORD;
+    }
+    do
+    {
+      searching = false;
+      for (idx = 0; idx < width; idx++)
+      {
+        if (left[idx] < right[idx])
+        {
+          mid[idx] = left[idx] + GT_DIV2(right[idx] - left[idx]);
+          TYR_PREFETCH(mertable + mid[idx] * merbytes);
+          searching = true;
+        }
+      }
+      for (idx = 0; idx < width; idx++)
+      {
+        if (left[idx] < right[idx])
+        {
+          const GtUword merkey
+            = tyr_bytecode2key(mertable + mid[idx] * merbytes,merbytes);
+
+          if (merkey < mq[idx].key)
+          {
+            left[idx] = mid[idx] + 1;
+          } else
+          {
+            if (merkey > mq[idx].key)
+            {
+              right[idx] = mid[idx];
+            } else
+            {
+              mq[idx].mernumber = mid[idx];
+              left[idx] = right[idx];
+            }
+          }
+        }
+      }
+    } while (searching);
+  }
+}
+
+static void tyr_outputmerqueries(GtStr *outbuf,
+                                 const Tyrcountinfo *tyrcountinfo,
+                                 const Tyrsearchinfo *tyrsearchinfo,
+                                 Tyrmerquery *merqueries,
+                                 GtUword nummerqueries,
+                                 uint64_t unitnum,
+                                 const GtUchar *query)
+{
+  GtUword idx;
+
+  tyr_interleavedsearch(merqueries,nummerqueries,tyrsearchinfo);
+  for (idx = 0; idx < nummerqueries; idx++)
+  {
+    if (merqueries[idx].mernumber != GT_UNDEF_UWORD)
+    {
+      mermatchoutput(outbuf,
+                     tyrcountinfo,
+                     tyrsearchinfo,
+                     merqueries[idx].mernumber,
+                     query + merqueries[idx].qpos,
+                     merqueries[idx].qpos,
+                     unitnum,
+                     merqueries[idx].forward);
+    }
+  }
+}
+
+/* The codes of the mers of <query> and of their reverse complements are
+   maintained while sliding over the query, instead of encoding each mer
+   separately. */
+static void batchseqtyrsearch(GtStr *outbuf,
+                              Tyrmerquery *merqueries,
+                              const Tyrcountinfo *tyrcountinfo,
+                              const Tyrsearchinfo *tyrsearchinfo,
+                              uint64_t unitnum,
+                              const GtUchar *query,
+                              GtUword querylen)
+{
+  const GtUword mersize = tyrsearchinfo->mersize,
+                leftshift = GT_MULT8(tyrsearchinfo->merbytes)
+                            - GT_MULT2(mersize),
+                rcshift = GT_MULT2(mersize - 1),
+                mask = mersize == (GtUword) GT_UNITSIN2BITENC
+                         ? ~(GtUword) 0
+                         : ((GtUword) 1 << GT_MULT2(mersize)) - 1;
+  GtUword pos, fwdcode = 0, rccode = 0, validchars = 0, nummerqueries = 0;
+
+  gt_assert(tyrsearchinfo->batched);
+  for (pos = 0; pos < querylen; pos++)
+  {
+    const GtUchar cc = query[pos];
+
+    if (ISSPECIAL(cc))
+    {
+      validchars = 0;
+      continue;
+    }
+    fwdcode = ((fwdcode << 2) | (GtUword) cc) & mask;
+    rccode = (rccode >> 2) | ((GtUword) (3 - cc) << rcshift);
+    if (++validchars >= mersize)
+    {
+      if (tyrsearchinfo->searchstrand & STRAND_FORWARD)
+      {
+        merqueries[nummerqueries].key = fwdcode << leftshift;
+        merqueries[nummerqueries].qpos = pos + 1 - mersize;
+        merqueries[nummerqueries++].forward = true;
+      }
+      if (tyrsearchinfo->searchstrand & STRAND_REVERSE)
+      {
+        merqueries[nummerqueries].key = rccode << leftshift;
+        merqueries[nummerqueries].qpos = pos + 1 - mersize;
+        merqueries[nummerqueries++].forward = false;
+      }
+      if (nummerqueries + 2 > TYR_SEARCHWINDOW)
+      {
+        tyr_outputmerqueries(outbuf,tyrcountinfo,tyrsearchinfo,merqueries,
+                             nummerqueries,unitnum,query);
+        nummerqueries = 0;
+      }
+    }
+  }
+  if (nummerqueries > 0)
+  {
+    tyr_outputmerqueries(outbuf,tyrcountinfo,tyrsearchinfo,merqueries,
+                         nummerqueries,unitnum,query);
+  }
+}
+
+static void *tyr_searchchunkthread(void *data)
+{
+  Tyrsearchchunk *chunk = (Tyrsearchchunk *) data;
+  Tyrmerquery *merqueries;
+  const GtUword numofblocks = chunk->blockstarts.nextfreeGtUword - 1;
+
+  merqueries = gt_malloc(sizeof *merqueries * TYR_SEARCHWINDOW);
+  while (true)
+  {
+    GtUword block, seqnum;
+
+    gt_mutex_lock(chunk->mutex);
+    block = chunk->nextblock++;
+    gt_mutex_unlock(chunk->mutex);
+    if (block >= numofblocks)
+    {
+      break;
+    }
+    for (seqnum = chunk->blockstarts.spaceGtUword[block];
+         seqnum < chunk->blockstarts.spaceGtUword[block+1]; seqnum++)
+    {
+      const GtUword start = chunk->seqstarts.spaceGtUword[seqnum];
+
+      batchseqtyrsearch(chunk->blockoutput[block],
+                        merqueries,
+                        chunk->tyrcountinfo,
+                        chunk->tyrsearchinfo,
+                        chunk->firstunitnum + seqnum,
+                        chunk->sequences.spaceGtUchar + start,
+                        chunk->seqstarts.spaceGtUword[seqnum+1] - start);
+    }
+  }
+  gt_free(merqueries);
+  return NULL;
+}
+
+/* Search the queries of <chunk> in parallel, output the matches in the order
+   of the queries and make <chunk> empty again. */
+static int tyr_searchchunk(Tyrsearchchunk *chunk,GtError *err)
+{
+  GtUword block, numofblocks;
+  int had_err = 0;
+
+  if (chunk->seqstarts.nextfreeGtUword == 0)
+  {
+    return 0;
+  }
+  GT_STOREINARRAY(&chunk->seqstarts,GtUword,128,
+                  chunk->sequences.nextfreeGtUchar);
+  if (chunk->blockstarts.spaceGtUword[chunk->blockstarts.nextfreeGtUword-1]
+      < chunk->seqstarts.nextfreeGtUword - 1)
+  {
+    GT_STOREINARRAY(&chunk->blockstarts,GtUword,16,
+                    chunk->seqstarts.nextfreeGtUword - 1);
+  }
+  numofblocks = chunk->blockstarts.nextfreeGtUword - 1;
+  chunk->nextblock = 0;
+  had_err = gt_multithread(tyr_searchchunkthread,chunk,err);
+  for (block = 0; block < numofblocks; block++)
+  {
+    if (!had_err)
+    {
+      tyr_flushoutput(chunk->blockoutput[block]);
+    }
+    gt_str_reset(chunk->blockoutput[block]);
+  }
+  chunk->firstunitnum += chunk->seqstarts.nextfreeGtUword - 1;
+  chunk->sequences.nextfreeGtUchar = 0;
+  chunk->seqstarts.nextfreeGtUword = 0;
+  chunk->blockstarts.nextfreeGtUword = 0;
+  GT_STOREINARRAY(&chunk->blockstarts,GtUword,16,0);
+  return had_err;
+}
+
+static int tyr_addtochunk(Tyrsearchchunk *chunk,const GtUchar *query,
+                          GtUword querylen,GtError *err)
+{
+  const GtUword blockstart
+    = chunk->blockstarts.spaceGtUword[chunk->blockstarts.nextfreeGtUword-1];
+
+  GT_STOREINARRAY(&chunk->seqstarts,GtUword,128,
+                  chunk->sequences.nextfreeGtUchar);
+  GT_CHECKARRAYSPACEMULTI(&chunk->sequences,GtUchar,querylen);
+  memcpy(chunk->sequences.spaceGtUchar + chunk->sequences.nextfreeGtUchar,
+         query,(size_t) querylen);
+  chunk->sequences.nextfreeGtUchar += querylen;
+  if (chunk->sequences.nextfreeGtUchar -
+      chunk->seqstarts.spaceGtUword[blockstart] >= TYR_SEARCHBLOCKLENGTH)
+  {
+    GT_STOREINARRAY(&chunk->blockstarts,GtUword,16,
+                    chunk->seqstarts.nextfreeGtUword);
+    if (chunk->blockstarts.nextfreeGtUword > TYR_SEARCHCHUNKBLOCKS)
+    {
+      return tyr_searchchunk(chunk,err);
+    }
+  }
+  return 0;
+}
+
 int gt_tyrsearch(const char *tyrindexname,
                  const GtStrArray *queryfilenames,
                  unsigned int showmode,
@@ -254,7 +602,8 @@ int gt_tyrsearch(const char *tyrindexname,
   if (!haserr)
   {
     gt_assert(tyrindex != NULL);
-    if (!gt_tyrindex_isempty(tyrindex))
+    /* without bucket boundaries each mer is searched in the whole index */
+    if (!gt_tyrindex_isempty(tyrindex) && gt_tyrbckinfo_exists(tyrindexname))
     {
       tyrbckinfo = gt_tyrbckinfo_new(tyrindexname,
                                      gt_tyrindex_alphasize(tyrindex),
@@ -273,10 +622,35 @@ int gt_tyrsearch(const char *tyrindexname,
     uint64_t unitnum;
     int retval;
     Tyrsearchinfo tyrsearchinfo;
+    Tyrsearchchunk chunk;
+    GtStr *outbuf = NULL;
     GtSeqIterator *seqit;
 
     gt_assert(tyrindex != NULL);
-    gt_tyrsearchinfo_init(&tyrsearchinfo,tyrindex,showmode,searchstrand);
+    gt_tyrsearchinfo_init(&tyrsearchinfo,tyrindex,tyrbckinfo,showmode,
+                          searchstrand);
+    if (tyrsearchinfo.batched)
+    {
+      GtUword block;
+
+      chunk.tyrcountinfo = tyrcountinfo;
+      chunk.tyrsearchinfo = &tyrsearchinfo;
+      GT_INITARRAY(&chunk.sequences,GtUchar);
+      GT_INITARRAY(&chunk.seqstarts,GtUword);
+      GT_INITARRAY(&chunk.blockstarts,GtUword);
+      GT_STOREINARRAY(&chunk.blockstarts,GtUword,16,0);
+      chunk.blockoutput = gt_malloc(sizeof *chunk.blockoutput
+                                    * (TYR_SEARCHCHUNKBLOCKS+1));
+      for (block = 0; block <= TYR_SEARCHCHUNKBLOCKS; block++)
+      {
+        chunk.blockoutput[block] = gt_str_new();
+      }
+      chunk.firstunitnum = 0;
+      chunk.mutex = gt_mutex_new();
+    } else
+    {
+      outbuf = gt_str_new();
+    }
     seqit = gt_seq_iterator_sequence_buffer_new(queryfilenames, err);
     if (!seqit)
       haserr = true;
@@ -300,17 +674,54 @@ int gt_tyrsearch(const char *tyrindexname,
         {
           break;
         }
-        singleseqtyrsearch(tyrindex,
-                           tyrcountinfo,
-                           &tyrsearchinfo,
-                           tyrbckinfo,
-                           unitnum,
-                           query,
-                           querylen,
-                           desc);
+        if (tyrsearchinfo.batched)
+        {
+          if (tyr_addtochunk(&chunk,query,querylen,err) != 0)
+          {
+            haserr = true;
+            break;
+          }
+        } else
+        {
+          if (!gt_tyrindex_isempty(tyrindex))
+          {
+            singleseqtyrsearch(outbuf,
+                               tyrindex,
+                               tyrcountinfo,
+                               &tyrsearchinfo,
+                               tyrbckinfo,
+                               unitnum,
+                               query,
+                               querylen,
+                               desc);
+            tyr_flushoutput(outbuf);
+          }
+        }
+      }
+      /* the matches in the queries read before an error are reported as
+         well */
+      if (tyrsearchinfo.batched &&
+          tyr_searchchunk(&chunk,haserr ? NULL : err) != 0)
+      {
+        haserr = true;
       }
       gt_seq_iterator_delete(seqit);
     }
+    if (tyrsearchinfo.batched)
+    {
+      GtUword block;
+
+      for (block = 0; block <= TYR_SEARCHCHUNKBLOCKS; block++)
+      {
+        gt_str_delete(chunk.blockoutput[block]);
+      }
+      gt_free(chunk.blockoutput);
+      GT_FREEARRAY(&chunk.sequences,GtUchar);
+      GT_FREEARRAY(&chunk.seqstarts,GtUword);
+      GT_FREEARRAY(&chunk.blockstarts,GtUword);
+      gt_mutex_delete(chunk.mutex);
+    }
+    gt_str_delete(outbuf);
     gt_tyrsearchinfo_delete(&tyrsearchinfo);
   }
   if (tyrbckinfo != NULL)
@@ -18,13 +18,17 @@
 #include "core/ma.h"
 #include "core/option_api.h"
 #include "core/output_file_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "extended/cds_stream_api.h"
+#include "extended/cds_visitor.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_in_stream.h"
 #include "extended/gff3_out_stream_api.h"
 #include "extended/gtdatahelp.h"
+#include "extended/parallel_visitor_stream.h"
 #include "extended/seqid2file.h"
+#include "extended/thread_stream.h"
 #include "tools/gt_cds.h"
 
 #define GT_CDS_SOURCE_TAG "gt cds"
@@ -34,6 +38,7 @@ typedef struct {
   bool start_codon,
        final_stop_codon,
        generic_start_codons,
+       pipeline,
        verbose;
   GtSeqid2FileInfo *s2fi;
   GtOutputFileInfo *ofi;
@@ -97,6 +102,12 @@ static GtOptionParser* gt_cds_option_parser_new(void *tool_arguments)
   /* -seqfile, -matchdesc, -usedesc and -regionmapping */
   gt_seqid2file_register_options(op, arguments->s2fi);
 
+  /* -pipeline */
+  option = gt_option_new_bool("pipeline", "parse, process, and output the "
+                              "features in separate threads",
+                              &arguments->pipeline, false);
+  gt_option_parser_add_option(op, option);
+
   /* -v */
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -110,10 +121,51 @@ static GtOptionParser* gt_cds_option_parser_new(void *tool_arguments)
   return op;
 }
 
+/* Create a stream which determines the CDS features of <gt_jobs> nodes in
+   parallel. Each CDS visitor requires a region mapping of its own, the first
+   one is <region_mapping>. */
+static GtNodeStream* cds_parallel_stream_new(GtNodeStream *in_stream,
+                                             GtRegionMapping *region_mapping,
+                                             CDSArguments *arguments,
+                                             GtError *err)
+{
+  GtNodeStream *cds_stream = NULL;
+  GtNodeVisitor **visitors;
+  GtStr *source;
+  unsigned int i;
+  int had_err = 0;
+  gt_error_check(err);
+  visitors = gt_calloc(gt_jobs, sizeof *visitors);
+  source = gt_str_new_cstr(GT_CDS_SOURCE_TAG);
+  for (i = 0; !had_err && i < gt_jobs; i++) {
+    if (i > 0 &&
+        !(region_mapping = gt_seqid2file_region_mapping_new(arguments->s2fi,
+                                                            err))) {
+      had_err = -1;
+      break;
+    }
+    visitors[i] = gt_cds_visitor_new(region_mapping, arguments->minorflen,
+                                     source, arguments->start_codon,
+                                     arguments->final_stop_codon,
+                                     arguments->generic_start_codons);
+  }
+  if (!had_err)
+    cds_stream = gt_parallel_visitor_stream_new(in_stream, visitors, gt_jobs);
+  else {
+    for (i = 0; i < gt_jobs; i++)
+      gt_node_visitor_delete(visitors[i]);
+  }
+  gt_str_delete(source);
+  gt_free(visitors);
+  return cds_stream;
+}
+
 static int gt_cds_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
                          void *tool_arguments, GtError *err)
 {
-  GtNodeStream *gff3_in_stream, *cds_stream = NULL, *gff3_out_stream = NULL;
+  GtNodeStream *gff3_in_stream, *cds_stream = NULL, *gff3_out_stream = NULL,
+               *parse_thread_stream = NULL, *process_thread_stream = NULL,
+               *last_stream;
   CDSArguments *arguments = tool_arguments;
   GtRegionMapping *region_mapping;
   int had_err = 0;
@@ -132,15 +184,38 @@ static int gt_cds_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
     had_err = -1;
 
   if (!had_err) {
+    last_stream = gff3_in_stream;
+    if (arguments->pipeline) {
+      parse_thread_stream = gt_thread_stream_new(last_stream,
+                                                 GT_THREAD_STREAM_BUFFER_SIZE);
+      last_stream = parse_thread_stream;
+    }
+
     /* create CDS stream */
-    cds_stream = gt_cds_stream_new(gff3_in_stream, region_mapping,
-                                   arguments->minorflen, GT_CDS_SOURCE_TAG,
-                                   arguments->start_codon,
-                                   arguments->final_stop_codon,
-                                   arguments->generic_start_codons);
+    if (gt_jobs > 1)
+      cds_stream = cds_parallel_stream_new(last_stream, region_mapping,
+                                           arguments, err);
+    else {
+      cds_stream = gt_cds_stream_new(last_stream, region_mapping,
+                                     arguments->minorflen, GT_CDS_SOURCE_TAG,
+                                     arguments->start_codon,
+                                     arguments->final_stop_codon,
+                                     arguments->generic_start_codons);
+    }
+    if (!cds_stream)
+      had_err = -1;
+  }
+
+  if (!had_err) {
+    last_stream = cds_stream;
+    if (arguments->pipeline) {
+      process_thread_stream = gt_thread_stream_new(last_stream,
+                                                   GT_THREAD_STREAM_BUFFER_SIZE);
+      last_stream = process_thread_stream;
+    }
 
     /* create gff3 output stream */
-    gff3_out_stream = gt_gff3_out_stream_new(cds_stream, arguments->outfp);
+    gff3_out_stream = gt_gff3_out_stream_new(last_stream, arguments->outfp);
 
     /* pull the features through the stream and free them afterwards */
     had_err = gt_node_stream_pull(gff3_out_stream, err);
@@ -148,7 +223,9 @@ static int gt_cds_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
 
   /* free */
   gt_node_stream_delete(gff3_out_stream);
+  gt_node_stream_delete(process_thread_stream);
   gt_node_stream_delete(cds_stream);
+  gt_node_stream_delete(parse_thread_stream);
   gt_node_stream_delete(gff3_in_stream);
 
   return had_err;
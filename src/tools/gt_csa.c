@@ -24,10 +24,12 @@
 #include "extended/gff3_in_stream.h"
 #include "extended/gff3_out_stream_api.h"
 #include "extended/gtdatahelp.h"
+#include "extended/thread_stream.h"
 #include "tools/gt_csa.h"
 
 typedef struct {
-  bool verbose;
+  bool pipeline,
+       verbose;
   GtUword join_length;
   GtOutputFileInfo *ofi;
   GtFile *outfp;
@@ -67,6 +69,12 @@ static GtOptionParser* gt_csa_option_parser_new(void *tool_arguments)
                                GT_DEFAULT_JOIN_LENGTH);
   gt_option_parser_add_option(op, option);
 
+  /* -pipeline */
+  option = gt_option_new_bool("pipeline", "parse, process, and output the "
+                              "features in separate threads",
+                              &arguments->pipeline, false);
+  gt_option_parser_add_option(op, option);
+
   /* -v */
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -83,7 +91,9 @@ static GtOptionParser* gt_csa_option_parser_new(void *tool_arguments)
 static int gt_csa_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
                          void *tool_arguments, GtError *err)
 {
-  GtNodeStream *gff3_in_stream, *csa_stream, *gff3_out_stream;
+  GtNodeStream *gff3_in_stream, *csa_stream, *gff3_out_stream,
+               *parse_thread_stream = NULL, *process_thread_stream = NULL,
+               *last_stream;
   CSAArguments *arguments = tool_arguments;
   int had_err;
 
@@ -94,15 +104,29 @@ static int gt_csa_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
   gff3_in_stream  = gt_gff3_in_stream_new_sorted(argv[parsed_args]);
   if (arguments->verbose && arguments->outfp)
     gt_gff3_in_stream_show_progress_bar((GtGFF3InStream*) gff3_in_stream);
-  csa_stream      = gt_csa_stream_new(gff3_in_stream, arguments->join_length);
-  gff3_out_stream = gt_gff3_out_stream_new(csa_stream, arguments->outfp);
+  last_stream = gff3_in_stream;
+  if (arguments->pipeline) {
+    parse_thread_stream = gt_thread_stream_new(last_stream,
+                                               GT_THREAD_STREAM_BUFFER_SIZE);
+    last_stream = parse_thread_stream;
+  }
+  csa_stream      = gt_csa_stream_new(last_stream, arguments->join_length);
+  last_stream = csa_stream;
+  if (arguments->pipeline) {
+    process_thread_stream = gt_thread_stream_new(last_stream,
+                                                 GT_THREAD_STREAM_BUFFER_SIZE);
+    last_stream = process_thread_stream;
+  }
+  gff3_out_stream = gt_gff3_out_stream_new(last_stream, arguments->outfp);
 
   /* pull the features through the stream and free them afterwards */
   had_err = gt_node_stream_pull(gff3_out_stream, err);
 
   /* free */
   gt_node_stream_delete(gff3_out_stream);
+  gt_node_stream_delete(process_thread_stream);
   gt_node_stream_delete(csa_stream);
+  gt_node_stream_delete(parse_thread_stream);
   gt_node_stream_delete(gff3_in_stream);
 
   return had_err;
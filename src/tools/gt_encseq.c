@@ -29,6 +29,7 @@
 #include "tools/gt_encseq_md5.h"
 #include "tools/gt_encseq_bench.h"
 #include "tools/gt_encseq_sample.h"
+#include "tools/gt_encseq_shard.h"
 
 static void* gt_encseq_arguments_new(void)
 {
@@ -41,6 +42,7 @@ static void* gt_encseq_arguments_new(void)
   gt_toolbox_add_tool(encseq_toolbox, "encode", gt_encseq_encode());
   gt_toolbox_add_tool(encseq_toolbox, "bench", gt_encseq_bench());
   gt_toolbox_add_tool(encseq_toolbox, "sample", gt_encseq_sample());
+  gt_toolbox_add_tool(encseq_toolbox, "shard", gt_encseq_shard());
   return encseq_toolbox;
 }
 
@@ -386,7 +386,7 @@ static int gt_encseq_info_runner(GT_UNUSED int argc, const char **argv,
 
       gt_file_xprintf(arguments->outfp, "accesstype: ");
       gt_file_xprintf(arguments->outfp, "%s\n",
-                   gt_encseq_access_type_str(gt_encseq_accesstype_get(encseq)));
+                      gt_encseq_accessname(encseq));
 
       gt_file_xprintf(arguments->outfp, "bits used per character: ");
       gt_file_xprintf(arguments->outfp, "%f\n",
@@ -0,0 +1,93 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/encseq_shards.h"
+#include "core/ma.h"
+#include "core/option_api.h"
+#include "core/str_array_api.h"
+#include "tools/gt_encseq_shard.h"
+
+typedef struct {
+  GtStr *indexname;
+} GtEncseqShardArguments;
+
+static void* gt_encseq_shard_arguments_new(void)
+{
+  GtEncseqShardArguments *arguments = gt_calloc(1, sizeof *arguments);
+  arguments->indexname = gt_str_new();
+  return arguments;
+}
+
+static void gt_encseq_shard_arguments_delete(void *tool_arguments)
+{
+  GtEncseqShardArguments *arguments = tool_arguments;
+  if (!arguments) return;
+  gt_str_delete(arguments->indexname);
+  gt_free(arguments);
+}
+
+static GtOptionParser* gt_encseq_shard_option_parser_new(void *tool_arguments)
+{
+  GtEncseqShardArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *option;
+  gt_assert(arguments);
+
+  /* init */
+  op = gt_option_parser_new("-indexname name volume [volume ...]",
+                            "Add encoded sequences as volumes to a sharded "
+                            "encoded sequence.");
+
+  /* -indexname */
+  option = gt_option_new_string("indexname",
+                                "specify name of the sharded encoded "
+                                "sequence",
+                                arguments->indexname, NULL);
+  gt_option_is_mandatory(option);
+  gt_option_parser_add_option(op, option);
+
+  gt_option_parser_set_min_args(op, 1);
+  return op;
+}
+
+static int gt_encseq_shard_runner(int argc, const char **argv,
+                                  int parsed_args, void *tool_arguments,
+                                  GtError *err)
+{
+  GtEncseqShardArguments *arguments = tool_arguments;
+  GtStrArray *volumes;
+  int i, had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+
+  volumes = gt_str_array_new();
+  for (i = parsed_args; i < argc; i++) {
+    gt_str_array_add_cstr(volumes, argv[i]);
+  }
+  had_err = gt_encseq_shards_add(gt_str_get(arguments->indexname), volumes,
+                                 err);
+  gt_str_array_delete(volumes);
+  return had_err;
+}
+
+GtTool* gt_encseq_shard(void)
+{
+  return gt_tool_new(gt_encseq_shard_arguments_new,
+                     gt_encseq_shard_arguments_delete,
+                     gt_encseq_shard_option_parser_new,
+                     NULL,
+                     gt_encseq_shard_runner);
+}
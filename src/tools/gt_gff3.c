@@ -34,6 +34,7 @@
 #include "extended/merge_feature_stream_api.h"
 #include "extended/set_source_visitor_api.h"
 #include "extended/sort_stream.h"
+#include "extended/thread_stream.h"
 #include "extended/typecheck_info.h"
 #include "extended/visitor_stream_api.h"
 #include "extended/xrfcheck_info.h"
@@ -44,6 +45,8 @@ typedef struct {
        sortlines,
        sortnum,
        load,
+       arena,
+       pipeline,
        retainids,
        checkids,
        addids,
@@ -56,7 +59,8 @@ typedef struct {
        fixboundaries;
   GtWord offset;
   GtStr *offsetfile, *newsource;
-  GtUword width;
+  GtUword width,
+          sortmemlimit;
   GtTypecheckInfo *tci;
   GtXRFCheckInfo *xci;
   GtOutputFileInfo *ofi;
@@ -108,6 +112,15 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
                                    &arguments->sort, false);
   gt_option_parser_add_option(op, sort_option);
 
+  /* -sortmemlimit */
+  option = gt_option_new_uword("sortmemlimit", "sort in external memory, "
+                               "keeping at most the given number of megabytes "
+                               "of features in memory and writing the rest "
+                               "to temporary files (0 disables the limit)",
+                               &arguments->sortmemlimit, 0);
+  gt_option_imply(option, sort_option);
+  gt_option_parser_add_option(op, option);
+
   /* -sortlines */
   sortlines_option = gt_option_new_bool("sortlines", "sort the GFF3 features "
                                         "on a strict line basis (not sorted as"
@@ -190,6 +203,20 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   gt_option_is_development_option(load_option);
   gt_option_parser_add_option(op, load_option);
 
+  /* -arena */
+  option = gt_option_new_bool("arena", "allocate the feature nodes of each "
+                              "input file from a memory arena, which is "
+                              "released at once",
+                              &arguments->arena, false);
+  gt_option_is_development_option(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -pipeline */
+  option = gt_option_new_bool("pipeline", "parse, process, and output the "
+                              "features in separate threads",
+                              &arguments->pipeline, false);
+  gt_option_parser_add_option(op, option);
+
   /* -addintrons */
   addintrons_option = gt_option_new_bool("addintrons", "add intron features "
                                          "between existing exon features",
@@ -255,6 +282,8 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
                *merge_feature_stream = NULL,
                *add_introns_stream = NULL,
                *set_source_stream = NULL,
+               *parse_thread_stream = NULL,
+               *process_thread_stream = NULL,
                *gff3_out_stream = NULL,
                *last_stream;
   int had_err = 0;
@@ -309,9 +338,20 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && arguments->tidy)
     gt_gff3_in_stream_enable_tidy_mode((GtGFF3InStream*) gff3_in_stream);
 
+  /* allocate feature nodes from an arena (if necessary) */
+  if (!had_err && arguments->arena)
+    gt_gff3_in_stream_enable_arena((GtGFF3InStream*) gff3_in_stream);
+
   if (!had_err && arguments->fixboundaries)
     gt_gff3_in_stream_fix_region_boundaries((GtGFF3InStream*) gff3_in_stream);
 
+  /* parse in a separate thread (if necessary) */
+  if (!had_err && arguments->pipeline) {
+    parse_thread_stream = gt_thread_stream_new(last_stream,
+                                               GT_THREAD_STREAM_BUFFER_SIZE);
+    last_stream = parse_thread_stream;
+  }
+
   /* create load stream (if necessary) */
   if (!had_err && arguments->load) {
     load_stream = gt_load_stream_new(last_stream);
@@ -321,7 +361,13 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   /* create sort stream (if necessary) */
   if (!had_err && (arguments->sort || arguments->sortlines ||
                    arguments->sortnum)) {
-    sort_stream = gt_sort_stream_new(last_stream);
+    if (arguments->sortmemlimit) {
+      sort_stream = gt_sort_stream_new_with_memlimit(last_stream,
+                                                     arguments->sortmemlimit
+                                                     << 20);
+    }
+    else
+      sort_stream = gt_sort_stream_new(last_stream);
     last_stream = sort_stream;
   }
 
@@ -347,6 +393,13 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
     last_stream = set_source_stream;
   }
 
+  /* process in a separate thread (if necessary) */
+  if (!had_err && arguments->pipeline && last_stream != parse_thread_stream) {
+    process_thread_stream = gt_thread_stream_new(last_stream,
+                                                 GT_THREAD_STREAM_BUFFER_SIZE);
+    last_stream = process_thread_stream;
+  }
+
   /* create gff3 output stream */
   if (!had_err && arguments->show) {
     if (arguments->sortlines) {
@@ -385,11 +438,13 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
 
   /* free */
   gt_node_stream_delete(gff3_out_stream);
+  gt_node_stream_delete(process_thread_stream);
   gt_node_stream_delete(sort_stream);
   gt_node_stream_delete(load_stream);
   gt_node_stream_delete(merge_feature_stream);
   gt_node_stream_delete(add_introns_stream);
   gt_node_stream_delete(set_source_stream);
+  gt_node_stream_delete(parse_thread_stream);
   gt_node_stream_delete(gff3_in_stream);
   gt_type_checker_delete(type_checker);
   gt_xrf_checker_delete(xrf_checker);
@@ -20,6 +20,7 @@
 #include "core/error.h"
 #include "core/ma.h"
 #include "core/option_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "core/versionfunc.h"
 #include "match/eis-voiditf.h"
@@ -52,12 +53,14 @@ typedef struct
                       maxlength;
   unsigned int showmode;
   bool verifywitnesspos;
+  GtUword batchsize;
   GtStr *indexname;
   GtStrArray *queryfilenames, *flagsoutputoption;
   Indextype indextype;
   bool doms;
   GtOption *optionmin, *optionmax, *optionoutput, *optionfmindex,
-           *optionesaindex, *optionpckindex, *optionquery, *optionverify;
+           *optionesaindex, *optionpckindex, *optionquery, *optionverify,
+           *optionbatch;
 } Gfmsubcallinfo;
 
 static void* gt_matstat_arguments_new_generic(bool doms)
@@ -159,9 +162,20 @@ static GtOptionParser* gt_matstat_option_parser_new(void *tool_arguments)
                                                  false);
     gt_option_is_development_option(arguments->optionverify);
     gt_option_parser_add_option(op, arguments->optionverify);
+
+    arguments->optionbatch = gt_option_new_uword("batch",
+                                   "process the suffixes of each query in "
+                                   "batches of the given size\n"
+                                   "(only for -pck)",
+                                   &arguments->batchsize,
+                                   0);
+    gt_option_parser_add_option(op, arguments->optionbatch);
+    gt_option_exclude(arguments->optionbatch,arguments->optionesaindex);
+    gt_option_exclude(arguments->optionbatch,arguments->optionfmindex);
   } else
   {
     arguments->verifywitnesspos = false;
+    arguments->batchsize = 0;
   }
 
   gt_option_parser_refer_to_manual(op);
@@ -296,6 +310,7 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
   Fmindex fmindex;
   Suffixarray suffixarray;
   void *packedindex = NULL;
+  const void **indextab = NULL;
   GtLogger *logger = NULL;
   bool haserr = false;
   const GtAlphabet *alphabet = NULL;
@@ -377,6 +392,7 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
   {
     const void *theindex;
     Greedygmatchforwardfunction gmatchforwardfunction;
+    Greedygmatchforwardbatchfunction gmatchforwardbatchfunction = NULL;
 
     if (arguments->indextype == Fmindextype)
     {
@@ -407,6 +423,11 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
         if (arguments->doms)
         {
           gmatchforwardfunction = gt_voidpackedindexmstatsforward;
+          if (arguments->batchsize > 0)
+          {
+            gmatchforwardbatchfunction
+              = gt_voidpackedindexmstatsforward_batch;
+          }
         } else
         {
           gmatchforwardfunction = gt_voidpackedindexuniqueforward;
@@ -432,13 +453,31 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
         haserr = true;
       }
 #endif
+      if (!haserr)
+      {
+        unsigned int t;
+
+        /* the packed index caches data of previous queries, so each thread
+           needs its own view of it. The other indexes are read only. */
+        indextab = gt_malloc(sizeof (*indextab) * gt_jobs);
+        indextab[0] = theindex;
+        for (t = 1U; t < gt_jobs; t++)
+        {
+          indextab[t] = arguments->indextype == Packedindextype
+                          ? (const void *) gt_newvoidBWTSeqView(packedindex)
+                          : theindex;
+        }
+      }
       if (!haserr &&
           gt_findsubquerygmatchforward(dotestsequence(arguments)
                                       ? suffixarray.encseq
                                       : NULL,
-                                      theindex,
+                                      indextab,
+                                      gt_jobs,
                                       totallength,
                                       gmatchforwardfunction,
+                                      gmatchforwardbatchfunction,
+                                      arguments->batchsize,
                                       alphabet,
                                       arguments->queryfilenames,
                                       arguments->minlength,
@@ -455,6 +494,19 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
       }
     }
   }
+  if (indextab != NULL)
+  {
+    if (arguments->indextype == Packedindextype)
+    {
+      unsigned int t;
+
+      for (t = 1U; t < gt_jobs; t++)
+      {
+        gt_deletevoidBWTSeqView((FMindex *) indextab[t]);
+      }
+    }
+    gt_free(indextab);
+  }
   if (arguments->indextype == Fmindextype)
   {
     if (!gt_mapfmindexfail)
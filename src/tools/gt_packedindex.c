@@ -24,6 +24,7 @@
 #include "core/versionfunc.h"
 #include "match/sfx-run.h"
 #include "tools/gt_packedindex.h"
+#include "tools/gt_packedindex_bench_rank.h"
 #include "tools/gt_packedindex_mkctxmap.h"
 #include "tools/gt_packedindex_trsuftab.h"
 #include "tools/gt_packedindex_chk_integrity.h"
@@ -44,6 +45,7 @@ static void* gt_packedindex_arguments_new(void)
   gt_toolbox_add(packedindex_toolbox, "chkintegrity",
               gt_packedindex_chk_integrity );
   gt_toolbox_add(packedindex_toolbox, "chksearch", gt_packedindex_chk_search);
+  gt_toolbox_add(packedindex_toolbox, "benchrank", gt_packedindex_bench_rank);
   return packedindex_toolbox;
 }
 
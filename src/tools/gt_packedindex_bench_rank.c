@@ -0,0 +1,164 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+/**
+ * \file gt_packedindex_bench_rank
+ * times rank queries on a block composition index for both ways of
+ * counting symbols in partially covered blocks
+ */
+
+#include <stdio.h>
+#include "core/error.h"
+#include "core/ma.h"
+#include "core/mathsupport.h"
+#include "core/option_api.h"
+#include "core/timer_api.h"
+#include "core/versionfunc.h"
+#include "match/eis-encidxseq.h"
+#include "match/eis-encidxseq-param.h"
+#include "match/eis-encidxseq-construct.h"
+#include "tools/gt_packedindex_bench_rank.h"
+
+struct benchRankOptions
+{
+  GtUword numOfSamples;
+};
+
+static GtOPrval
+parseBenchRankOptions(int *parsed_args, int argc, const char *argv[],
+                      struct benchRankOptions *params, GtError *err);
+
+/* run rank and range rank queries for all block encoded symbols at the
+ * sampled positions and store the results in <ranks> */
+static GtWord
+benchRankQueries(EISeq *seq, const GtUword *samplePos, GtUword numOfSamples,
+                 AlphabetRangeSize rangeSize, GtUword *ranks)
+{
+  GtTimer *timer = gt_timer_new();
+  EISHint hint = newEISHint(seq);
+  GtUword sample;
+  GtWord usec;
+  gt_timer_start(timer);
+  for (sample = 0; sample < numOfSamples; ++sample)
+  {
+    GtUword *sampleRanks = ranks + sample * 2 * rangeSize;
+    Symbol sym;
+    for (sym = 0; sym < rangeSize; ++sym)
+      sampleRanks[sym] = EISRank(seq, sym, samplePos[sample], hint);
+    EISRangeRank(seq, 0, samplePos[sample], sampleRanks + rangeSize, hint);
+  }
+  gt_timer_stop(timer);
+  usec = gt_timer_elapsed_usec(timer);
+  deleteEISHint(seq, hint);
+  gt_timer_delete(timer);
+  return usec;
+}
+
+extern int
+gt_packedindex_bench_rank(int argc, const char *argv[], GtError *err)
+{
+  struct encIdxSeq *seq;
+  struct benchRankOptions params;
+  const char *inputProject;
+  int parsedArgs;
+  int had_err = 0;
+  gt_error_check(err);
+
+  switch (parseBenchRankOptions(&parsedArgs, argc, argv, &params, err))
+  {
+    case GT_OPTION_PARSER_OK:
+      break;
+    case GT_OPTION_PARSER_ERROR:
+      return -1;
+    case GT_OPTION_PARSER_REQUESTS_EXIT:
+      return 0;
+  }
+
+  inputProject = argv[parsedArgs];
+  seq = gt_loadEncIdxSeq(inputProject, BWT_ON_BLOCK_ENC,
+                         EIS_FEATURE_REGION_SUMS, NULL, err);
+  if ((had_err = seq == NULL))
+  {
+    gt_error_set(err, "Failed to load index: %s", inputProject);
+  }
+  else
+  {
+    AlphabetRangeSize rangeSize = MRAEncGetRangeSize(EISGetAlphabet(seq), 0);
+    GtUword sample, len = EISLength(seq), numOfRanks,
+      *samplePos = gt_malloc(sizeof (*samplePos) * params.numOfSamples),
+      *unpackedRanks, *packedRanks;
+    GtWord unpackedUsec, packedUsec;
+    numOfRanks = params.numOfSamples * 2 * rangeSize;
+    unpackedRanks = gt_malloc(sizeof (*unpackedRanks) * numOfRanks);
+    packedRanks = gt_malloc(sizeof (*packedRanks) * numOfRanks);
+    for (sample = 0; sample < params.numOfSamples; ++sample)
+      samplePos[sample] = gt_rand_max(len);
+    gt_blockEncIdxSeqUnpackBlocksForRank(seq, true);
+    unpackedUsec = benchRankQueries(seq, samplePos, params.numOfSamples,
+                                    rangeSize, unpackedRanks);
+    gt_blockEncIdxSeqUnpackBlocksForRank(seq, false);
+    packedUsec = benchRankQueries(seq, samplePos, params.numOfSamples,
+                                  rangeSize, packedRanks);
+    printf("# "GT_WU" positions, "GT_WU" rank queries each\n",
+           params.numOfSamples, (GtUword) rangeSize + 1);
+    printf("# unpacked blocks: %.3f sec\n", (double) unpackedUsec / 1e6);
+    printf("# packed blocks: %.3f sec\n", (double) packedUsec / 1e6);
+    for (sample = 0; sample < numOfRanks; ++sample)
+    {
+      if (unpackedRanks[sample] != packedRanks[sample])
+      {
+        gt_error_set(err, "rank queries at position "GT_WU" differ: "
+                     GT_WU" (unpacked) vs. "GT_WU" (packed)",
+                     samplePos[sample / (2 * rangeSize)],
+                     unpackedRanks[sample], packedRanks[sample]);
+        had_err = -1;
+        break;
+      }
+    }
+    gt_free(packedRanks);
+    gt_free(unpackedRanks);
+    gt_free(samplePos);
+  }
+  if (seq) gt_deleteEncIdxSeq(seq);
+  return had_err?-1:0;
+}
+
+static GtOPrval
+parseBenchRankOptions(int *parsed_args, int argc, const char *argv[],
+                      struct benchRankOptions *params, GtError *err)
+{
+  GtOptionParser *op;
+  GtOption *option;
+  GtOPrval oprval;
+
+  gt_error_check(err);
+  op = gt_option_parser_new("indexname",
+                         "Map <indexname> block composition index and "
+                         "compare the running times of rank queries "
+                         "counting symbols in the packed and in the "
+                         "unpacked blocks.");
+
+  option = gt_option_new_uword("nsamples",
+                            "number of positions to query",
+                            &params->numOfSamples, 100000UL);
+  gt_option_parser_add_option(op, option);
+
+  gt_option_parser_set_min_max_args(op, 1, 1);
+  oprval = gt_option_parser_parse(op, parsed_args, argc, (const char**) argv,
+                               gt_versionfunc, err);
+  gt_option_parser_delete(op);
+  return oprval;
+}
@@ -23,6 +23,7 @@
 #include "core/ma_api.h"
 #include "core/option_api.h"
 #include "core/str_api.h"
+#include "core/thread_api.h"
 #include "core/tool_api.h"
 #include "core/unused_api.h"
 #include "core/versionfunc.h"
@@ -485,6 +486,15 @@ static int gt_repfind_arguments_check(GT_UNUSED int rest_argc,
 {
   GtMaxpairsoptions *arguments = tool_arguments;
 
+#ifdef GT_THREADS_ENABLED
+  if (arguments->scanfile && gt_jobs > 1U)
+  {
+    /* the parallel enumeration needs random access to the index */
+    gt_error_set(err,"option -scan does not work with multiple threads");
+    return -1;
+  }
+#endif
+
   if (!gt_option_is_set(arguments->refforwardoption) &&
       (arguments->reverse || arguments->reverse_complement))
   {
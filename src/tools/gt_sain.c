@@ -144,7 +144,8 @@ static GtOptionParser *gt_sain_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, option);
 
   /* -suf */
-  option = gt_option_new_bool("suf","output suffix array (table suftab)",
+  option = gt_option_new_bool("suf","output suffix array (table suftab) "
+                              "and, with option -lcp, the lcp table",
                               &arguments->suftabout, false);
   gt_option_parser_add_option(op, option);
 
@@ -523,6 +524,21 @@ static int gt_sain_runner(int argc, GT_UNUSED const char **argv,
                                                  suftab);
             }
             gt_logger_log(tl->logger,"maxlcp="GT_WU,maxlcp);
+            if (arguments->suftabout)
+            {
+              char *inputfile_basename = gt_basename(inputfile);
+              FILE *fpout = gt_fa_fopen_with_suffix(inputfile_basename,
+                                                    ".lcp","wb",err);
+              if (fpout == NULL)
+              {
+                had_err = -1;
+              } else
+              {
+                gt_xfwrite(lcptab,sizeof *lcptab,totallength+1,fpout);
+                gt_fa_fclose(fpout);
+              }
+              gt_free(inputfile_basename);
+            }
             gt_free(lcptab);
           }
           gt_free(suftab);
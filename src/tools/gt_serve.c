@@ -0,0 +1,586 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef _WIN32
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include "core/cstr_api.h"
+#include "core/cstr_array.h"
+#include "core/error.h"
+#include "core/fa.h"
+#include "core/ma.h"
+#include "core/option_api.h"
+#include "core/splitter_api.h"
+#include "core/str_api.h"
+#include "core/str_array.h"
+#include "core/tool.h"
+#include "core/toolbox.h"
+#include "core/unused_api.h"
+#include "gtt.h"
+#include "tools/gt_serve.h"
+
+/* every response ends with a line starting with this string, followed by
+   "ok" or "error: <message>" */
+#define GT_SERVE_STATUS "#gt-serve"
+/* a socket server sends the error output of a tool in lines starting with
+   this string, after the regular output */
+#define GT_SERVE_STDERR "#gt-serve-stderr "
+
+typedef struct {
+  GtStr *socketpath,
+        *connectpath;
+} GtServeArguments;
+
+static void* gt_serve_arguments_new(void)
+{
+  GtServeArguments *arguments = gt_calloc((size_t) 1, sizeof *arguments);
+  arguments->socketpath = gt_str_new();
+  arguments->connectpath = gt_str_new();
+  return arguments;
+}
+
+static void gt_serve_arguments_delete(void *tool_arguments)
+{
+  GtServeArguments *arguments = tool_arguments;
+  if (!arguments) return;
+  gt_str_delete(arguments->socketpath);
+  gt_str_delete(arguments->connectpath);
+  gt_free(arguments);
+}
+
+static int gt_serve_comment(GT_UNUSED const char *progname,
+                            GT_UNUSED void *data,
+                            GT_UNUSED GtError *err)
+{
+  printf("\nEach line read from stdin (or from a client connected to the "
+         "socket) is a\ngt command line without the leading \"gt\", e.g.\n"
+         "  tallymer search -tyr index -q queries.fna\n"
+         "Arguments are separated by blanks, there is no quoting. The "
+         "output of the\ntool is followed by a line \"" GT_SERVE_STATUS
+         " ok\" or \"" GT_SERVE_STATUS " error: <message>\".\nThe line "
+         "\"quit\" ends a session, \"shutdown\" additionally stops a socket "
+         "server.\nEach request runs in its own child process, so a failing "
+         "tool cannot stop the\nserver, and the error output of the tool "
+         "goes to the client. Read-only index\ntables stay mapped in the "
+         "server between requests, so repeated queries against\nthe same "
+         "index avoid the startup cost. File names are relative to the "
+         "working\ndirectory of the server.\n");
+  return 0;
+}
+
+static GtOptionParser* gt_serve_option_parser_new(void *tool_arguments)
+{
+  GtServeArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *socketoption, *connectoption;
+  gt_assert(arguments);
+
+  /* init */
+  op = gt_option_parser_new("[option ...]",
+                            "Run gt commands read from stdin or a local "
+                            "socket in one process,\nkeeping mapped indexes "
+                            "warm between them.");
+
+  /* -socket */
+  socketoption = gt_option_new_string("socket",
+                                      "listen for clients on the Unix domain "
+                                      "socket with the given path instead of "
+                                      "reading commands from stdin",
+                                      arguments->socketpath, NULL);
+  gt_option_parser_add_option(op, socketoption);
+
+  /* -connect */
+  connectoption = gt_option_new_string("connect",
+                                       "act as a client: send the commands "
+                                       "read from stdin to the server "
+                                       "listening on the given socket and "
+                                       "show its responses",
+                                       arguments->connectpath, NULL);
+  gt_option_parser_add_option(op, connectoption);
+  gt_option_exclude(socketoption, connectoption);
+
+  gt_option_parser_set_comment_func(op, gt_serve_comment, NULL);
+  gt_option_parser_set_max_args(op, 0);
+  return op;
+}
+
+/* reads the next line from <fp> into <line>, without the newline; returns EOF
+   at the end of the input or if reading fails */
+static int gt_serve_read_line(GtStr *line, FILE *fp)
+{
+  int cc;
+
+  gt_str_reset(line);
+  while ((cc = getc(fp)) != EOF && cc != '\n')
+    gt_str_append_char(line, (char) cc);
+  if (cc == EOF && gt_str_length(line) == 0)
+    return EOF;
+  if (gt_str_length(line) > 0 &&
+      gt_str_get(line)[gt_str_length(line) - 1] == '\r')
+    gt_str_set_length(line, gt_str_length(line) - 1);
+  return 0;
+}
+
+static int gt_serve_run_request(const char *progname, GtStr *line,
+                                GtError *err)
+{
+  GtSplitter *splitter;
+  GtToolbox *tools;
+  GtToolfunc toolfunc;
+  GtTool *tool;
+  char **argv, **nargv = NULL, *cstr = gt_str_get(line);
+  GtUword idx;
+  int argc, had_err = 0;
+  gt_error_check(err);
+
+  for (idx = 0; idx < gt_str_length(line); idx++) {
+    if (cstr[idx] == '\t')
+      cstr[idx] = ' ';
+  }
+  splitter = gt_splitter_new();
+  gt_splitter_split_non_empty(splitter, cstr, gt_str_length(line), ' ');
+  argv = gt_splitter_get_tokens(splitter);
+  argc = (int) gt_splitter_size(splitter);
+  gt_assert(argc > 0);
+  /* a fresh toolbox for each request, so no state is carried over */
+  tools = gtt_tools();
+  if (strcmp(argv[0], "serve") == 0) {
+    gt_error_set(err, "the serve tool cannot be run by a server");
+    had_err = -1;
+  }
+  else if (!gt_toolbox_has_tool(tools, argv[0])) {
+    gt_error_set(err, "unknown tool '%s'", argv[0]);
+    had_err = -1;
+  }
+  if (!had_err) {
+    tool = NULL;
+    if (!(toolfunc = gt_toolbox_get(tools, argv[0]))) {
+      tool = gt_toolbox_get_tool(tools, argv[0]);
+      gt_assert(tool);
+    }
+    nargv = gt_cstr_array_prefix_first((const char**) argv, progname);
+    gt_error_set_progname(err, nargv[0]);
+    if (toolfunc)
+      had_err = toolfunc(argc, (const char**) nargv, err);
+    else
+      had_err = gt_tool_run(tool, argc, (const char**) nargv, err);
+  }
+  gt_cstr_array_delete(nargv);
+  gt_toolbox_delete(tools);
+  gt_splitter_delete(splitter);
+  return had_err;
+}
+
+#ifndef _WIN32
+/* appends everything read from <errfd> to <errtext> and everything read from
+   <ctlfd> to <ctl>, until the writer closed both pipes */
+static void gt_serve_read_pipes(int errfd, GtStr *errtext, int ctlfd,
+                                GtStr *ctl)
+{
+  struct pollfd fds[2];
+  GtStr *dest[2];
+  char buf[BUFSIZ];
+  int idx, numofopen = 2;
+
+  fds[0].fd = errfd;
+  fds[1].fd = ctlfd;
+  dest[0] = errtext;
+  dest[1] = ctl;
+  for (idx = 0; idx < 2; idx++)
+    fds[idx].events = POLLIN;
+  while (numofopen > 0) {
+    if (poll(fds, (nfds_t) 2, -1) == -1) {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    for (idx = 0; idx < 2; idx++) {
+      if (fds[idx].fd >= 0 && fds[idx].revents != 0) {
+        ssize_t len = read(fds[idx].fd, buf, sizeof buf);
+
+        if (len > 0)
+          gt_str_append_cstr_nt(dest[idx], buf, (GtUword) len);
+        else if (len == 0 || errno != EINTR) {
+          fds[idx].fd = -1;
+          numofopen--;
+        }
+      }
+    }
+  }
+}
+
+/* runs the request <line> in the child process, reports the files mapped by
+   the tool and its status on <ctlfd> and ends the child */
+static void gt_serve_child(const char *progname, GtStr *line, int outfd,
+                           int errfd, int ctlfd)
+{
+  GtError *reqerr = gt_error_new();
+  GtStrArray *paths = gt_str_array_new();
+  FILE *ctl;
+  GtUword idx;
+  int had_err;
+
+  (void) dup2(outfd, STDOUT_FILENO);
+  (void) dup2(errfd, STDERR_FILENO);
+  (void) close(errfd);
+  had_err = gt_serve_run_request(progname, line, reqerr);
+  (void) fflush(stdout);
+  (void) fflush(stderr);
+  if ((ctl = fdopen(ctlfd, "w")) != NULL) {
+    gt_fa_mmap_cache_paths(paths);
+    for (idx = 0; idx < gt_str_array_size(paths); idx++)
+      fprintf(ctl, "map %s\n", gt_str_array_get(paths, idx));
+    if (had_err)
+      fprintf(ctl, "error %s", gt_error_get(reqerr));
+    else
+      fprintf(ctl, "ok");
+    (void) fclose(ctl);
+  }
+  gt_str_array_delete(paths);
+  gt_error_delete(reqerr);
+  /* the remaining state is a copy of the server state, which is cleaned up
+     by the server */
+  _exit(EXIT_SUCCESS);
+}
+
+/* runs the request <line> in a child process writing its output to <outfd>,
+   so that a tool calling exit() or crashing only ends the child. The error
+   output of the tool is appended to <errtext>. The server maps the files
+   mapped by the tool as well, so that the following requests inherit the
+   maps. */
+static int gt_serve_fork_request(const char *progname, GtStr *line, int outfd,
+                                 GtStr *errtext, GtError *err)
+{
+  int errpipe[2], ctlpipe[2], status = 0, had_err = 0;
+  char *ctlptr, *newline;
+  GtStr *ctl;
+  pid_t pid;
+  gt_error_check(err);
+
+  if (pipe(errpipe) != 0) {
+    gt_error_set(err, "cannot create pipe: %s", strerror(errno));
+    return -1;
+  }
+  if (pipe(ctlpipe) != 0) {
+    gt_error_set(err, "cannot create pipe: %s", strerror(errno));
+    (void) close(errpipe[0]);
+    (void) close(errpipe[1]);
+    return -1;
+  }
+  (void) fflush(stdout);
+  (void) fflush(stderr);
+  if ((pid = fork()) == -1) {
+    gt_error_set(err, "cannot fork: %s", strerror(errno));
+    had_err = -1;
+  }
+  else if (pid == 0) {
+    (void) close(errpipe[0]);
+    (void) close(ctlpipe[0]);
+    gt_serve_child(progname, line, outfd, errpipe[1], ctlpipe[1]);
+  }
+  (void) close(errpipe[1]);
+  (void) close(ctlpipe[1]);
+  ctl = gt_str_new();
+  if (!had_err) {
+    gt_serve_read_pipes(errpipe[0], errtext, ctlpipe[0], ctl);
+    while (waitpid(pid, &status, 0) == -1 && errno == EINTR)
+      /* nothing */;
+  }
+  (void) close(errpipe[0]);
+  (void) close(ctlpipe[0]);
+  if (!had_err) {
+    ctlptr = gt_str_get(ctl);
+    while (strncmp(ctlptr, "map ", strlen("map ")) == 0 &&
+           (newline = strchr(ctlptr, '\n')) != NULL) {
+      void *map;
+
+      *newline = '\0';
+      if ((map = gt_fa_mmap_read(ctlptr + strlen("map "), NULL, NULL)))
+        gt_fa_xmunmap(map);
+      ctlptr = newline + 1;
+    }
+    if (strncmp(ctlptr, "error ", strlen("error ")) == 0) {
+      gt_error_set(err, "%s", ctlptr + strlen("error "));
+      had_err = -1;
+    }
+    else if (strcmp(ctlptr, "ok") != 0) {
+      /* the tool ended the child before reporting its status */
+      if (WIFSIGNALED(status)) {
+        gt_error_set(err, "tool was killed by signal %d", WTERMSIG(status));
+        had_err = -1;
+      }
+      else if (WIFEXITED(status) && WEXITSTATUS(status) != 0) {
+        gt_error_set(err, "tool exited with status %d", WEXITSTATUS(status));
+        had_err = -1;
+      }
+    }
+  }
+  gt_str_delete(ctl);
+  return had_err;
+}
+#endif
+
+/* sends the error output <errtext> of a tool to the client, a socket client
+   gets it in lines starting with GT_SERVE_STDERR */
+static void gt_serve_send_errtext(FILE *out, bool socketclient,
+                                  const GtStr *errtext)
+{
+  const char *ptr = gt_str_get(errtext),
+             *end = ptr + gt_str_length(errtext);
+
+  if (!socketclient) {
+    (void) fwrite(ptr, sizeof (char), (size_t) gt_str_length(errtext), stderr);
+    return;
+  }
+  while (ptr < end) {
+    const char *newline = memchr(ptr, '\n', (size_t) (end - ptr));
+    size_t len = newline != NULL ? (size_t) (newline - ptr)
+                                 : (size_t) (end - ptr);
+
+    fprintf(out, GT_SERVE_STDERR "%.*s\n", (int) len, ptr);
+    ptr += len + 1;
+  }
+}
+
+/* answers the requests read from <in>, the tool output goes to the file
+   descriptor <outfd> and the status lines to <out>, which must refer to the
+   same file. Sets <shutdown> if the client requests the server to stop. */
+static void gt_serve_session(const char *progname, FILE *in, FILE *out,
+                             int outfd, bool *shutdown)
+{
+  GtStr *line = gt_str_new(),
+        *errtext = gt_str_new();
+  GtError *reqerr = gt_error_new();
+  int had_err;
+
+  while (gt_serve_read_line(line, in) != EOF) {
+    if (strspn(gt_str_get(line), " \t") == gt_str_length(line))
+      continue;
+    if (strcmp(gt_str_get(line), "quit") == 0)
+      break;
+    if (strcmp(gt_str_get(line), "shutdown") == 0) {
+      *shutdown = true;
+      break;
+    }
+#ifndef _WIN32
+    had_err = gt_serve_fork_request(progname, line, outfd, errtext, reqerr);
+#else
+    /* without sockets the tool output always goes to stdout */
+    gt_assert(outfd == STDOUT_FILENO);
+    had_err = gt_serve_run_request(progname, line, reqerr);
+    (void) fflush(stdout);
+#endif
+    gt_serve_send_errtext(out, outfd != STDOUT_FILENO, errtext);
+    if (had_err)
+      fprintf(out, GT_SERVE_STATUS " error: %s\n", gt_error_get(reqerr));
+    else
+      fprintf(out, GT_SERVE_STATUS " ok\n");
+    (void) fflush(out);
+    gt_str_reset(errtext);
+    gt_error_unset(reqerr);
+  }
+  gt_error_delete(reqerr);
+  gt_str_delete(errtext);
+  gt_str_delete(line);
+}
+
+#ifndef _WIN32
+static int gt_serve_socket_address(struct sockaddr_un *addr, const char *path,
+                                   GtError *err)
+{
+  gt_error_check(err);
+  if (strlen(path) >= sizeof (addr->sun_path)) {
+    gt_error_set(err, "socket path \"%s\" is too long", path);
+    return -1;
+  }
+  memset(addr, 0, sizeof *addr);
+  addr->sun_family = AF_UNIX;
+  strcpy(addr->sun_path, path);
+  return 0;
+}
+
+static int gt_serve_listen(const char *progname, const char *path,
+                           GtError *err)
+{
+  struct sockaddr_un addr;
+  struct stat sb;
+  bool shutdown = false;
+  int sfd, had_err;
+  gt_error_check(err);
+
+  if ((had_err = gt_serve_socket_address(&addr, path, err)))
+    return had_err;
+  /* remove a stale socket left behind by a server which was killed */
+  if (stat(path, &sb) == 0 && S_ISSOCK(sb.st_mode))
+    (void) unlink(path);
+  if ((sfd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1) {
+    gt_error_set(err, "cannot create socket: %s", strerror(errno));
+    return -1;
+  }
+  if (bind(sfd, (struct sockaddr*) &addr, sizeof addr) != 0 ||
+      listen(sfd, 8) != 0) {
+    gt_error_set(err, "cannot listen on socket \"%s\": %s", path,
+                 strerror(errno));
+    (void) close(sfd);
+    return -1;
+  }
+  /* a client going away must not stop the server */
+  (void) signal(SIGPIPE, SIG_IGN);
+  while (!had_err && !shutdown) {
+    FILE *in, *out;
+    int cfd = accept(sfd, NULL, NULL);
+
+    if (cfd == -1) {
+      if (errno == EINTR)
+        continue;
+      gt_error_set(err, "cannot accept connection on socket \"%s\": %s", path,
+                   strerror(errno));
+      had_err = -1;
+      break;
+    }
+    in = fdopen(cfd, "r");
+    out = fdopen(dup(cfd), "w");
+    if (in && out)
+      gt_serve_session(progname, in, out, fileno(out), &shutdown);
+    if (in) (void) fclose(in); else (void) close(cfd);
+    if (out) (void) fclose(out);
+  }
+  (void) close(sfd);
+  (void) unlink(path);
+  return had_err;
+}
+
+static int gt_serve_connect(const char *path, GtError *err)
+{
+  struct sockaddr_un addr;
+  GtStr *line, *response;
+  FILE *in, *out;
+  int fd, had_err;
+  gt_error_check(err);
+
+  if ((had_err = gt_serve_socket_address(&addr, path, err)))
+    return had_err;
+  if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1) {
+    gt_error_set(err, "cannot create socket: %s", strerror(errno));
+    return -1;
+  }
+  if (connect(fd, (struct sockaddr*) &addr, sizeof addr) != 0) {
+    gt_error_set(err, "cannot connect to socket \"%s\": %s", path,
+                 strerror(errno));
+    (void) close(fd);
+    return -1;
+  }
+  in = fdopen(fd, "r");
+  out = fdopen(dup(fd), "w");
+  gt_assert(in && out);
+  line = gt_str_new();
+  response = gt_str_new();
+  while (!had_err && gt_serve_read_line(line, stdin) != EOF) {
+    bool done = false;
+
+    if (strspn(gt_str_get(line), " \t") == gt_str_length(line))
+      continue;
+    fprintf(out, "%s\n", gt_str_get(line));
+    (void) fflush(out);
+    if (strcmp(gt_str_get(line), "quit") == 0 ||
+        strcmp(gt_str_get(line), "shutdown") == 0)
+      break;
+    while (!done) {
+      if (gt_serve_read_line(response, in) == EOF) {
+        gt_error_set(err, "connection closed by server");
+        had_err = -1;
+        break;
+      }
+      if (strncmp(gt_str_get(response), GT_SERVE_STDERR,
+                  strlen(GT_SERVE_STDERR)) == 0)
+        fprintf(stderr, "%s\n",
+                gt_str_get(response) + strlen(GT_SERVE_STDERR));
+      else if (strncmp(gt_str_get(response), GT_SERVE_STATUS " ",
+                       strlen(GT_SERVE_STATUS " ")) == 0) {
+        const char *status = gt_str_get(response) +
+                             strlen(GT_SERVE_STATUS " ");
+        if (strncmp(status, "error: ", strlen("error: ")) == 0) {
+          gt_error_set(err, "%s", status + strlen("error: "));
+          had_err = -1;
+        }
+        done = true;
+      }
+      else
+        printf("%s\n", gt_str_get(response));
+    }
+  }
+  gt_str_delete(response);
+  gt_str_delete(line);
+  (void) fclose(out);
+  (void) fclose(in);
+  return had_err;
+}
+#endif
+
+static int gt_serve_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
+                           GT_UNUSED int parsed_args, void *tool_arguments,
+                           GtError *err)
+{
+  GtServeArguments *arguments = tool_arguments;
+  char *progname, *blank;
+  bool shutdown = false;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+
+#ifdef _WIN32
+  if (gt_str_length(arguments->socketpath) > 0 ||
+      gt_str_length(arguments->connectpath) > 0) {
+    gt_error_set(err, "sockets are not supported on this platform");
+    return -1;
+  }
+#else
+  if (gt_str_length(arguments->connectpath) > 0)
+    return gt_serve_connect(gt_str_get(arguments->connectpath), err);
+#endif
+  /* the requested tools are reported as "gt <tool>" instead of "gt serve" */
+  progname = gt_cstr_dup(gt_error_get_progname(err));
+  if ((blank = strrchr(progname, ' ')) != NULL)
+    *blank = '\0';
+  gt_fa_enable_mmap_cache();
+#ifndef _WIN32
+  if (gt_str_length(arguments->socketpath) > 0)
+    had_err = gt_serve_listen(progname, gt_str_get(arguments->socketpath),
+                              err);
+  else
+#endif
+    gt_serve_session(progname, stdin, stdout, STDOUT_FILENO, &shutdown);
+  gt_fa_disable_mmap_cache();
+  gt_free(progname);
+  return had_err;
+}
+
+GtTool* gt_serve(void)
+{
+  return gt_tool_new(gt_serve_arguments_new,
+                     gt_serve_arguments_delete,
+                     gt_serve_option_parser_new,
+                     NULL,
+                     gt_serve_runner);
+}
@@ -82,7 +82,7 @@ static GtOptionParser* gt_tagerator_option_parser_new(void *tool_arguments)
   TageratorOptions *arguments = tool_arguments;
   GtOptionParser *op;
   GtOption *option, *optionrw, *optiononline, *optioncmp, *optionesaindex,
-           *optionpckindex, *optionmaxdepth, *optionbest;
+           *optionpckindex, *optionmaxdepth, *optionbest, *optionbatch;
 
   gt_assert(arguments != NULL);
   op = gt_option_parser_new("[options] -q tagfile [-esa|-pck] indexname",
@@ -167,6 +167,15 @@ static GtOptionParser* gt_tagerator_option_parser_new(void *tool_arguments)
                            &arguments->skpp, false);
   gt_option_parser_add_option(op, option);
 
+  optionbatch = gt_option_new_uword("batch","search exact matches of the "
+                                    "given number of tags at a time in a "
+                                    "packed index\n(only for -e 0)",
+                                    &arguments->batchsize, 0);
+  gt_option_parser_add_option(op, optionbatch);
+  gt_option_exclude(optiononline,optionbatch);
+  gt_option_exclude(optioncmp,optionbatch);
+  gt_option_exclude(optionesaindex,optionbatch);
+
   option = gt_option_new_bool("withwildcards","output matches containing "
                               "wildcard characters (e.g. N); only relevant for "
                               "approximate matching",
@@ -231,6 +240,11 @@ static int gt_tagerator_arguments_check(GT_UNUSED int rest_argc,
       return -1;
     }
   }
+  if (arguments->batchsize > 0 && arguments->userdefinedmaxdistance != 0)
+  {
+    gt_error_set(err,"option -batch requires option -e 0");
+    return -1;
+  }
   for (idx=0; idx<gt_str_array_size(arguments->outputspec); idx++)
   {
     if (gt_optionargaddbitmask(outputmodedesctable,
@@ -55,11 +55,13 @@ typedef struct
   GtUword mersize,
                 userdefinedminocc,
                 userdefinedmaxocc;
-  unsigned int userdefinedprefixlength;
+  unsigned int userdefinedprefixlength,
+               numofparts;
   Prefixlengthvalue prefixlength;
   GtOption *refoptionpl;
   GtStr *str_storeindex,
-        *str_inputindex;
+        *str_inputindex,
+        *str_inputencseq;
   bool storecounts,
        performtest,
        verbose,
@@ -72,6 +74,7 @@ static void *gt_tyr_mkindex_arguments_new(void)
     = gt_malloc(sizeof (Tyr_mkindex_options));
   arguments->str_storeindex = gt_str_new();
   arguments->str_inputindex = gt_str_new();
+  arguments->str_inputencseq = gt_str_new();
   return arguments;
 }
 
@@ -85,6 +88,7 @@ static void gt_tyr_mkindex_arguments_delete(void *tool_arguments)
   }
   gt_str_delete(arguments->str_storeindex);
   gt_str_delete(arguments->str_inputindex);
+  gt_str_delete(arguments->str_inputencseq);
   gt_option_delete(arguments->refoptionpl);
   gt_free(arguments);
 }
@@ -99,21 +103,43 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
            *optionstoreindex,
            *optionstorecounts,
            *optionscan,
-           *optionesa;
+           *optionesa,
+           *optionesq,
+           *optionparts,
+           *optiontest;
   Tyr_mkindex_options *arguments = tool_arguments;
 
-  op = gt_option_parser_new("[options] -esa suffixerator-index [options]",
+  op = gt_option_parser_new("[options] -esa suffixerator-index [options]\n"
+                            "[options] -esq encseq-index [options]",
                             "Count and index k-mers in the given enhanced "
                             "suffix array for a fixed value of k.");
   gt_option_parser_set_mail_address(op, "<kurtz@zbh.uni-hamburg.de>");
 
-  optionesa = gt_option_new_string("esa","specify suffixerator-index\n"
-                                   "(mandatory option)",
+  optionesa = gt_option_new_string("esa","specify suffixerator-index",
                                    arguments->str_inputindex,
                                    NULL);
-  gt_option_is_mandatory(optionesa);
   gt_option_parser_add_option(op, optionesa);
 
+  optionesq = gt_option_new_string("esq","specify encoded sequence to count "
+                                   "the mers in directly, without enhanced "
+                                   "suffix array, using the threads given "
+                                   "by option -j of gt",
+                                   arguments->str_inputencseq,
+                                   NULL);
+  gt_option_parser_add_option(op, optionesq);
+  gt_option_exclude(optionesa, optionesq);
+  gt_option_is_mandatory_either(optionesa, optionesq);
+
+  optionparts = gt_option_new_uint_min("parts",
+                                       "sort the mer codes in the specified "
+                                       "number of parts, to reduce the space "
+                                       "requirement of option -esq",
+                                       &arguments->numofparts,
+                                       1U,
+                                       1U);
+  gt_option_parser_add_option(op, optionparts);
+  gt_option_imply(optionparts, optionesq);
+
   option = gt_option_new_uword("mersize",
                                "Specify the mer size.",
                                &arguments->mersize,
@@ -157,11 +183,12 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
                                          &arguments->storecounts,false);
   gt_option_parser_add_option(op, optionstorecounts);
 
-  option = gt_option_new_bool("test", "perform tests to verify program "
-                                      "correctness", &arguments->performtest,
-                                      false);
-  gt_option_is_development_option(option);
-  gt_option_parser_add_option(op, option);
+  optiontest = gt_option_new_bool("test", "perform tests to verify program "
+                                          "correctness",
+                                  &arguments->performtest, false);
+  gt_option_is_development_option(optiontest);
+  gt_option_parser_add_option(op, optiontest);
+  gt_option_exclude(optiontest, optionesq);
 
   optionscan = gt_option_new_bool("scan",
                                   "read enhanced suffix array sequentially "
@@ -169,6 +196,7 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
                                   &arguments->scanfile,
                                   false);
   gt_option_parser_add_option(op, optionscan);
+  gt_option_exclude(optionscan, optionesq);
 
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -176,6 +204,7 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
   gt_option_imply(optionpl, optionstoreindex);
   gt_option_imply(optionstorecounts, optionstoreindex);
   gt_option_imply_either_2(optionstoreindex,optionminocc,optionmaxocc);
+  gt_option_imply(optionesq, optionstoreindex);
   return op;
 }
 
@@ -256,20 +285,43 @@ static int gt_tyr_mkindex_runner(GT_UNUSED int argc,
     {
       printf("# storeindex=%s\n",gt_str_get(arguments->str_storeindex));
     }
-    printf("# inputindex=%s\n",gt_str_get(arguments->str_inputindex));
+    if (gt_str_length(arguments->str_inputencseq) > 0)
+    {
+      printf("# inputencseq=%s\n",gt_str_get(arguments->str_inputencseq));
+    } else
+    {
+      printf("# inputindex=%s\n",gt_str_get(arguments->str_inputindex));
+    }
   }
-  if (gt_merstatistics(gt_str_get(arguments->str_inputindex),
-                    arguments->mersize,
-                    arguments->userdefinedminocc,
-                    arguments->userdefinedmaxocc,
-                    gt_str_get(arguments->str_storeindex),
-                    arguments->storecounts,
-                    arguments->scanfile,
-                    arguments->performtest,
-                    logger,
-                    err) != 0)
+  if (gt_str_length(arguments->str_inputencseq) > 0)
   {
-    haserr = true;
+    if (gt_merstatistics_encseq(gt_str_get(arguments->str_inputencseq),
+                                arguments->mersize,
+                                arguments->userdefinedminocc,
+                                arguments->userdefinedmaxocc,
+                                gt_str_get(arguments->str_storeindex),
+                                arguments->storecounts,
+                                arguments->numofparts,
+                                logger,
+                                err) != 0)
+    {
+      haserr = true;
+    }
+  } else
+  {
+    if (gt_merstatistics(gt_str_get(arguments->str_inputindex),
+                      arguments->mersize,
+                      arguments->userdefinedminocc,
+                      arguments->userdefinedmaxocc,
+                      gt_str_get(arguments->str_storeindex),
+                      arguments->storecounts,
+                      arguments->scanfile,
+                      arguments->performtest,
+                      logger,
+                      err) != 0)
+    {
+      haserr = true;
+    }
   }
   if (!haserr &&
       gt_str_length(arguments->str_storeindex) > 0 &&
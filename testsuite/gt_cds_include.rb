@@ -12,6 +12,53 @@ require 'fileutils'
   end
 end
 
+1.upto(14) do |i|
+  Name "gt cds test #{i} (-pipeline)"
+  Keywords "gt_cds pipeline"
+  Test do
+    FileUtils.copy "#{$testdata}gt_cds_test_#{i}.fas", "."
+    run_test "#{$bin}gt cds -pipeline -minorflen 1 -startcodon yes " \
+             "-seqfile gt_cds_test_#{i}.fas -matchdesc " \
+             "#{$testdata}gt_cds_test_#{i}.in"
+    run "diff #{last_stdout} #{$testdata}gt_cds_test_#{i}.out"
+  end
+end
+
+1.upto(14) do |i|
+  Name "gt cds test #{i} (parallel)"
+  Keywords "gt_cds parallel"
+  Test do
+    FileUtils.copy "#{$testdata}gt_cds_test_#{i}.fas", "."
+    run_test "#{$bin}gt -j 4 cds -minorflen 1 -startcodon yes " \
+             "-seqfile gt_cds_test_#{i}.fas -matchdesc " \
+             "#{$testdata}gt_cds_test_#{i}.in"
+    run "diff #{last_stdout} #{$testdata}gt_cds_test_#{i}.out"
+  end
+end
+
+Name "gt cds arabidopsis (parallel)"
+Keywords "gt_cds parallel"
+Test do
+  FileUtils.copy "#{$testdata}U89959_genomic.fas", "."
+  run_test "#{$bin}gt gff3 -sort #{$testdata}U89959_csas.gff3"
+  run "mv #{last_stdout} csas.gff3"
+  run_test "#{$bin}gt cds -seqfile U89959_genomic.fas -matchdesc csas.gff3"
+  run "mv #{last_stdout} cds.gff3"
+  run_test "#{$bin}gt -j 3 cds -seqfile U89959_genomic.fas -matchdesc " \
+           "csas.gff3"
+  run "diff #{last_stdout} cds.gff3"
+end
+
+Name "gt cds error message (parallel)"
+Keywords "gt_cds parallel"
+Test do
+  FileUtils.copy "#{$testdata}gt_cds_test_1.fas", "."
+  run "#{$bin}gt gff3 -offset 1000 #{$testdata}gt_cds_test_1.in | " \
+      "#{$bin}gt -j 3 cds -matchdesc -seqfile gt_cds_test_1.fas -",
+      :retval => 1
+  grep last_stderr, "Has the sequence-region to sequence mapping been defined correctly"
+end
+
 Name "gt cds error message"
 Keywords "gt_cds"
 Test do
@@ -14,6 +14,15 @@ end
   end
 end
 
+1.upto(6) do |i|
+  Name "gt csa prob #{i} (-pipeline)"
+  Keywords "gt_csa pipeline"
+  Test do
+    run_test "#{$bin}gt csa -pipeline #{$testdata}gt_csa_prob_#{i}.in"
+    run "diff #{last_stdout} #{$testdata}gt_csa_prob_#{i}.out"
+  end
+end
+
 1.upto(4) do |i|
   Name "gt -debug csa prob #{i}"
   Keywords "gt_csa"
@@ -54,6 +54,28 @@ Test do
   grep(last_stderr, /cannot open file.*ois/)
 end
 
+Name "gt encseq encode with read-ahead thread"
+Keywords "encseq gt_encseq_encode threads"
+Test do
+  calls = [["-des -sds -md5",
+            "#{$testdata}at1MB #{$testdata}U89959_genomic.fas"],
+           ["-lossless -clipdesc", "#{$testdata}at1MB"],
+           ["-des -sds", "#{$testdata}fastq_long.fastq"],
+           ["-des -sds", "#{$testdata}Atinsert.embl"],
+           ["-des no -sds no", "#{$testdata}Arabidopsis-C99826.gbk"]]
+  calls.each do |opts, files|
+    run "rm -f j1.* j3.*"
+    run_test "#{$bin}gt -j 1 encseq encode #{opts} -indexname j1 #{files}"
+    run_test "#{$bin}gt -j 3 encseq encode #{opts} -indexname j3 #{files}"
+    Dir.glob("j1.*").each do |j1file|
+      run "cmp #{j1file} #{j1file.sub(/^j1/, "j3")}"
+    end
+  end
+  run_test "#{$bin}gt -j 3 encseq encode -indexname j3 #{$testdata}at1MB " +
+           "#{$testdata}sw100K1.fsa", :retval => 1
+  grep(last_stderr, /illegal character 'F': file ".*sw100K1.fsa", line 2/)
+end
+
 STDREADMODES  = ["fwd", "rev"]
 DNAREADMODES  = STDREADMODES + ["cpl", "rcl"]
 DNATESTSEQS   = ["#{$testdata}foobar.fas",
@@ -442,3 +464,124 @@ Test do
     end
   end
 end
+
+Name "gt encseq check bulk extraction"
+Keywords "encseq gt_encseq_check extract"
+Test do
+  ["Atinsert.fna", "RandomN.fna", "Reads1.fna"].each do |file|
+    sats = ["direct", "bit", "uchar", "ushort", "uint32"]
+    sats.push("eqlen") if file == "Reads1.fna"
+    sats.each do |sat|
+      run_test "#{$bin}gt encseq encode -sat #{sat} -indexname sfx " +
+               "#{$testdata}#{file}"
+      run_test "#{$bin}gt encseq check -scantrials 20 sfx"
+    end
+  end
+end
+
+Name "gt encseq shard"
+Keywords "encseq gt_encseq_shard"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname v1 #{$testdata}Atinsert.fna"
+  run_test "#{$bin}gt encseq encode -indexname v2 #{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq encode -indexname all " +
+           "#{$testdata}Atinsert.fna #{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq shard -indexname coll v1"
+  run_test "#{$bin}gt encseq shard -indexname coll v2"
+  ["", "-dir rev", "-dir rcl -output concat", "-output concat",
+   "-seqrange 10 15", "-output concat -range 20400 20500"].each do |opts|
+    run_test "#{$bin}gt encseq decode #{opts} all"
+    run "mv #{last_stdout} all.out"
+    run_test "#{$bin}gt encseq decode #{opts} coll"
+    run "cmp #{last_stdout} all.out"
+  end
+  run_test "#{$bin}gt encseq decode -mirrored coll", :retval => 1
+  grep last_stderr, /mirroring is not supported/
+end
+
+Name "gt encseq shard (lossless, md5)"
+Keywords "encseq gt_encseq_shard"
+Test do
+  run_test "#{$bin}gt encseq encode -lossless -md5 -indexname v1 " +
+           "#{$testdata}Atinsert.fna"
+  run_test "#{$bin}gt encseq encode -lossless -md5 -indexname v2 " +
+           "#{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq encode -lossless -md5 -indexname all " +
+           "#{$testdata}Atinsert.fna #{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq shard -indexname coll v1 v2"
+  run_test "#{$bin}gt encseq decode -lossless all"
+  run "mv #{last_stdout} all.out"
+  run_test "#{$bin}gt encseq decode -lossless coll"
+  run "cmp #{last_stdout} all.out"
+  run_test "#{$bin}gt encseq md5 -fromindex all"
+  run "mv #{last_stdout} all.out"
+  run_test "#{$bin}gt encseq md5 -fromindex coll"
+  run "cmp #{last_stdout} all.out"
+end
+
+Name "gt encseq shard (check, bitextract)"
+Keywords "encseq gt_encseq_shard"
+Test do
+  files = ["Atinsert.fna", "Random.fna", "Duplicate.fna", "U89959_genomic.fas"]
+  run_test "#{$bin}gt encseq encode -sat uchar -indexname all " +
+           files.map { |file| "#{$testdata}#{file}" }.join(" ")
+  [["bit", "direct", "bit", "uchar"],
+   ["uchar", "ushort", "uint32", "uchar"]].each_with_index do |sats, idx|
+    files.each_with_index do |file, volnum|
+      run_test "#{$bin}gt encseq encode -sat #{sats[volnum]} " +
+               "-indexname v#{idx}#{volnum} #{$testdata}#{file}"
+    end
+    run_test "#{$bin}gt encseq shard -indexname coll#{idx} " +
+             (0...files.length).map { |volnum| "v#{idx}#{volnum}" }.join(" ")
+    run_test "#{$bin}gt encseq check -scantrials 10 coll#{idx}"
+    ["fwd", "rev"].each do |dir|
+      run_test "#{$bin}gt encseq bitextract -dir #{dir} -specialranges all"
+      run "mv #{last_stdout} all.out"
+      run_test "#{$bin}gt encseq bitextract -dir #{dir} -specialranges " +
+               "coll#{idx}"
+      run "cmp #{last_stdout} all.out"
+    end
+  end
+  # all volumes of coll1 support stop positions
+  [0, 5, 1000, 20000, 29500].each do |pos|
+    ["fwd", "rev"].each do |dir|
+      run_test "#{$bin}gt encseq bitextract -dir #{dir} -stoppos #{pos} all"
+      run "mv #{last_stdout} all.out"
+      run_test "#{$bin}gt encseq bitextract -dir #{dir} -stoppos #{pos} coll1"
+      run "cmp #{last_stdout} all.out"
+    end
+  end
+end
+
+Name "gt encseq shard (suffixerator)"
+Keywords "encseq gt_encseq_shard gt_suffixerator"
+Test do
+  run_test "#{$bin}gt encseq encode -sat uchar -indexname v1 " +
+           "#{$testdata}Atinsert.fna"
+  run_test "#{$bin}gt encseq encode -sat bit -indexname v2 " +
+           "#{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq encode -indexname all " +
+           "#{$testdata}Atinsert.fna #{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq shard -indexname coll v1 v2"
+  run_test "#{$bin}gt suffixerator -ii all -suf -lcp -bwt -indexname all"
+  run_test "#{$bin}gt suffixerator -ii coll -suf -lcp -bwt -indexname coll"
+  ["suf", "lcp", "bwt"].each do |suffix|
+    run "cmp all.#{suffix} coll.#{suffix}"
+  end
+  run_test "#{$bin}gt repfind -ii all -l 30 -r"
+  run "grep -v '^#' #{last_stdout} > all.out"
+  run_test "#{$bin}gt repfind -ii coll -l 30 -r"
+  run "grep -v '^#' #{last_stdout} > coll.out"
+  run "cmp all.out coll.out"
+end
+
+Name "gt encseq shard (errors)"
+Keywords "encseq gt_encseq_shard"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname v1 #{$testdata}Atinsert.fna"
+  run_test "#{$bin}gt encseq encode -indexname p #{$testdata}sw100K1.fsa"
+  run_test "#{$bin}gt encseq shard -indexname coll v1 p", :retval => 1
+  grep last_stderr, /alphabet of volume "p" differs/
+  run_test "#{$bin}gt encseq shard -indexname coll nonexist", :retval => 1
+  grep last_stderr, /is not an encoded sequence/
+end
@@ -1028,6 +1028,88 @@ Test do
   run "diff #{last_stdout} #{$testdata}sequence_region_joined.gff3"
 end
 
+["standard_gene_as_dag.gff3", "multi_feature_simple.gff3",
+ "encode_known_genes_Mar07.gff3", "gt_gff3_prob_7.in",
+ "two_fasta_seqs_without_sequence_regions.gff3"].each do |file|
+  Name "gt gff3 -sort with memory limit (#{file})"
+  Keywords "gt_gff3 sortmemlimit"
+  Test do
+    run_test "#{$bin}gt gff3 -sort -retainids #{$testdata}#{file}"
+    run "mv #{last_stdout} sorted.gff3"
+    ["1", "300", "4k"].each do |memlimit|
+      run_test "env GT_SORT_MEMLIMIT=#{memlimit} #{$bin}gt gff3 -sort " +
+               "-retainids #{$testdata}#{file}"
+      run "diff #{last_stdout} sorted.gff3"
+    end
+    run_test "#{$bin}gt gff3 -sortmemlimit 1 -sort -retainids " +
+             "#{$testdata}#{file}"
+    run "diff #{last_stdout} sorted.gff3"
+  end
+end
+
+Name "gt gff3 join sequence regions with memory limit"
+Keywords "gt_gff3 sortmemlimit"
+Test do
+  run_test "env GT_SORT_MEMLIMIT=1 #{$bin}gt gff3 -sort " +
+           "#{$testdata}sequence_region_1.gff3 " +
+           "#{$testdata}sequence_region_2.gff3 "
+  run "diff #{last_stdout} #{$testdata}sequence_region_joined.gff3"
+end
+
+[["encode_known_genes_Mar07.gff3", "", 0],
+ ["encode_known_genes_Mar07.gff3", "-sort -checkids", 0],
+ ["standard_fasta_example.gff3", "", 0],
+ ["empty_attribute_value.gff3", "-tidy", 0],
+ ["gff3_numeric_only.gff3", "-tidy", 0],
+ ["corrupt_target_attribute.gff3", "", 1]].each do |file, opts, retval|
+  Name "gt gff3 multithreaded parsing (#{file} #{opts})"
+  Keywords "gt_gff3 multithreaded"
+  Test do
+    run_test "#{$bin}gt gff3 #{opts} #{$testdata}#{file}", :retval => retval
+    run "mv #{last_stdout} out_1"
+    run "mv #{last_stderr} err_1"
+    run_test "#{$bin}gt -j 4 gff3 #{opts} #{$testdata}#{file}",
+             :retval => retval
+    run "diff #{last_stdout} out_1"
+    run "diff #{last_stderr} err_1"
+  end
+end
+
+[["encode_known_genes_Mar07.gff3", "-sort", 0],
+ ["standard_fasta_example.gff3", "-addintrons", 0],
+ ["empty_attribute_value.gff3", "-tidy", 0],
+ ["corrupt_large.gff3", "", 1],
+ ["corrupt_large.gff3", "-sort", 1]].each do |file, opts, retval|
+  Name "gt gff3 -pipeline (#{file} #{opts})"
+  Keywords "gt_gff3 pipeline"
+  Test do
+    run_test "#{$bin}gt gff3 #{opts} #{$testdata}#{file}", :retval => retval
+    run "mv #{last_stdout} out_1"
+    run "mv #{last_stderr} err_1"
+    run_test "#{$bin}gt gff3 -pipeline #{opts} #{$testdata}#{file}",
+             :retval => retval
+    run "diff #{last_stdout} out_1"
+    run "diff #{last_stderr} err_1"
+  end
+end
+
+[["encode_known_genes_Mar07.gff3", "-sort", 0],
+ ["cds_with_multiple_parents_1.gff3", "-tidy", 0],
+ ["standard_gene_as_tree.gff3 standard_fasta_example.gff3", "-sort", 0],
+ ["corrupt_large.gff3", "", 1]].each do |files, opts, retval|
+  Name "gt gff3 -arena (#{files} #{opts})"
+  files = files.split.map { |file| "#{$testdata}#{file}" }.join(" ")
+  Keywords "gt_gff3 arena"
+  Test do
+    run_test "#{$bin}gt gff3 #{opts} #{files}", :retval => retval
+    run "mv #{last_stdout} out_1"
+    run "mv #{last_stderr} err_1"
+    run_test "#{$bin}gt gff3 -arena #{opts} #{files}", :retval => retval
+    run "diff #{last_stdout} out_1"
+    run "diff #{last_stderr} err_1"
+  end
+end
+
 Name "gt gff3 print very long attributes"
 Keywords "gt_gff3"
 Test do
@@ -1042,6 +1124,56 @@ Test do
   run_test "#{$bin}gt gff3 out.gff3.gz | diff #{$testdata}dynbuf.gff3 -"
 end
 
+Name "gt gff3 BGZF output and input with several threads"
+Keywords "gt_gff3 bgzf"
+Test do
+  run_test "#{$bin}gt gff3 #{$testdata}encode_known_genes_Mar07.gff3"
+  run "mv #{last_stdout} out.gff3"
+  run_test "#{$bin}gt -j 3 gff3 -bgzip -o out3.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3"
+  run_test "#{$bin}gt -j 1 gff3 -bgzip -o out1.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3"
+  run "cmp out1.gff3.gz out3.gff3.gz"
+  run "gzip -dc out3.gff3.gz | diff out.gff3 -"
+  [1,3].each do |jobs|
+    run_test "#{$bin}gt -j #{jobs} gff3 out3.gff3.gz | diff out.gff3 -"
+  end
+  run "gzip -c out.gff3 > plain.gff3.gz"
+  run_test "#{$bin}gt -j 3 gff3 plain.gff3.gz | diff out.gff3 -"
+  run "head -c 100000 out3.gff3.gz > truncated.gff3.gz"
+  run_test "#{$bin}gt -j 3 gff3 truncated.gff3.gz", :retval => 1
+  grep last_stderr, /truncated block/
+end
+
+Name "gt gff3 BGZF input followed by a plain gzip member"
+Keywords "gt_gff3 bgzf"
+Test do
+  run_test "#{$bin}gt gff3 -bgzip -o out.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3"
+  run "sed 1d #{$testdata}standard_gene_as_tree.gff3 | gzip -c > tail1.gz"
+  run "echo '###' | gzip -c > tail2.gz"
+  run "cat out.gff3.gz tail1.gz tail2.gz > concat.gff3.gz"
+  run "gzip -dc concat.gff3.gz > concat.gff3"
+  run_test "#{$bin}gt gff3 concat.gff3"
+  run "mv #{last_stdout} out.gff3"
+  [1,3].each do |jobs|
+    run_test "#{$bin}gt -j #{jobs} gff3 concat.gff3.gz | diff out.gff3 -"
+  end
+  run "head -c -20 concat.gff3.gz > truncated.gff3.gz"
+  run_test "#{$bin}gt gff3 truncated.gff3.gz", :retval => 1
+  grep last_stderr, /truncated gzip member/
+end
+
+Name "gt gff3 -gzip output is not blocked"
+Keywords "gt_gff3 bgzf"
+Test do
+  run_test "#{$bin}gt -j 3 gff3 -gzip -o out.gff3.gz " +
+           "#{$testdata}encode_known_genes_Mar07.gff3"
+  # the gzip header flags of zlib output do not include FEXTRA
+  run "od -A n -t u1 -j 3 -N 1 out.gff3.gz"
+  grep last_stdout, /^\s*0\s*$/
+end
+
 Name "gt gff3 print very long attributes (-bzip2)"
 Keywords "gt_gff3"
 Test do
@@ -176,3 +176,71 @@ Test do
            :retval => 1
   run "rm -f sfx.* fmi.* pck.*"
 end
+
+Name "gt matstat/tagerator batch at1MB U8"
+Keywords "gt_greedyfwdmat gt_tagerator batch"
+Test do
+  run "#{$bin}gt packedindex mkindex -tis -ssp -indexname pck " +
+      "-db #{$testdata}at1MB -sprank -dna -pl -bsize 10 -locfreq 32 -dir rev",
+      :maxtime => 180
+  matstatcall = "#{$bin}gt matstat -verify -output querypos subjectpos " +
+                "sequence -min 1 -max 30 -query " +
+                "#{$testdata}U89959_genomic.fas -pck pck"
+  run_test matstatcall, :maxtime => 300
+  run "mv #{last_stdout} tmp.matstat"
+  [1,7,1000].each do |batchsize|
+    run_test "#{matstatcall} -batch #{batchsize}", :maxtime => 300
+    run "diff #{last_stdout} tmp.matstat"
+  end
+  run "#{$bin}gt shredder -minlength 12 -maxlength 15 " +
+      "#{$testdata}U89959_genomic.fas | " +
+      "#{$bin}gt seqfilter -minlength 12 - | " +
+      "sed -e \'s/^>.*/>/\' > patternfile"
+  ["","-nod","-nop"].each do |strands|
+    run_test "#{$bin}gt tagerator -e 0 -pck pck -q patternfile #{strands}"
+    run "mv #{last_stdout} tmp.tagerator"
+    run_test "#{$bin}gt tagerator -e 0 -pck pck -q patternfile #{strands} " +
+             "-batch 100"
+    run "diff #{last_stdout} tmp.tagerator"
+  end
+  run_test "#{$bin}gt prebwt -maxdepth 4 -pck pck", :maxtime => 180
+  run_test "#{$bin}gt tagerator -e 0 -pck pck -q patternfile"
+  run "mv #{last_stdout} tmp.tagerator"
+  run_test "#{$bin}gt tagerator -e 0 -pck pck -q patternfile -batch 1"
+  run "diff #{last_stdout} tmp.tagerator"
+  run_test "#{$bin}gt tagerator -e 1 -pck pck -q patternfile -batch 10",
+           :retval => 1
+  grep last_stderr, /option -batch requires option -e 0/
+end
+
+Name "gt matstat/uniquesub/tagerator multithreaded at1MB U8"
+Keywords "gt_greedyfwdmat gt_tagerator threads"
+Test do
+  run "#{$bin}gt suffixerator -tis -suf -ssp -lcp -dna -pl " +
+      "-db #{$testdata}at1MB -indexname sfx"
+  run "#{$bin}gt packedindex mkindex -tis -ssp -indexname pck " +
+      "-db #{$testdata}at1MB -sprank -dna -pl -bsize 10 -locfreq 32 -dir rev",
+      :maxtime => 180
+  run "#{$bin}gt shredder -minlength 12 -maxlength 15 " +
+      "#{$testdata}U89959_genomic.fas | " +
+      "#{$bin}gt seqfilter -minlength 12 - | " +
+      "sed -e \'s/^>.*/>/\' > patternfile"
+  ["matstat -verify -output querypos subjectpos sequence -min 1 -max 30 " +
+   "-query #{$testdata}U89959_genomic.fas -pck pck",
+   "matstat -output querypos subjectpos -min 1 -max 30 " +
+   "-query #{$testdata}U89959_genomic.fas -esa sfx",
+   "uniquesub -output querypos sequence -min 1 -max 30 " +
+   "-query #{$testdata}U89959_genomic.fas -esa sfx",
+   "tagerator -e 0 -pck pck -q patternfile",
+   "tagerator -e 0 -pck pck -q patternfile -batch 7",
+   "tagerator -e 1 -esa sfx -q patternfile -output tagnum tagseq " +
+   "dblength dbstartpos strand edist",
+   "tagerator -maxocc 10 -pck pck -q patternfile"].each do |call|
+    run_test "#{$bin}gt -j 1 #{call}", :maxtime => 300
+    run "mv #{last_stdout} tmp.j1"
+    [2,3].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} #{call}", :maxtime => 300
+      run "diff #{last_stdout} tmp.j1"
+    end
+  end
+end
@@ -156,6 +156,37 @@ Test do
                          :chkintegrity => 800, :chksearch => 400 })
 end
 
+Name "gt packedindex mkindex multithreaded"
+Keywords "gt_packedindex"
+Test do
+  run_test "#{$bin}gt packedindex mkindex -tis -ssp -indexname j1 " +
+           "-db #{$testdata}at1MB -sprank -dna -bsize 10 -locfreq 32",
+           :maxtime => 400
+  [2,3].each do |jobs|
+    run_test "#{$bin}gt -j #{jobs} packedindex mkindex -tis -ssp " +
+             "-indexname j#{jobs} -db #{$testdata}at1MB -sprank -dna " +
+             "-bsize 10 -locfreq 32", :maxtime => 400
+    run "cmp j1.bdx j#{jobs}.bdx"
+  end
+  run_test "#{$bin}gt suffixerator -tis -ssp -indexname j3 -bwt -suf " +
+           "-db #{$testdata}at1MB -dna", :maxtime => 400
+  run_test "#{$bin}gt packedindex chkintegrity -ticks 1000 j3",
+           :maxtime => 800
+end
+
+Name "gt packedindex benchrank"
+Keywords "gt_packedindex"
+Test do
+  [["at1MB","-dna","4"],["at1MB","-dna","12"],
+   ["sw100K1.fsa","-protein","3"]].each do |file,alpha,bsize|
+    run_test "#{$bin}gt packedindex mkindex -tis -indexname pck " +
+             "-db #{$testdata}#{file} #{alpha} -bsize #{bsize}",
+             :maxtime => 400
+    run_test "#{$bin}gt packedindex benchrank -nsamples 20000 pck"
+    run "grep 'packed blocks' #{last_stdout}"
+  end
+end
+
 if $gttestdata then
   Name "gt packedindex check tools for chr01 yeast"
   Keywords "gt_packedindex"
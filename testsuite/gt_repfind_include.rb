@@ -255,6 +255,21 @@ Test do
   run "#{$bin}gt repfind -samples 1000 -l 6 -ii sfx",:maxtime => 600
 end
 
+Name "gt repfind multithreaded (compare -j 1 with -j N)"
+Keywords "gt_repfind"
+Test do
+  run_test "#{$bin}gt suffixerator -db #{$testdata}at1MB " +
+           "-indexname sfx -dna -tis -suf -lcp -ssp -pl"
+  # with -l 9 the parts have more maximal pairs than they buffer
+  ["-l 20", "-l 9", "-l 30 -maxfreq 3", "-l 25 -extendgreedy"].each do |opts|
+    [1,3].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} repfind #{opts} -ii sfx"
+      run "mv #{last_stdout} repfind-#{jobs}.out"
+    end
+    run "cmp repfind-1.out repfind-3.out"
+  end
+end
+
 if $gttestdata then
   extendexception = ["hs5hcmvcg.fna","Wildcards.fna","at1MB"]
   repfindtestfiles.each do |reffile|
@@ -374,6 +374,23 @@ Test do
   end
 end
 
+Name "gt seed_extend: threads output in order of sequence parts"
+Keywords "gt_seed_extend thread gt_seed_extend_thread"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  for kmerfile in ["yes", "no"] do
+    run_test "#{$bin}gt seed_extend -ii at1MB -parts 7 -kmerfile #{kmerfile}"
+    run "grep -v '^#' #{last_stdout}"
+    run "mv #{last_stdout} serial_run.out"
+    run_test "#{$bin}gt -j 4 seed_extend -v -ii at1MB -parts 7 " +
+             "-kmerfile #{kmerfile}"
+    grep last_stdout, /^# thread 3 processed [0-9]+ combinations/
+    grep last_stdout, /^# threads were idle for/
+    run "grep -v '^#' #{last_stdout}"
+    run "cmp #{last_stdout} serial_run.out"
+  end
+end
+
 # KmerPos and SeedPair verification
 Name "gt seed_extend: small_poly, no extension, verify lists"
 Keywords "gt_seed_extend only-seeds verify debug-kmer debug-seedpair small_poly"
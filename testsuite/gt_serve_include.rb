@@ -0,0 +1,59 @@
+Name "gt serve stdin"
+Keywords "gt_serve"
+Test do
+  run_test "#{$bin}gt suffixerator -db #{$testdata}at1MB -indexname at " +
+           "-suf -lcp -tis -pl"
+  run_test "#{$bin}gt tallymer mkindex -mersize 12 -minocc 2 " +
+           "-indexname tyr -counts -pl -esa at"
+  search = "tallymer search -tyr tyr -q #{$testdata}U89959_genomic.fas " +
+           "-output qseqnum qpos counts sequence"
+  run_test "#{$bin}gt #{search}"
+  run "mv #{last_stdout} direct.out"
+  File.open("requests", "w") do |f|
+    f.puts search
+    f.puts ""
+    f.puts "nosuchtool -foo"
+    f.puts search
+  end
+  run_test "#{$bin}gt serve < requests"
+  run "mv #{last_stdout} served.out"
+  lines = File.readlines("served.out")
+  status = lines.each_index.select { |i| lines[i] =~ /^#gt-serve / }
+  if status.length != 3 then
+    raise "expected 3 responses, got #{status.length}"
+  end
+  if lines[status[1]] != "#gt-serve error: unknown tool 'nosuchtool'\n" then
+    raise "unexpected status line: #{lines[status[1]]}"
+  end
+  direct = File.read("direct.out")
+  if lines[0...status[0]].join != direct or
+     lines[status[1]+1...status[2]].join != direct then
+    raise "served output differs from direct output"
+  end
+end
+
+Name "gt serve socket"
+Keywords "gt_serve"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname at #{$testdata}at1MB"
+  run_test "#{$bin}gt encseq info at"
+  run "mv #{last_stdout} direct.out"
+  run "sh -c '#{$bin}gt serve -socket gt.sock > server.out 2>&1 &'"
+  run "sh -c 'i=0; while [ ! -S gt.sock ] && [ $i -lt 100 ]; do " +
+      "sleep 0.1; i=$((i+1)); done; test -S gt.sock'"
+  run_test "echo 'encseq info at' | #{$bin}gt serve -connect gt.sock"
+  run "cmp #{last_stdout} direct.out"
+  run_test "printf 'encseq info at\\nencseq info nosuchindex\\n' | " +
+           "#{$bin}gt serve -connect gt.sock", :retval => 1
+  grep last_stderr, /nosuchindex/
+  run "cmp #{last_stdout} direct.out"
+  # a tool ending the process only ends the child answering the request
+  run_test "echo 'compreads compress -files nonexist.fq -name y' | " +
+           "#{$bin}gt serve -connect gt.sock", :retval => 1
+  grep last_stderr, /nonexist\.fq/
+  run_test "echo 'encseq info at' | #{$bin}gt serve -connect gt.sock"
+  run "cmp #{last_stdout} direct.out"
+  run_test "echo shutdown | #{$bin}gt serve -connect gt.sock"
+  run "sh -c 'i=0; while [ -S gt.sock ] && [ $i -lt 100 ]; do " +
+      "sleep 0.1; i=$((i+1)); done; test ! -S gt.sock'"
+end
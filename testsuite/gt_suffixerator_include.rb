@@ -601,3 +601,111 @@ Test do
   run "#{$bin}/gt dev sfxmap -enumlcpitvtree -esa sfx > noBU.txt"
   run "diff withBU.txt noBU.txt"
 end
+
+Name "gt sfxmap lcp-interval trees bottomup multithreaded"
+Keywords "gt_suffixerator lcpitv"
+Test do
+  ["Reads2.fna","at1MB"].each do |filename|
+    run "#{$bin}/gt suffixerator -db #{$testdata}/#{filename} -suf -lcp " + \
+        "-indexname sfx"
+    run "#{$bin}/gt dev sfxmap -enumlcpitvtreeBU -esa sfx > withBU.txt"
+    [2,3,8].each do |jobs|
+      run "#{$bin}/gt -j #{jobs} dev sfxmap -enumlcpitvtreeBU -esa sfx " + \
+          "> withBU-j.txt"
+      run "diff withBU.txt withBU-j.txt"
+    end
+  end
+end
+
+Name "gt sain multithreaded"
+Keywords "gt_suffixerator sain"
+Test do
+  run_test "#{$bin}/gt dev sain -fasta #{$testdata}/at1MB -dna -suf -tis " + \
+           "-icheck -fcheck"
+  run "mv at1MB.suf at1MB-j1.suf"
+  run_test "#{$bin}/gt -j 3 dev sain -fasta #{$testdata}/at1MB -dna " + \
+           "-suf -tis -icheck -fcheck"
+  run "cmp at1MB.suf at1MB-j1.suf"
+  run_test "#{$bin}/gt -j 3 dev sain -fasta #{$testdata}/at1MB -dna -lcp"
+  run_test "#{$bin}/gt -j 3 dev sain -fasta #{$testdata}/at1MB -dna " + \
+           "-lcp -kasai"
+  run_test "#{$bin}/gt encseq encode -indexname at1MB #{$testdata}/at1MB"
+  ["fwd","rev","cpl","rcl"].each do |dirarg|
+    run_test "#{$bin}/gt -j 3 dev sain -esq at1MB -dir #{dirarg} -fcheck"
+  end
+end
+
+Name "gt sfxmap with memory map policies"
+Keywords "gt_suffixerator gt_sfxmap mmap_policy"
+Test do
+  run_test "#{$bin}gt suffixerator -db #{$testdata}at1MB -indexname sfx " +
+           "-suf -lcp -bck -tis -ssp -pl"
+  run_test "#{$bin}gt dev sfxmap -esa sfx -suf -lcp -bck -tis -ssp " +
+           "-wholeleafcheck"
+  ["suf=random,hugepages;lcp=sequential;esq=willneed",
+   "*=populate;bck=normal",
+   "*=interleave"].each do |policy|
+    run_test "env GT_MMAP_POLICY=\"#{policy}\" #{$bin}gt dev sfxmap " +
+             "-esa sfx -suf -lcp -bck -tis -ssp -wholeleafcheck"
+    run "test ! -s #{last_stderr}"
+  end
+  run_test "env GT_MMAP_POLICY=\"suf=fast;lcp=random\" #{$bin}gt dev sfxmap " +
+           "-esa sfx -suf -lcp -tis -ssp"
+  grep last_stderr, /ignoring malformed entry "suf=fast"/
+end
+
+Name "gt sain multithreaded (compare -j 1 with -j N)"
+Keywords "gt_suffixerator sain"
+Test do
+  ["fwd","rev","cpl","rcl"].each do |dirarg|
+    [1,2,4].each do |jobs|
+      run_test "#{$bin}/gt -j #{jobs} dev sain -fasta " + \
+               "#{$testdata}/U89959_ests.fas -dna -dir #{dirarg} -suf " + \
+               "-icheck -fcheck"
+      run "mv U89959_ests.fas.suf ests-#{dirarg}-#{jobs}.suf"
+    end
+    run "cmp ests-#{dirarg}-1.suf ests-#{dirarg}-2.suf"
+    run "cmp ests-#{dirarg}-1.suf ests-#{dirarg}-4.suf"
+  end
+  run "cp #{$testdata}/U89959_genomic.fas ."
+  [1,3].each do |jobs|
+    run_test "#{$bin}/gt -j #{jobs} dev sain -file " + \
+             "U89959_genomic.fas -suf -icheck -fcheck"
+    run "mv U89959_genomic.fas.suf genomic-#{jobs}.suf"
+    run_test "#{$bin}/gt -j #{jobs} dev sain -fasta " + \
+             "#{$testdata}/Atinsert.fna -dna -suf -icheck -fcheck"
+    run "mv Atinsert.fna.suf Atinsert-#{jobs}.suf"
+  end
+  run "cmp genomic-1.suf genomic-3.suf"
+  run "cmp Atinsert-1.suf Atinsert-3.suf"
+end
+
+Name "gt sain lcp multithreaded (compare -j 1 with -j N)"
+Keywords "gt_suffixerator sain lcp"
+Test do
+  ["", "-kasai"].each do |kasai|
+    [1,2,3].each do |jobs|
+      run_test "#{$bin}/gt -j #{jobs} dev sain -fasta #{$testdata}/at1MB " + \
+               "-dna -suf -lcp #{kasai}"
+      run "mv at1MB.lcp at1MB#{kasai}-#{jobs}.lcp"
+    end
+    run "cmp at1MB#{kasai}-1.lcp at1MB#{kasai}-2.lcp"
+    run "cmp at1MB#{kasai}-1.lcp at1MB#{kasai}-3.lcp"
+  end
+  run "cmp at1MB-1.lcp at1MB-kasai-1.lcp"
+end
+
+Name "gt suffixerator lcp multithreaded (compare -j 1 with -j N)"
+Keywords "gt_suffixerator lcp"
+Test do
+  ["", "-parts 3", "-dir rev", "-pl 2 -memlimit 3MB"].each do |opts|
+    [1,3].each do |jobs|
+      run_test "#{$bin}/gt -j #{jobs} suffixerator -db #{$testdata}/at1MB " + \
+               "-dna -suf -lcp #{opts} -indexname at1MB-#{jobs}"
+      run_test "#{$bin}/gt dev sfxmap -suf -lcp -esa at1MB-#{jobs}"
+    end
+    ["suf","lcp","llv"].each do |suffix|
+      run "cmp at1MB-1.#{suffix} at1MB-3.#{suffix}"
+    end
+  end
+end
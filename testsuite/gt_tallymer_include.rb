@@ -58,3 +58,60 @@ if $gttestdata then
     end
   end
 end
+
+def checktallymeresq(reffile,mersize,occoptions)
+  run_test "#{$bin}gt suffixerator -dna -tis -suf -lcp " +
+           "-indexname sfxidx -db #{$testdata}#{reffile}"
+  outoptions="-counts -pl -mersize #{mersize} #{occoptions}"
+  run_test "#{$bin}gt tallymer mkindex #{outoptions} " +
+           "-indexname tyr-esa -esa sfxidx"
+  run_test "#{$bin}gt -j 3 tallymer mkindex #{outoptions} " +
+           "-indexname tyr-esq -esq sfxidx -parts 3"
+  ["mer","mct","mbd"].each do |suffix|
+    if File.exist?("tyr-esa.#{suffix}")
+      run "cmp tyr-esa.#{suffix} tyr-esq.#{suffix}"
+    end
+  end
+end
+
+[["Atinsert.fna",19,"-minocc 2 -maxocc 30"],
+ ["at1MB",12,"-minocc 2"],
+ ["at1MB",32,"-minocc 1"],
+ ["Random159.fna",6,"-maxocc 3"],
+ ["RandomN.fna",3,"-minocc 2"]].each do |reffile,mersize,occoptions|
+  Name "gt tallymer mkindex -esq #{reffile} #{mersize} #{occoptions}"
+  Keywords "gt_tallymer mkindex esq"
+  Test do
+    checktallymeresq(reffile,mersize,occoptions)
+  end
+end
+
+Name "gt tallymer mkindex -esq protein"
+Keywords "gt_tallymer mkindex esq"
+Test do
+  run_test "#{$bin}gt encseq encode -indexname prot " +
+           "#{$testdata}trembl-eqlen.faa"
+  run_test "#{$bin}gt tallymer mkindex -mersize 3 -minocc 2 " +
+           "-indexname tyr-esq -esq prot", :retval => 1
+  grep last_stderr, /requires a DNA sequence/
+end
+
+Name "gt tallymer search Atinsert.fna"
+Keywords "gt_tallymer search"
+Test do
+  run_test "#{$bin}gt suffixerator -dna -tis -suf -lcp " +
+           "-indexname sfxidx -db #{$testdata}Atinsert.fna"
+  # without bucket boundaries, each mer is searched on its own
+  run_test "#{$bin}gt tallymer mkindex -counts -mersize 16 -minocc 4 " +
+           "-indexname tyr-single -esa sfxidx"
+  run_test "#{$bin}gt tallymer search -output qseqnum qpos counts " +
+           "sequence -tyr tyr-single -q #{$testdata}Atinsert.fna"
+  run "mv #{last_stdout} single.out"
+  run_test "#{$bin}gt tallymer mkindex -counts -pl -mersize 16 -minocc 4 " +
+           "-indexname tyr-index -esa sfxidx"
+  [1,3].each do |jobs|
+    run_test "#{$bin}gt -j #{jobs} tallymer search -output qseqnum qpos " +
+             "counts sequence -tyr tyr-index -q #{$testdata}Atinsert.fna"
+    run "cmp #{last_stdout} single.out"
+  end
+end
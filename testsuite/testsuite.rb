@@ -212,6 +212,7 @@ require 'gt_script_filter_include'
 require 'gt_scripts_include'
 require 'gt_seed_extend_include'
 require 'gt_select_include'
+require 'gt_serve_include'
 require 'gt_seq_include'
 require 'gt_seqbuffer_include'
 require 'gt_seqfilter_include'